@@ -0,0 +1,298 @@
+#ifndef GNURADIO_ALGORITHM_NCO_HPP
+#define GNURADIO_ALGORITHM_NCO_HPP
+
+#include <array>
+#include <cmath>
+#include <complex>
+#include <concepts>
+#include <cstdint>
+#include <numbers>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <gnuradio-4.0/meta/utils.hpp>
+
+namespace gr::algorithm {
+
+enum class NcoMode {
+    Exact,     /// std::sin/std::cos of the accumulated phase (reference, slowest)
+    Table,     /// look-up table with linear interpolation, |error| < 3e-7 for float and double
+    Polynomial /// SIMD-vectorised polynomial on the octant-reduced phase, |error| ~ 1 ulp of T
+};
+
+/**
+ * @brief Numerically-controlled oscillator (NCO) producing e^{j·φ[n]} with φ[n] = φ0 + 2π·f/fs·n.
+ *
+ * The phase is kept in a fixed-point accumulator (32-bit for float, 64-bit for double) whose full range corresponds to
+ * 2π. Phase wrapping is thus exact and free, and sin/cos are re-evaluated from the phase for every sample, so unlike
+ * recursive rotators there is no amplitude drift or need for re-normalisation. The frequency resolution is
+ * fs/2^32 (float) or fs/2^64 (double).
+ *
+ * Accuracy vs. throughput (see `bm_nco` for measured numbers):
+ *  * NcoMode::Exact: reference `std::sin`/`std::cos`, limited only by the phase quantisation
+ *  * NcoMode::Table: 4096-point look-up table with linear interpolation, |error| < 3e-7, scalar
+ *  * NcoMode::Polynomial: octant reduction + Taylor polynomials evaluated with `stdx::simd`, ~1 ulp, fastest
+ *
+ * usage example:
+ * gr::algorithm::NCO<float> nco(frequency / sampleRate); // normalised frequency in cycles/sample
+ * nco.mix(input, output);                                // output[i] = input[i]·e^{j·φ[i]}
+ */
+template<std::floating_point T>
+struct NCO {
+    using value_type = T;
+    using Phase      = std::conditional_t<std::is_same_v<T, float>, std::uint32_t, std::uint64_t>; // full range <-> 2π
+    using PhaseDiff  = std::make_signed_t<Phase>;
+
+    constexpr static std::size_t kPhaseBits = 8UZ * sizeof(Phase);
+    constexpr static std::size_t kTableBits = 12UZ;
+    constexpr static std::size_t kTableSize = 1UZ << kTableBits;
+    constexpr static std::size_t kMixChunk  = 256UZ; /// number of rotation factors generated at once by `mix(..)`
+
+    NcoMode mode{NcoMode::Polynomial};
+
+private:
+    constexpr static double kPhaseScale = 0x1p-32 * (kPhaseBits == 64UZ ? 0x1p-32 : 1.0); // 2^-kPhaseBits: phase -> turns
+    constexpr static T      kPhaseToRad = static_cast<T>(2. * std::numbers::pi * kPhaseScale);
+
+    Phase _phase{0};
+    Phase _phaseIncrement{0};
+
+public:
+    constexpr NCO() noexcept = default;
+
+    explicit NCO(double normalisedFrequency, double initialPhase = 0., NcoMode mode_ = NcoMode::Polynomial) : mode(mode_) {
+        setFrequency(normalisedFrequency);
+        setPhase(initialPhase);
+    }
+
+    /// @param normalisedFrequency f/fs in cycles per sample, values outside [-0.5, 0.5) alias accordingly
+    void setFrequency(double normalisedFrequency) { _phaseIncrement = toPhase(normalisedFrequency); }
+
+    /// @return normalised frequency f/fs in [-0.5, 0.5)
+    [[nodiscard]] double frequency() const noexcept { return static_cast<double>(static_cast<PhaseDiff>(_phaseIncrement)) * kPhaseScale; }
+
+    /// @param phase in rad
+    void setPhase(double phase) { _phase = toPhase(phase / (2. * std::numbers::pi)); }
+
+    /// @return phase of the next sample in rad, in [-π, π)
+    [[nodiscard]] double phase() const noexcept { return static_cast<double>(static_cast<PhaseDiff>(_phase)) * kPhaseScale * 2. * std::numbers::pi; }
+
+    /// @return e^{j·φ[n]} and advances the phase by one sample
+    [[nodiscard]] std::complex<T> next() noexcept {
+        T s{};
+        T c{};
+        switch (mode) {
+        case NcoMode::Exact: sinCosExact(_phase, s, c); break;
+        case NcoMode::Table: sinCosTable(_phase, s, c); break;
+        case NcoMode::Polynomial: sinCosPolynomial(_phase, s, c); break;
+        }
+        _phase += _phaseIncrement;
+        return {c, s};
+    }
+
+    /// out[i] = e^{j·φ[i]}
+    void generate(std::span<std::complex<T>> out) noexcept {
+        run(out.size(), [&out]<typename V>(std::size_t i, const V& s, const V& c) {
+            if constexpr (std::floating_point<V>) {
+                out[i] = {c, s};
+            } else {
+                for (std::size_t k = 0UZ; k < V::size(); k++) {
+                    out[i + k] = {c[k], s[k]};
+                }
+            }
+        });
+    }
+
+    /// out[i] = sin(φ[i])
+    void sin(std::span<T> out) noexcept {
+        run(out.size(), [&out]<typename V>(std::size_t i, const V& s, const V& /*c*/) {
+            if constexpr (std::floating_point<V>) {
+                out[i] = s;
+            } else {
+                s.copy_to(&out[i], meta::stdx::element_aligned);
+            }
+        });
+    }
+
+    /// out[i] = cos(φ[i])
+    void cos(std::span<T> out) noexcept {
+        run(out.size(), [&out]<typename V>(std::size_t i, const V& /*s*/, const V& c) {
+            if constexpr (std::floating_point<V>) {
+                out[i] = c;
+            } else {
+                c.copy_to(&out[i], meta::stdx::element_aligned);
+            }
+        });
+    }
+
+    /**
+     * @brief complex mixer/rotator out[i] = in[i]·e^{j·φ[i]} (in-place operation is allowed)
+     */
+    void mix(std::span<const std::complex<T>> in, std::span<std::complex<T>> out) {
+        if (in.size() != out.size()) {
+            throw std::invalid_argument(fmt::format("input ({}) and output ({}) size mismatch", in.size(), out.size()));
+        }
+        std::array<std::complex<T>, kMixChunk> rotation;
+        for (std::size_t offset = 0UZ; offset < in.size(); offset += kMixChunk) {
+            const std::size_t n = std::min(kMixChunk, in.size() - offset);
+            generate(std::span(rotation).first(n));
+            for (std::size_t i = 0UZ; i < n; i++) { // N.B. explicit product avoids the NaN/Inf handling of std::complex::operator*
+                const auto [a, b] = std::array{in[offset + i].real(), in[offset + i].imag()};
+                const auto [c, d] = std::array{rotation[i].real(), rotation[i].imag()};
+                out[offset + i]   = {a * c - b * d, a * d + b * c};
+            }
+        }
+    }
+
+private:
+    [[nodiscard]] static Phase toPhase(double turns) {
+        if (!std::isfinite(turns)) {
+            throw std::invalid_argument(fmt::format("invalid NCO phase/frequency: {}", turns));
+        }
+        const double fraction = turns - std::floor(turns); // [0, 1]
+        const double scaled   = std::ldexp(fraction, static_cast<int>(kPhaseBits));
+        return scaled >= std::ldexp(1.0, static_cast<int>(kPhaseBits)) ? Phase{0} : static_cast<Phase>(scaled);
+    }
+
+    template<typename TStore>
+    void run(std::size_t n, TStore&& store) noexcept {
+        std::size_t i = 0UZ;
+        switch (mode) {
+        case NcoMode::Exact:
+            for (; i < n; i++, _phase += _phaseIncrement) {
+                T s, c;
+                sinCosExact(_phase, s, c);
+                store(i, s, c);
+            }
+            return;
+        case NcoMode::Table:
+            for (; i < n; i++, _phase += _phaseIncrement) {
+                T s, c;
+                sinCosTable(_phase, s, c);
+                store(i, s, c);
+            }
+            return;
+        case NcoMode::Polynomial: {
+            using V                 = meta::stdx::native_simd<T>;
+            constexpr std::size_t N = V::size();
+            using VF                = meta::stdx::fixed_size_simd<T, N>;
+            using VP                = meta::stdx::fixed_size_simd<Phase, N>;
+            if (n >= N) {
+                VP       phase([this](auto k) { return static_cast<Phase>(_phase + static_cast<Phase>(k) * _phaseIncrement); });
+                const VP step(static_cast<Phase>(static_cast<Phase>(N) * _phaseIncrement));
+                for (; i + N <= n; i += N, phase += step) {
+                    VF s, c;
+                    sinCosPolynomial(phase, s, c);
+                    store(i, s, c);
+                }
+                _phase += static_cast<Phase>(static_cast<Phase>(i) * _phaseIncrement);
+            }
+            for (; i < n; i++, _phase += _phaseIncrement) {
+                T s, c;
+                sinCosPolynomial(_phase, s, c);
+                store(i, s, c);
+            }
+            return;
+        }
+        }
+    }
+
+    static void sinCosExact(Phase phase, T& sinOut, T& cosOut) noexcept {
+        const double phi = static_cast<double>(static_cast<PhaseDiff>(phase)) * kPhaseScale * 2. * std::numbers::pi;
+        sinOut           = static_cast<T>(std::sin(phi));
+        cosOut           = static_cast<T>(std::cos(phi));
+    }
+
+    [[nodiscard]] static const std::vector<T>& sinTable() {
+        static const std::vector<T> table = [] {
+            std::vector<T> t(kTableSize + 1UZ); // +1: guard element for the interpolation
+            for (std::size_t i = 0UZ; i < t.size(); i++) {
+                t[i] = static_cast<T>(std::sin(2. * std::numbers::pi * static_cast<double>(i) / static_cast<double>(kTableSize)));
+            }
+            return t;
+        }();
+        return table;
+    }
+
+    static void sinCosTable(Phase phase, T& sinOut, T& cosOut) noexcept {
+        constexpr std::size_t kFracBits = kPhaseBits - kTableBits;
+        constexpr T           kFracNorm = T(1) / static_cast<T>(Phase{1} << kFracBits);
+        constexpr Phase       kQuarter  = Phase{1} << (kPhaseBits - 2UZ);
+        const auto&           table     = sinTable();
+        auto                  lookup    = [&table](Phase p) {
+            const auto index = static_cast<std::size_t>(p >> kFracBits);
+            const T    frac  = static_cast<T>(p & ((Phase{1} << kFracBits) - 1U)) * kFracNorm;
+            return table[index] + frac * (table[index + 1UZ] - table[index]);
+        };
+        sinOut = lookup(phase);
+        cosOut = lookup(static_cast<Phase>(phase + kQuarter)); // cos(φ) = sin(φ + π/2)
+    }
+
+    /// Taylor coefficients (-1)^k/(2k+1)! (sin) and (-1)^k/(2k)! (cos) -- truncation error < 1e-17 on [-π/4, π/4] for double
+    template<bool odd>
+    constexpr static auto kTaylor = [] {
+        constexpr std::size_t nTerms = std::is_same_v<T, float> ? 5UZ : 9UZ;
+        std::array<T, nTerms> coeffs{};
+        double                factorial = 1.;
+        std::size_t           power     = 0UZ;
+        for (std::size_t k = 0UZ; k < nTerms; k++) {
+            const std::size_t order = 2UZ * k + (odd ? 1UZ : 0UZ);
+            for (; power < order; power++) {
+                factorial *= static_cast<double>(power + 1UZ);
+            }
+            coeffs[k] = static_cast<T>((k % 2UZ == 0UZ ? 1. : -1.) / factorial);
+        }
+        return coeffs;
+    }();
+
+    template<typename V, typename VP>
+    static void sinCosPolynomial(const VP& phase, V& sinOut, V& cosOut) noexcept {
+        constexpr Phase kOctant = Phase{1} << (kPhaseBits - 3UZ);
+        // quadrant q = round(φ/(π/2)) and residual x = φ - q·π/2 in [-π/4, π/4) -- exact in fixed-point arithmetic
+        const VP q = (phase + kOctant) >> (kPhaseBits - 2UZ);
+        V        x;
+        V        quadrant;
+        if constexpr (std::floating_point<V>) {
+            x        = static_cast<T>(static_cast<PhaseDiff>(phase - (q << (kPhaseBits - 2UZ)))) * kPhaseToRad;
+            quadrant = static_cast<T>(q & 3U);
+        } else {
+            using VS = meta::stdx::fixed_size_simd<PhaseDiff, V::size()>;
+            x        = meta::stdx::static_simd_cast<V>(meta::stdx::static_simd_cast<VS>(phase - (q << (kPhaseBits - 2UZ)))) * kPhaseToRad;
+            quadrant = meta::stdx::static_simd_cast<V>(meta::stdx::static_simd_cast<VS>(q & 3U));
+        }
+
+        const V x2 = x * x;
+        V       s(kTaylor<true>.back());
+        V       c(kTaylor<false>.back());
+        for (std::size_t k = kTaylor<true>.size() - 1UZ; k-- > 0UZ;) {
+            s = s * x2 + kTaylor<true>[k];
+            c = c * x2 + kTaylor<false>[k];
+        }
+        s *= x;
+
+        // rotate by q·π/2: q=0: (s, c), q=1: (c, -s), q=2: (-s, -c), q=3: (-c, s)
+        if constexpr (std::floating_point<V>) {
+            const auto qi = static_cast<int>(quadrant);
+            sinOut        = (qi & 1) ? c : s;
+            cosOut        = (qi & 1) ? s : c;
+            sinOut        = (qi & 2) ? -sinOut : sinOut;
+            cosOut        = (qi == 1 || qi == 2) ? -cosOut : cosOut;
+        } else {
+            const auto swap                                     = quadrant == T(1) || quadrant == T(3);
+            sinOut                                              = s;
+            cosOut                                              = c;
+            where(swap, sinOut)                                 = c;
+            where(swap, cosOut)                                 = s;
+            where(quadrant >= T(2), sinOut)                     = -sinOut;
+            where(quadrant == T(1) || quadrant == T(2), cosOut) = -cosOut;
+        }
+    }
+};
+
+} // namespace gr::algorithm
+
+#endif // GNURADIO_ALGORITHM_NCO_HPP
@@ -2,13 +2,18 @@
 #define GNURADIO_FILTERTOOL_HPP
 
 #include <algorithm>
+#include <array>
+#include <cassert>
 #include <cmath>
 #include <complex>
 #include <execution>
 #include <iterator>
+#include <limits>
 #include <numbers>
 #include <numeric>
 #include <ranges>
+#include <span>
+#include <stdexcept>
 #include <unordered_set>
 #include <vector>
 
@@ -111,11 +116,20 @@ enum class Form {
 
 namespace detail {
 
+constexpr std::size_t kMaxRegisterOrder = 4UZ;   /// max. section order for which the bulk recursion state is kept in registers
+constexpr std::size_t kBulkStripSize    = 512UZ; /// samples processed per section before moving to the next (cache-blocking)
+
+template<typename T>
+using PaddedCoefficients = std::array<T, 2UZ * kMaxRegisterOrder + 1UZ>; // zero-padded beyond the section order
+template<typename T>
+using TransposedState = std::array<T, kMaxRegisterOrder>; // s[k] ≙ s_{k+1}
+
 template<typename T, std::size_t bufferSize = std::dynamic_extent, typename TBaseType = meta::fundamental_base_value_type_t<T>>
 struct Section;
 
 template<typename T, std::size_t bufferSize, Form form = std::is_floating_point_v<T> ? Form::DF_II : Form::DF_I, auto execPolicy = std::execution::unseq>
 [[nodiscard]] inline constexpr T computeFilter(const T& input, Section<T, bufferSize>& section) noexcept {
+    section.bulkStateValid    = false;
     const auto& a             = section.a;
     const auto& b             = section.b;
     auto&       inputHistory  = section.inputHistory;
@@ -188,6 +202,8 @@ struct Section : public FilterCoefficients<TBaseType> {
     HistoryBuffer<T, bufferSize> inputHistory{};
     HistoryBuffer<T, bufferSize> outputHistory{};
     std::vector<T>               autoCorrelation{}; // w.r.t. impulse response, computed for the combined feed-forward and -feedback filter length only
+    TransposedState<T>           bulkState{};       // TDF-II state of `computeFilterBulk(...)`, N.B. the histories remain the reference for per-sample processing
+    bool                         bulkStateValid = false;
 
     explicit Section(const FilterCoefficients<TBaseType>& section)
     requires(bufferSize == std::dynamic_extent)
@@ -206,9 +222,172 @@ struct Section : public FilterCoefficients<TBaseType> {
     inline constexpr void reset(T defaultValue = T()) {
         inputHistory.reset(defaultValue);
         outputHistory.reset(defaultValue);
+        bulkStateValid = false;
     }
 };
 
+/**
+ * @brief maps the direct-form II state w[n-1-l] (l = 0..order-1) onto the transposed direct-form II state s_{k+1} = Σ_l c[k][l]·w[n-1-l], with
+ *   c[k][l] = Σ_{j=0}^{k} (a[j]·b[l+k+1-j] - b[j]·a[l+k+1-j])
+ */
+template<typename T>
+[[nodiscard]] constexpr std::array<TransposedState<T>, kMaxRegisterOrder> directToTransposedMatrix(const PaddedCoefficients<T>& b, const PaddedCoefficients<T>& a, std::size_t order) noexcept {
+    std::array<TransposedState<T>, kMaxRegisterOrder> c{};
+    for (std::size_t k = 0UZ; k < order; ++k) {
+        for (std::size_t l = 0UZ; l < order; ++l) {
+            for (std::size_t j = 0UZ; j <= k; ++j) {
+                c[k][l] += a[j] * b[l + k + 1UZ - j] - b[j] * a[l + k + 1UZ - j];
+            }
+        }
+    }
+    return c;
+}
+
+/**
+ * @brief solves c·w = s (Gaussian elimination with partial pivoting) for the leading `order` x `order` block.
+ * Singular directions (e.g. pole-zero cancellations) are unobservable at the output and are set to zero.
+ */
+template<typename T>
+[[nodiscard]] constexpr TransposedState<T> solveDirectState(std::array<TransposedState<T>, kMaxRegisterOrder> c, TransposedState<T> s, std::size_t order) noexcept {
+    T scale = T(0);
+    for (std::size_t k = 0UZ; k < order; ++k) {
+        for (std::size_t l = 0UZ; l < order; ++l) {
+            scale = std::max(scale, std::abs(c[k][l]));
+        }
+    }
+    const T tolerance = scale * static_cast<T>(kMaxRegisterOrder) * std::numeric_limits<T>::epsilon();
+
+    std::array<std::size_t, kMaxRegisterOrder> pivotColumn{};
+    std::size_t                                rank = 0UZ;
+    for (std::size_t col = 0UZ; col < order && rank < order; ++col) {
+        std::size_t pivot = rank;
+        for (std::size_t row = rank + 1UZ; row < order; ++row) {
+            if (std::abs(c[row][col]) > std::abs(c[pivot][col])) {
+                pivot = row;
+            }
+        }
+        if (std::abs(c[pivot][col]) <= tolerance) {
+            continue;
+        }
+        std::swap(c[pivot], c[rank]);
+        std::swap(s[pivot], s[rank]);
+        for (std::size_t row = rank + 1UZ; row < order; ++row) {
+            const T factor = c[row][col] / c[rank][col];
+            for (std::size_t l = col; l < order; ++l) {
+                c[row][l] -= factor * c[rank][l];
+            }
+            s[row] -= factor * s[rank];
+        }
+        pivotColumn[rank++] = col;
+    }
+
+    TransposedState<T> w{};
+    for (std::size_t row = rank; row-- > 0UZ;) {
+        const std::size_t col = pivotColumn[row];
+        T                 sum = s[row];
+        for (std::size_t l = col + 1UZ; l < order; ++l) {
+            sum -= c[row][l] * w[l];
+        }
+        w[col] = sum / c[row][col];
+    }
+    return w;
+}
+
+/**
+ * @brief bulk version of `computeFilter(...)` for a single section, `input` and `output` may alias (in-place).
+ *
+ * For sections up to `kMaxRegisterOrder` the filter is iterated in transposed direct-form II (TDF-II), independent of `form`:
+ *   y[n] = b[0]·x[n] + s_1, s_k = b[k]·x[n] - a[k]·y[n] + s_{k+1}
+ * with the state s_k kept in registers. The state is derived from, and written back to, the section's history so that bulk
+ * and per-sample processing can be freely interleaved:
+ *  - DF_I, DF_II_TRANSPOSED: from the x/y histories, s_k = Σ_{j=k}^{N} (b[j]·x[n-1-(j-k)] - a[j]·y[n-1-(j-k)])
+ *  - DF_II, DF_I_TRANSPOSED: from the w-state history via `directToTransposedMatrix(...)`, and back via `solveDirectState(...)`
+ * Higher-order sections (e.g. long FIR sections) fall back to the per-sample implementation.
+ */
+template<typename T, std::size_t bufferSize, Form form = std::is_floating_point_v<T> ? Form::DF_II : Form::DF_I, auto execPolicy = std::execution::unseq>
+inline constexpr void computeFilterBulk(std::span<const T> input, std::span<T> output, Section<T, bufferSize>& section) noexcept {
+    const std::size_t order = std::max(section.a.size(), section.b.size()) - 1UZ;
+    if constexpr (!std::is_floating_point_v<T>) {
+        std::ranges::transform(input, output.begin(), [&section](const T& x) { return computeFilter<T, bufferSize, form, execPolicy>(x, section); });
+        return;
+    } else {
+        if (order > kMaxRegisterOrder) {
+            std::ranges::transform(input, output.begin(), [&section](const T& x) { return computeFilter<T, bufferSize, form, execPolicy>(x, section); });
+            return;
+        }
+        constexpr std::size_t N = kMaxRegisterOrder;
+
+        PaddedCoefficients<T> b{};
+        PaddedCoefficients<T> a{};
+        std::ranges::copy(section.b, b.begin());
+        std::ranges::copy(section.a, a.begin());
+        a[0] = T(1); // a[0] == 1 is implied, as in `computeFilter(...)`
+
+        constexpr bool kDirectState  = form == Form::DF_II || form == Form::DF_I_TRANSPOSED;
+        auto&          inputHistory  = section.inputHistory;
+        auto&          outputHistory = section.outputHistory;
+
+        TransposedState<T> s{};
+        if (section.bulkStateValid) { // N.B. avoids the (for narrow-band sections ill-conditioned) w-state round-trip between consecutive bulk calls
+            s = section.bulkState;
+        } else if constexpr (kDirectState) {
+            const auto&        directHistory = form == Form::DF_II ? inputHistory : outputHistory;
+            TransposedState<T> w{};
+            for (std::size_t l = 0UZ; l < std::min(order, directHistory.size()); ++l) {
+                w[l] = directHistory[l];
+            }
+            const auto c = directToTransposedMatrix(b, a, order);
+            for (std::size_t k = 0UZ; k < order; ++k) {
+                for (std::size_t l = 0UZ; l < order; ++l) {
+                    s[k] += c[k][l] * w[l];
+                }
+            }
+        } else {
+            const std::size_t nX = std::min(section.b.size() - 1UZ, inputHistory.size());
+            const std::size_t nY = std::min(section.a.size() - 1UZ, outputHistory.size());
+            for (std::size_t k = 0UZ; k < order; ++k) {
+                for (std::size_t j = k + 1UZ; j <= order; ++j) {
+                    const std::size_t lag = j - k - 1UZ;
+                    s[k] += (lag < nX ? b[j] * inputHistory[lag] : T(0)) - (lag < nY ? a[j] * outputHistory[lag] : T(0));
+                }
+            }
+        }
+
+        // keep the newest inputs before they are possibly overwritten by the in-place output
+        const std::size_t nTail = std::min(order, input.size());
+        std::array<T, N>  xTail{};
+        std::ranges::copy(input.last(nTail), xTail.begin());
+
+        for (std::size_t i = 0UZ; i < input.size(); ++i) {
+            const T x = input[i];
+            const T y = b[0] * x + s[0];
+            for (std::size_t k = 0UZ; k < N - 1UZ; ++k) {
+                s[k] = b[k + 1UZ] * x - a[k + 1UZ] * y + s[k + 1UZ];
+            }
+            s[N - 1UZ] = b[N] * x - a[N] * y;
+            output[i]  = y;
+        }
+
+        section.bulkState      = s;
+        section.bulkStateValid = true;
+        if constexpr (kDirectState) {
+            if (input.empty()) {
+                return;
+            }
+            auto&                    directHistory = form == Form::DF_II ? inputHistory : outputHistory;
+            const TransposedState<T> w             = solveDirectState(directToTransposedMatrix(b, a, order), s, order);
+            for (std::size_t l = order; l > 0UZ; --l) { // oldest first
+                directHistory.push_back(w[l - 1UZ]);
+            }
+        } else {
+            for (std::size_t k = 0UZ; k < nTail; ++k) {
+                inputHistory.push_back(xTail[k]);
+                outputHistory.push_back(output[input.size() - nTail + k]);
+            }
+        }
+    }
+}
+
 } // namespace detail
 
 /**
@@ -245,6 +424,94 @@ struct Filter<T, bufferSize, form, execPolicy> {
     [[nodiscard]] inline constexpr T processOne(T inputSample) noexcept {
         return std::accumulate(_sectionsMeanValue.begin(), _sectionsMeanValue.end(), inputSample, [](T acc, auto& section) { return detail::computeFilter<T, bufferSize, form, execPolicy>(acc, section); });
     }
+
+    /**
+     * @brief bulk equivalent of `processOne(...)` for each sample, `input` and `output` may alias (in-place).
+     *
+     * The cascade is evaluated section-by-section over cache-sized strips of the input, so that each section's
+     * recursion stays in registers (see `detail::computeFilterBulk`).
+     */
+    inline constexpr void process(std::span<const T> input, std::span<T> output) noexcept {
+        assert(output.size() >= input.size());
+        for (std::size_t offset = 0UZ; offset < input.size(); offset += detail::kBulkStripSize) {
+            const std::size_t  n           = std::min(detail::kBulkStripSize, input.size() - offset);
+            std::span<T>       stripOut    = output.subspan(offset, n);
+            std::span<const T> sectionData = input.subspan(offset, n);
+            for (auto& section : _sectionsMeanValue) {
+                detail::computeFilterBulk<T, bufferSize, form, execPolicy>(sectionData, stripOut, section);
+                sectionData = stripOut;
+            }
+        }
+    }
+};
+
+/**
+ * @brief: the same IIR/FIR filter (cascade of sections up to `detail::kMaxRegisterOrder`) applied to `nChannels` independent channels.
+ *
+ * Samples are interleaved by channel (frame-wise: [x_0[n], x_1[n], ..., x_{nChannels-1}[n], x_0[n+1], ...]) and the
+ * transposed direct-form II recursion is evaluated on `nChannels`-wide SIMD vectors, i.e. vectorised across channels
+ * rather than across the (inherently sequential) samples of a single channel.
+ *
+ * usage example:
+ * MultiChannelFilter<float, 4UZ> myFilter(filterSections);
+ * myFilter.process(interleavedInput, interleavedOutput);
+ */
+template<std::floating_point T, std::size_t nChannels>
+requires(nChannels > 0UZ)
+struct MultiChannelFilter {
+    using V                        = meta::stdx::fixed_size_simd<T, static_cast<int>(nChannels)>;
+    constexpr static std::size_t N = detail::kMaxRegisterOrder;
+
+    struct TransposedSection {
+        std::array<T, N + 1UZ> b{};
+        std::array<T, N + 1UZ> a{};
+        std::array<V, N>       s{};
+    };
+
+    std::vector<TransposedSection> _sections;
+
+    MultiChannelFilter() { _sections.push_back(TransposedSection{.b = {T(1)}}); }
+
+    template<typename... TFilterCoefficients>
+    explicit MultiChannelFilter(TFilterCoefficients&&... filterSections) {
+        std::vector<FilterCoefficients<T>> filterSections_{std::forward<TFilterCoefficients>(filterSections)...};
+        _sections.reserve(filterSections_.size());
+        for (const auto& section : filterSections_) {
+            if (std::max(section.a.size(), section.b.size()) > N + 1UZ || section.a.empty()) {
+                throw std::invalid_argument(fmt::format("MultiChannelFilter supports sections up to order {}, got a.size()={}, b.size()={}", N, section.a.size(), section.b.size()));
+            }
+            TransposedSection transposed;
+            std::ranges::copy(section.b, transposed.b.begin());
+            std::ranges::copy(section.a, transposed.a.begin());
+            _sections.push_back(transposed);
+        }
+    }
+
+    constexpr void reset() {
+        for (auto& section : _sections) {
+            section.s.fill(V(T(0)));
+        }
+    }
+
+    /**
+     * @param input interleaved samples, size must be a multiple of `nChannels`
+     * @param output interleaved samples, may alias `input`
+     */
+    void process(std::span<const T> input, std::span<T> output) noexcept {
+        assert(input.size() % nChannels == 0UZ && output.size() >= input.size());
+        for (std::size_t i = 0UZ; i < input.size(); i += nChannels) {
+            V x(&input[i], meta::stdx::element_aligned);
+            for (auto& [b, a, s] : _sections) {
+                const V y = b[0] * x + s[0];
+                for (std::size_t k = 0UZ; k < N - 1UZ; ++k) {
+                    s[k] = b[k + 1UZ] * x - a[k + 1UZ] * y + s[k + 1UZ];
+                }
+                s[N - 1UZ] = b[N] * x - a[N] * y;
+                x          = y;
+            }
+            x.copy_to(&output[i], meta::stdx::element_aligned);
+        }
+    }
 };
 
 /**
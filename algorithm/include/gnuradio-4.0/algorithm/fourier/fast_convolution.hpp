@@ -0,0 +1,218 @@
+#ifndef GNURADIO_ALGORITHM_FAST_CONVOLUTION_HPP
+#define GNURADIO_ALGORITHM_FAST_CONVOLUTION_HPP
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <execution>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "fft.hpp"
+
+namespace gr::algorithm {
+
+enum class ConvolutionMode {
+    Auto,   /// measure both implementations for the given taps and use the faster one
+    Direct, /// time-domain convolution, O(M) per sample
+    FFT     /// frequency-domain overlap-save convolution, O(log N) per sample
+};
+
+/**
+ * @brief Streaming FIR convolution y[n] = Σ_k b[k]·x[n-k] using either the direct form or FFT-based overlap-save.
+ *
+ * The input is collected in a linear buffer holding the (M-1) previous samples followed by up to L new samples
+ * (M: number of taps, N = L + M - 1: FFT size). The direct form filters sample-aligned. The FFT-based form accumulates
+ * the input across calls until a complete block of L samples is available and emits the filtered block during the
+ * following L input samples, i.e. with a fixed latency of `latency()` == L samples independent of the chunking:
+ *   out[n] = y[n - L] (0 for n < L), with y[n] -- within numerical rounding -- identical to `fir_filter`.
+ *
+ * The inverse transform re-uses the forward transform via IFFT(X) = conj(FFT(conj(X)))/N, so any
+ * `FourierAlgorithm<std::complex<T>, std::complex<T>>` (e.g. `FFT` or `FFTw`) can be used.
+ *
+ * Example:
+ * gr::algorithm::FastConvolution<float> conv;
+ * conv.setTaps(taps); // selects FFT size and, for ConvolutionMode::Auto, direct vs. FFT convolution
+ * conv.process(input, output);
+ */
+template<typename T, template<typename, typename> typename FourierAlgorithm = gr::algorithm::FFT>
+requires(std::floating_point<T> || gr::meta::complex_like<T>)
+struct FastConvolution {
+    using value_type = T;
+    using Precision  = meta::fundamental_base_value_type_t<T>;
+    using Complex    = std::complex<Precision>;
+
+    constexpr static std::size_t kMinFftTaps     = 16UZ;      /// below this, direct convolution is always used
+    constexpr static std::size_t kMaxFftSize     = 1UZ << 20; /// upper limit for the automatically chosen FFT size
+    constexpr static std::size_t kCalibrationRun = 4UZ;       /// number of blocks timed per implementation
+
+    ConvolutionMode mode{ConvolutionMode::Auto};
+
+private:
+    FourierAlgorithm<Complex, Complex> _fft{};
+    std::vector<T>                     _taps{};         // b[0] ... b[M-1]
+    std::vector<T>                     _reversedTaps{}; // b[M-1] ... b[0] -> y[i] = Σ_j rb[j]·buf[i + j]
+    std::vector<Complex>               _tapsSpectrum{}; // FFT of zero-padded taps
+    std::vector<T>                     _buffer{};       // [ (M-1) history | L new samples ]
+    std::vector<Complex>               _timeDomain{};
+    std::vector<Complex>               _frequencyDomain{};
+    std::size_t                        _fftSize{0UZ};
+    std::size_t                        _blockSize{0UZ}; // L: new samples per FFT block
+    std::size_t                        _nFilled{0UZ};   // new samples collected in '_buffer' (FFT form), also the read position in '_output'
+    std::vector<T>                     _output{};       // filtered previous block, emitted while the current block is being filled
+    bool                               _useFft{false};
+
+public:
+    FastConvolution() { setTaps(std::vector<T>{T{1}}); }
+
+    FastConvolution(const FastConvolution&)            = delete;
+    FastConvolution(FastConvolution&&)                 = delete;
+    FastConvolution& operator=(const FastConvolution&) = delete;
+    FastConvolution& operator=(FastConvolution&&)      = delete;
+
+    [[nodiscard]] constexpr std::size_t fftSize() const noexcept { return _fftSize; }
+    [[nodiscard]] constexpr std::size_t blockSize() const noexcept { return _blockSize; }
+    [[nodiscard]] constexpr bool        usesFft() const noexcept { return _useFft; }
+    [[nodiscard]] constexpr std::size_t nTaps() const noexcept { return _taps.size(); }
+    [[nodiscard]] constexpr std::size_t latency() const noexcept { return _useFft ? _blockSize : 0UZ; }
+
+    /**
+     * @brief FFT size N minimising the estimated cost per output sample N·(2·log2(N) + 1)/(N - M + 1) of overlap-save.
+     */
+    [[nodiscard]] static std::size_t optimalFftSize(std::size_t nTaps) noexcept {
+        std::size_t bestSize = std::bit_ceil(2UZ * std::max(nTaps, 1UZ));
+        double      bestCost = std::numeric_limits<double>::max();
+        for (std::size_t n = bestSize; n <= kMaxFftSize; n *= 2UZ) {
+            const auto   nd   = static_cast<double>(n);
+            const double cost = nd * (2. * std::log2(nd) + 1.) / static_cast<double>(n - nTaps + 1UZ);
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestSize = n;
+            }
+        }
+        return bestSize;
+    }
+
+    /**
+     * @param taps feed-forward coefficients b[0] (newest sample) ... b[M-1], identical to `fir_filter::b`
+     * @param fftSize power-of-two FFT size N > M, or 0 to choose it automatically from the number of taps
+     */
+    void setTaps(std::span<const T> taps, std::size_t fftSize = 0UZ) {
+        if (taps.empty()) {
+            throw std::invalid_argument("taps must not be empty");
+        }
+        _taps.assign(taps.begin(), taps.end());
+        _reversedTaps.assign(taps.rbegin(), taps.rend());
+        const std::size_t nTaps = _taps.size();
+
+        _fftSize = fftSize == 0UZ ? optimalFftSize(nTaps) : fftSize;
+        if (!std::has_single_bit(_fftSize) || _fftSize <= nTaps) {
+            throw std::invalid_argument(fmt::format("FFT size {} must be a power of two and larger than the number of taps {}", _fftSize, nTaps));
+        }
+        _blockSize = _fftSize - nTaps + 1UZ;
+
+        _timeDomain.assign(_fftSize, Complex{});
+        std::ranges::transform(_taps, _timeDomain.begin(), [](const T& tap) { return static_cast<Complex>(tap); });
+        _tapsSpectrum.resize(_fftSize);
+        _fft.compute(_timeDomain, _tapsSpectrum);
+        // fold the 1/N normalisation of the inverse transform into the filter spectrum
+        const auto norm = Precision(1) / static_cast<Precision>(_fftSize);
+        std::ranges::transform(_tapsSpectrum, _tapsSpectrum.begin(), [norm](const Complex& c) { return c * norm; });
+        _frequencyDomain.resize(_fftSize);
+
+        _buffer.resize(_fftSize);
+        _output.resize(_blockSize);
+        switch (mode) {
+        case ConvolutionMode::Direct: _useFft = false; break;
+        case ConvolutionMode::FFT: _useFft = true; break;
+        case ConvolutionMode::Auto: _useFft = nTaps >= kMinFftTaps && isFftFaster(); break;
+        }
+        reset();
+    }
+
+    void reset() {
+        std::ranges::fill(_buffer, T{});
+        std::ranges::fill(_output, T{});
+        _nFilled = 0UZ;
+    }
+
+    /**
+     * @brief filters `in` into `out` (in.size() == out.size()), keeping the required history across calls
+     * N.B. the FFT-based form delays the output by `latency()` samples (see class description)
+     */
+    void process(std::span<const T> in, std::span<T> out) {
+        if (in.size() != out.size()) {
+            throw std::invalid_argument(fmt::format("input ({}) and output ({}) size mismatch", in.size(), out.size()));
+        }
+        const std::size_t nHistory = _taps.size() - 1UZ;
+        while (!in.empty()) {
+            const std::size_t n = std::min(in.size(), _blockSize - _nFilled);
+            std::ranges::copy(in.first(n), std::next(_buffer.begin(), static_cast<std::ptrdiff_t>(nHistory + _nFilled)));
+            if (_useFft) {
+                std::copy_n(std::next(_output.cbegin(), static_cast<std::ptrdiff_t>(_nFilled)), n, out.begin());
+                _nFilled += n;
+                if (_nFilled == _blockSize) {
+                    convolveFft(_output);
+                    retainHistory(_blockSize);
+                    _nFilled = 0UZ;
+                }
+            } else {
+                convolveDirect(out.first(n));
+                retainHistory(n);
+            }
+            in  = in.subspan(n);
+            out = out.subspan(n);
+        }
+    }
+
+private:
+    void retainHistory(std::size_t nNew) noexcept { // retain the last (M-1) samples as history for the next block (dst < src -> forward copy is safe)
+        std::copy_n(std::next(_buffer.begin(), static_cast<std::ptrdiff_t>(nNew)), _taps.size() - 1UZ, _buffer.begin());
+    }
+
+    void convolveDirect(std::span<T> out) const noexcept {
+        for (std::size_t i = 0UZ; i < out.size(); ++i) {
+            out[i] = std::transform_reduce(std::execution::unseq, _reversedTaps.cbegin(), _reversedTaps.cend(), std::next(_buffer.cbegin(), static_cast<std::ptrdiff_t>(i)), T{0}, std::plus<>{}, std::multiplies<>{});
+        }
+    }
+
+    void convolveFft(std::span<T> out) {
+        std::ranges::transform(_buffer, _timeDomain.begin(), [](const T& x) { return static_cast<Complex>(x); });
+        _fft.compute(_timeDomain, _frequencyDomain);
+        // conj(X·H) so that the forward transform of the result yields the (conjugated) inverse transform
+        std::ranges::transform(_frequencyDomain, _tapsSpectrum, _timeDomain.begin(), [](const Complex& x, const Complex& h) { return std::conj(x * h); });
+        _fft.compute(_timeDomain, _frequencyDomain);
+
+        // overlap-save: the first (M-1) samples are corrupted by circular wrap-around and are discarded
+        const auto valid = std::next(_frequencyDomain.cbegin(), static_cast<std::ptrdiff_t>(_taps.size() - 1UZ));
+        if constexpr (gr::meta::complex_like<T>) {
+            std::transform(valid, _frequencyDomain.cend(), out.begin(), [](const Complex& y) { return static_cast<T>(std::conj(y)); });
+        } else {
+            std::transform(valid, _frequencyDomain.cend(), out.begin(), [](const Complex& y) { return y.real(); });
+        }
+    }
+
+    [[nodiscard]] bool isFftFaster() {
+        std::vector<T> scratch(_blockSize);
+        auto           timeIt = [&scratch](auto&& convolve) {
+            convolve(std::span(scratch)); // warm-up (caches, lazy plan initialisation)
+            const auto start = std::chrono::steady_clock::now();
+            for (std::size_t i = 0UZ; i < kCalibrationRun; ++i) {
+                convolve(std::span(scratch));
+            }
+            return std::chrono::steady_clock::now() - start;
+        };
+        const auto tDirect = timeIt([this](std::span<T> out) { convolveDirect(out); });
+        const auto tFft    = timeIt([this](std::span<T> out) { convolveFft(out); });
+        return tFft < tDirect;
+    }
+};
+
+} // namespace gr::algorithm
+
+#endif // GNURADIO_ALGORITHM_FAST_CONVOLUTION_HPP
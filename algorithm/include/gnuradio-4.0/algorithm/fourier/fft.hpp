@@ -25,7 +25,7 @@ struct FFT {
 
     void initAll() { precomputeTwiddleFactors(); }
 
-    auto compute(const std::ranges::input_range auto& in, std::ranges::output_range<TOutput> auto&& out) {
+    decltype(auto) compute(const std::ranges::input_range auto& in, std::ranges::output_range<TOutput> auto&& out) {
         if constexpr (requires(std::size_t n) { out.resize(n); }) {
             if (out.size() != in.size()) {
                 out.resize(in.size());
@@ -74,7 +74,7 @@ struct FFT {
             }
         }
 
-        return out;
+        return std::forward<decltype(out)>(out); // N.B. reference to 'out' avoids copying the spectrum
     }
 
     auto compute(const std::ranges::input_range auto& in) { return compute(in, std::vector<TOutput>(in.size())); }
@@ -2,13 +2,21 @@
 #define GNURADIO_ALGORITHM_FFT_COMMON_HPP
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cmath>
+#include <cstdint>
+#include <complex>
+#include <limits>
 #include <numbers>
+#include <span>
 #include <vector>
 
 #include <fmt/format.h>
 #include <ranges>
 
+#include <gnuradio-4.0/meta/utils.hpp>
+
 namespace gr::algorithm::fft {
 
 struct ConfigMagnitude {
@@ -109,5 +117,261 @@ auto computePhaseSpectrum(const TContainerIn& fftIn, ConfigPhase config) {
     return computePhaseSpectrum(fftIn, {}, config);
 }
 
+/**
+ * @brief applies the (real-valued) window function to the input: out[i] = static_cast<TOut>(in[i]) * window[i]
+ *
+ * Converts the input precision in the same pass. Real and complex (interleaved re/im) data of matching precision are
+ * processed using SIMD. `out` may alias `in`.
+ */
+template<typename TIn, typename TOut, std::floating_point T>
+requires(std::is_same_v<TOut, T> || std::is_same_v<TOut, std::complex<T>>)
+void applyWindow(std::span<const TIn> in, std::span<const T> window, std::span<TOut> out) {
+    using V                  = meta::stdx::native_simd<T>;
+    constexpr std::size_t kW = V::size();
+    const std::size_t     n  = std::min({in.size(), window.size(), out.size()});
+
+    if constexpr (std::is_same_v<TIn, T> && std::is_same_v<TOut, T>) {
+        std::size_t i = 0UZ;
+        for (; i + kW <= n; i += kW) {
+            const V x(&in[i], meta::stdx::element_aligned);
+            const V w(&window[i], meta::stdx::element_aligned);
+            (x * w).copy_to(&out[i], meta::stdx::element_aligned);
+        }
+        for (; i < n; ++i) {
+            out[i] = in[i] * window[i];
+        }
+    } else if constexpr (std::is_same_v<TIn, std::complex<T>> && std::is_same_v<TOut, std::complex<T>>) {
+        // std::complex<T> is guaranteed to be layout-compatible with T[2] -> process as 2n interleaved re/im values
+        const T*          inReal  = reinterpret_cast<const T*>(in.data());
+        T*                outReal = reinterpret_cast<T*>(out.data());
+        const std::size_t nReal   = 2UZ * n;
+        std::size_t       i       = 0UZ;
+        for (; i + kW <= nReal; i += kW) {
+            const V x(&inReal[i], meta::stdx::element_aligned);
+            const V w([&window, i](auto j) { return window[(i + j) / 2UZ]; });
+            (x * w).copy_to(&outReal[i], meta::stdx::element_aligned);
+        }
+        for (; i < nReal; ++i) {
+            outReal[i] = inReal[i] * window[i / 2UZ];
+        }
+    } else {
+        for (std::size_t i = 0UZ; i < n; ++i) {
+            out[i] = static_cast<TOut>(in[i]) * window[i];
+        }
+    }
+}
+
+namespace detail {
+/**
+ * @brief SIMD atan2(y, x) using the Cephes rational approximation of atan(t) for t in [0, 1] (max. error ~1 ulp)
+ *
+ * N.B. the `std::experimental::simd` math functions are evaluated lane-by-lane (and for some ABIs considerably slower than
+ * their scalar counterparts), which would otherwise dominate the spectrum post-processing.
+ */
+template<meta::any_simd V>
+[[nodiscard]] inline V atan2(const V& y, const V& x) noexcept {
+    using T         = typename V::value_type;
+    constexpr T kPi = std::numbers::pi_v<T>;
+
+    const V    ax   = meta::stdx::abs(x);
+    const V    ay   = meta::stdx::abs(y);
+    const auto swap = ay > ax;
+    const V    den  = meta::stdx::max(ax, ay);
+    V          t    = meta::stdx::min(ax, ay) / den; // t in [0, 1]
+
+    where(den == T(0), t) = T(0);
+
+    const auto reduce = t > T(0.66); // atan(t) = π/4 + atan((t - 1)/(t + 1))
+    V          r(T(0));
+    where(reduce, r) = kPi / T(4);
+    where(reduce, t) = (t - T(1)) / (t + T(1));
+
+    const V z = t * t;
+    const V p = (((T(-8.750608600031904122785E-1) * z + T(-1.615753718733365076637E1)) * z + T(-7.500855792314704667340E1)) * z + T(-1.228866684490136173410E2)) * z + T(-6.485021904942025371773E1);
+    const V q = ((((z + T(2.485846490142306297962E1)) * z + T(1.650270098316988542046E2)) * z + T(4.328810604912902668951E2)) * z + T(4.853903996359136964868E2)) * z + T(1.945506571482613964425E2);
+    r += t * z * p / q + t;
+
+    where(swap, r)     = kPi / T(2) - r;
+    where(x < T(0), r) = kPi - r;
+    return meta::stdx::copysign(r, y);
+}
+
+/**
+ * @brief SIMD log10(x) for finite x > 0: x = m·2^e with m in [√½, √2) and ln(m) = 2·atanh(s) = 2·Σ s^(2k+1)/(2k+1), s = (m - 1)/(m + 1)
+ */
+template<meta::any_simd V>
+[[nodiscard]] inline V log10(const V& x) noexcept {
+    using T                             = typename V::value_type;
+    using TBits                         = std::conditional_t<std::is_same_v<T, float>, std::uint32_t, std::uint64_t>;
+    constexpr int         kMantissaBits = std::numeric_limits<T>::digits - 1;
+    constexpr TBits       kExponentMask = (TBits(1) << (sizeof(T) * 8UZ - 1UZ)) - (TBits(1) << kMantissaBits);
+    constexpr int         kBias         = std::numeric_limits<T>::max_exponent - 1;
+    constexpr std::size_t kNTerms       = std::is_same_v<T, float> ? 5UZ : 11UZ; // |s| < 0.172 -> |s|^(2·kNTerms + 1) < ε
+    constexpr T           kSqrtHalf     = std::numbers::sqrt2_v<T> / T(2);
+
+    // split into mantissa in [1, 2) and exponent using bit operations (N.B. calling 'std::frexp' would stall on AVX<->SSE transitions)
+    alignas(meta::stdx::memory_alignment_v<V>) std::array<T, V::size()> mantissa;
+    alignas(meta::stdx::memory_alignment_v<V>) std::array<T, V::size()> exponent;
+    for (std::size_t j = 0UZ; j < V::size(); ++j) {
+        T   value  = x[j];
+        int offset = 0;
+        if (value < std::numeric_limits<T>::min()) { // sub-normal
+            value *= static_cast<T>(TBits(1) << kMantissaBits);
+            offset = kMantissaBits;
+        }
+        const auto bits = std::bit_cast<TBits>(value);
+        mantissa[j]     = std::bit_cast<T>((bits & ~kExponentMask) | (static_cast<TBits>(kBias) << kMantissaBits));
+        exponent[j]     = static_cast<T>(static_cast<int>((bits & kExponentMask) >> kMantissaBits) - kBias - offset);
+    }
+    V m(mantissa.data(), meta::stdx::vector_aligned);
+    V e(exponent.data(), meta::stdx::vector_aligned);
+
+    const auto large = m > T(2) * kSqrtHalf; // -> m in [√½, √2)
+    where(large, m) *= T(0.5);
+    where(large, e) += T(1);
+
+    const V s  = (m - T(1)) / (m + T(1));
+    const V s2 = s * s;
+    V       series(T(1) / static_cast<T>(2UZ * kNTerms - 1UZ));
+    for (std::size_t k = kNTerms - 1UZ; k > 0UZ; --k) {
+        series = series * s2 + T(1) / static_cast<T>(2UZ * k - 1UZ);
+    }
+    return (T(2) * s * series + e * std::numbers::ln2_v<T>) * std::numbers::log10e_v<T>;
+}
+} // namespace detail
+
+struct ConfigSpectrum {
+    bool outputInDb  = false;
+    bool outputInDeg = false;
+    bool unwrapPhase = false;
+};
+
+template<std::floating_point T>
+struct ValueRange {
+    T min = std::numeric_limits<T>::max();
+    T max = std::numeric_limits<T>::lowest();
+};
+
+template<std::floating_point T>
+struct SpectrumRanges {
+    ValueRange<T> real;
+    ValueRange<T> imag;
+    ValueRange<T> magnitude;
+    ValueRange<T> phase;
+};
+
+/**
+ * @brief fused spectrum post-processing: splits the FFT output into real and imaginary part and computes the magnitude
+ * (optionally in dB), the phase (optionally unwrapped and/or in degrees) as well as the min/max ranges of all four
+ * quantities in a single SIMD pass over the spectrum.
+ *
+ * The number of computed bins is given by `magOut.size()` (all output spans must have the same size <= `fftIn.size()`).
+ * The results are identical to `computeMagnitudeSpectrum(..)` and `computePhaseSpectrum(..)` within numerical rounding.
+ */
+template<std::floating_point T>
+SpectrumRanges<T> computeSpectrum(std::span<const std::complex<T>> fftIn, std::span<T> realOut, std::span<T> imagOut, std::span<T> magOut, std::span<T> phaseOut, ConfigSpectrum config = {}) {
+    const std::size_t n = magOut.size();
+    if (fftIn.empty() || n > fftIn.size() || realOut.size() != n || imagOut.size() != n || phaseOut.size() != n) {
+        throw std::invalid_argument(fmt::format("invalid spectrum sizes: fftIn {} vs. re {}, im {}, mag {}, phase {}", fftIn.size(), realOut.size(), imagOut.size(), n, phaseOut.size()));
+    }
+
+    using V                   = meta::stdx::native_simd<T>;
+    constexpr std::size_t kW  = V::size();
+    constexpr T           kPi = std::numbers::pi_v<T>;
+    const T               norm{T(2) / static_cast<T>(fftIn.size())};
+    const T               toDeg{config.outputInDeg ? T(180) * std::numbers::inv_pi_v<T> : T(1)};
+    const T*              data = reinterpret_cast<const T*>(fftIn.data()); // interleaved re/im
+
+    auto unwrap = [prev = T(0), first = true](T current) mutable { // N.B. same algorithm as 'unwrapPhase(..)'
+        if (first) {
+            first = false;
+        } else {
+            T diff = current - prev;
+            while (diff > kPi) {
+                current -= 2 * kPi;
+                diff = current - prev;
+            }
+            while (diff < -kPi) {
+                current += 2 * kPi;
+                diff = current - prev;
+            }
+        }
+        prev = current;
+        return current;
+    };
+
+    SpectrumRanges<T> ranges;
+    std::array<V, 4>  vMin;
+    std::array<V, 4>  vMax;
+    vMin.fill(V(std::numeric_limits<T>::max()));
+    vMax.fill(V(std::numeric_limits<T>::lowest()));
+
+    std::size_t i = 0UZ;
+    for (; i + kW <= n; i += kW) {
+        const V re([data, i](auto j) { return data[2UZ * (i + j)]; });
+        const V im([data, i](auto j) { return data[2UZ * (i + j) + 1UZ]; });
+        V       mag = meta::stdx::sqrt(re * re + im * im) * norm;
+        if (config.outputInDb) {
+            const auto isZero  = mag <= T(0);
+            mag                = T(20) * detail::log10(mag);
+            where(isZero, mag) = std::numeric_limits<T>::lowest(); // avoids log of zero
+        }
+        V phase = detail::atan2(im, re);
+        if (config.unwrapPhase) { // inherently sequential, but the values are still in the L1 cache
+            phase.copy_to(&phaseOut[i], meta::stdx::element_aligned);
+            for (std::size_t j = i; j < i + kW; ++j) {
+                phaseOut[j] = unwrap(phaseOut[j]);
+            }
+            phase.copy_from(&phaseOut[i], meta::stdx::element_aligned);
+        }
+        phase *= toDeg;
+
+        re.copy_to(&realOut[i], meta::stdx::element_aligned);
+        im.copy_to(&imagOut[i], meta::stdx::element_aligned);
+        mag.copy_to(&magOut[i], meta::stdx::element_aligned);
+        phase.copy_to(&phaseOut[i], meta::stdx::element_aligned);
+
+        std::size_t k = 0UZ;
+        for (const V& value : {re, im, mag, phase}) {
+            vMin[k] = meta::stdx::min(vMin[k], value);
+            vMax[k] = meta::stdx::max(vMax[k], value);
+            ++k;
+        }
+    }
+
+    std::array<ValueRange<T>*, 4> scalarRanges{&ranges.real, &ranges.imag, &ranges.magnitude, &ranges.phase};
+    for (std::size_t k = 0UZ; k < scalarRanges.size(); ++k) {
+        scalarRanges[k]->min = meta::stdx::hmin(vMin[k]);
+        scalarRanges[k]->max = meta::stdx::hmax(vMax[k]);
+    }
+
+    for (; i < n; ++i) { // remainder
+        const T re  = data[2UZ * i];
+        const T im  = data[2UZ * i + 1UZ];
+        T       mag = std::sqrt(re * re + im * im) * norm;
+        if (config.outputInDb) {
+            mag = mag > T(0) ? T(20) * std::log10(mag) : std::numeric_limits<T>::lowest();
+        }
+        T phase = std::atan2(im, re);
+        if (config.unwrapPhase) {
+            phase = unwrap(phase);
+        }
+        phase *= toDeg;
+
+        realOut[i]  = re;
+        imagOut[i]  = im;
+        magOut[i]   = mag;
+        phaseOut[i] = phase;
+
+        std::size_t k = 0UZ;
+        for (const T value : {re, im, mag, phase}) {
+            scalarRanges[k]->min = std::min(scalarRanges[k]->min, value);
+            scalarRanges[k]->max = std::max(scalarRanges[k]->max, value);
+            ++k;
+        }
+    }
+    return ranges;
+}
+
 } // namespace gr::algorithm::fft
 #endif // GNURADIO_ALGORITHM_FFT_COMMON_HPP
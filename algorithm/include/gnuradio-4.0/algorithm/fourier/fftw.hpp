@@ -1,7 +1,13 @@
 #ifndef GNURADIO_ALGORITHM_FFTW_HPP
 #define GNURADIO_ALGORITHM_FFTW_HPP
 
+#include <compare>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
 
 #include <fftw3.h>
 
@@ -10,6 +16,12 @@
 namespace gr::algorithm {
 
 namespace detail {
+/// the FFTW planner (incl. plan destruction and wisdom handling) is not thread-safe -> one mutex shared by all precisions and instances
+inline std::mutex& fftwPlannerMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
 template<typename TData>
 struct FFTwImplTypes {
     using PlanType        = fftwf_plan;
@@ -54,24 +66,135 @@ struct FFTwImplFreeOut<TData> {
 template<typename TData>
 struct FFTwImplDestroyPlan {
     using PlanType = FFTwImplTypes<TData>::PlanType;
-    void operator()(PlanType ptr) { fftwf_destroy_plan(ptr); }
+    void operator()(PlanType ptr) {
+        if (ptr != nullptr) {
+            std::lock_guard lg{fftwPlannerMutex()};
+            fftwf_destroy_plan(ptr);
+        }
+    }
 };
 
 template<typename TData>
 requires(std::is_same_v<TData, std::complex<double>> || std::is_same_v<TData, double>)
 struct FFTwImplDestroyPlan<TData> {
     using PlanType = FFTwImplTypes<TData>::PlanType;
-    void operator()(PlanType ptr) { fftw_destroy_plan(ptr); }
+    void operator()(PlanType ptr) {
+        if (ptr != nullptr) {
+            std::lock_guard lg{fftwPlannerMutex()};
+            fftw_destroy_plan(ptr);
+        }
+    }
 };
 } // namespace detail
 
-template<typename TInput, typename TOutput = std::conditional<gr::meta::complex_like<TInput>, TInput, std::complex<typename TInput::value_type>>>
-requires((gr::meta::complex_like<TInput> || std::floating_point<TInput>) && (gr::meta::complex_like<TOutput>))
-struct FFTw {
+/**
+ * @brief process-wide cache of FFTW plans shared between all `FFTw` instances
+ *
+ * Plans are keyed by (size, precision, real/complex input, direction, planner flags, input/output memory alignment) and
+ * executed through FFTW's thread-safe new-array interface (`fftw_execute_dft(plan, in, out)`), so that hundreds of blocks
+ * with the same transform plan it only once. This also makes `FFTW_MEASURE` and `FFTW_PATIENT` affordable.
+ *
+ * The wisdom path is provided by the requesting `FFTw` instance (`FFTw::wisdomPath`): wisdom is imported from it before
+ * the first plan is created with that path and exported to it after each new plan, using `wisdomPath` for double and
+ * `wisdomPath + 'f'` for single precision (FFTW convention). An empty path disables the wisdom persistence. N.B. a cache
+ * hit does not touch the wisdom files, the wisdom has been persisted by the instance that created the plan.
+ *
+ * Planning (potentially seconds for `FFTW_MEASURE`/`FFTW_PATIENT`) is done outside the cache lock, so that look-ups of
+ * other transforms are not blocked. If two instances concurrently miss on the same key, the first inserted plan is kept.
+ */
+class FFTwPlanCache {
+public:
+    struct Key {
+        std::size_t  size{0UZ};
+        bool         doublePrecision{true};
+        bool         realInput{false};
+        int          sign{FFTW_FORWARD};
+        unsigned int flags{FFTW_ESTIMATE};
+        int          inputAlignment{0};  // fftw_alignment_of(..) of the input buffer
+        int          outputAlignment{0}; // fftw_alignment_of(..) of the output buffer
+
+        auto operator<=>(const Key&) const = default;
+    };
+
 private:
-    inline static std::mutex fftw_plan_mutex;
+    mutable std::mutex                   _cacheMutex;
+    std::map<Key, std::shared_ptr<void>> _plans;
+    std::size_t                          _nPlansCreated{0UZ};
+    std::set<std::string>                _importedWisdomFiles; // N.B. guarded by the planner mutex
+
+    FFTwPlanCache() { static_cast<void>(detail::fftwPlannerMutex()); } // ensures the mutex outlives the cached plans at exit
 
 public:
+    [[nodiscard]] static FFTwPlanCache& instance() {
+        static FFTwPlanCache cache;
+        return cache;
+    }
+
+    /// number of plans currently held by the cache
+    [[nodiscard]] std::size_t size() const {
+        std::lock_guard lg{_cacheMutex};
+        return _plans.size();
+    }
+
+    /// total number of plans created by the cache (i.e. cache misses)
+    [[nodiscard]] std::size_t nPlansCreated() const {
+        std::lock_guard lg{_cacheMutex};
+        return _nPlansCreated;
+    }
+
+    /// releases the cache's references, plans still in use by `FFTw` instances remain valid
+    void clear() {
+        std::map<Key, std::shared_ptr<void>> plans;
+        {
+            std::lock_guard lg{_cacheMutex};
+            std::swap(plans, _plans);
+        }
+        // plans are destroyed outside the lock (the deleter acquires the planner mutex)
+    }
+
+    template<typename TImpl>
+    [[nodiscard]] std::shared_ptr<std::remove_pointer_t<typename TImpl::PlanType>> getOrCreate(const Key& key, typename TImpl::InAlgoDataType* in, typename TImpl::OutAlgoDataType* out, const std::string& wisdomPath) {
+        using Plan = std::remove_pointer_t<typename TImpl::PlanType>;
+        {
+            std::lock_guard lg{_cacheMutex};
+            if (auto it = _plans.find(key); it != _plans.end()) {
+                return std::static_pointer_cast<Plan>(it->second);
+            }
+        }
+
+        typename TImpl::PlanType rawPlan = nullptr;
+        {
+            std::lock_guard   plannerLock{detail::fftwPlannerMutex()};
+            const std::string path = key.doublePrecision ? wisdomPath : wisdomPath + 'f';
+            if (!wisdomPath.empty() && _importedWisdomFiles.insert(path).second) {
+                std::ignore = TImpl::importWisdomFromFilename(path); // missing file on first use is OK
+            }
+            rawPlan = TImpl::plan(static_cast<int>(key.size), in, out, key.sign, key.flags);
+            if (rawPlan != nullptr && !wisdomPath.empty()) {
+                std::ignore = TImpl::exportWisdomToFilename(path);
+            }
+        }
+        if (rawPlan == nullptr) {
+            throw std::runtime_error(fmt::format("FFTW failed to create plan for size {}", key.size));
+        }
+        auto plan = std::shared_ptr<Plan>(rawPlan, typename TImpl::PlanDeleter{});
+
+        std::shared_ptr<Plan> cachedPlan;
+        {
+            std::lock_guard lg{_cacheMutex};
+            auto [it, inserted] = _plans.try_emplace(key, plan);
+            if (inserted) {
+                _nPlansCreated++;
+            }
+            cachedPlan = std::static_pointer_cast<Plan>(it->second);
+        }
+        return cachedPlan; // N.B. a concurrently created duplicate 'plan' is destroyed outside the cache lock
+    }
+};
+
+template<typename TInput, typename TOutput = std::conditional<gr::meta::complex_like<TInput>, TInput, std::complex<typename TInput::value_type>>>
+requires((gr::meta::complex_like<TInput> || std::floating_point<TInput>) && (gr::meta::complex_like<TOutput>))
+struct FFTw {
     // clang-format off
     template<typename TData>
     struct FFTwImpl {
@@ -81,9 +204,18 @@ public:
         using OutAlgoDataType = Types::OutAlgoDataType;
         using InUniquePtr     = std::unique_ptr<InAlgoDataType [], detail::FFTwImplFreeIn<TData>>;
         using OutUniquePtr    = std::unique_ptr<OutAlgoDataType [], detail::FFTwImplFreeOut<TData>>;
-        using PlanUniquePtr   = std::unique_ptr<std::remove_pointer_t<PlanType>, detail::FFTwImplDestroyPlan<TData>>;
+        using PlanDeleter     = detail::FFTwImplDestroyPlan<TData>;
+        using PlanSharedPtr   = std::shared_ptr<std::remove_pointer_t<PlanType>>;
 
-        static void execute(const PlanType p) { fftwf_execute(p); }
+        static void execute(const PlanType p, InAlgoDataType *p_in, OutAlgoDataType *p_out) {
+            if constexpr (std::is_same_v<InAlgoDataType, float>) {
+                fftwf_execute_dft_r2c(p, p_in, p_out);
+            } else {
+                fftwf_execute_dft(p, p_in, p_out);
+            }
+        }
+        static int alignmentOf(InAlgoDataType *p) { return fftwf_alignment_of(reinterpret_cast<float*>(p)); }
+        static int alignmentOf(OutAlgoDataType *p) requires (!std::is_same_v<InAlgoDataType, OutAlgoDataType>) { return fftwf_alignment_of(reinterpret_cast<float*>(p)); }
         static void cleanup() { fftwf_cleanup(); }
         static void * malloc(std::size_t n) { return fftwf_malloc(n);}
         static PlanType plan(int p_n, InAlgoDataType *p_in, OutAlgoDataType *p_out, int p_sign, unsigned int p_flags) {
@@ -115,9 +247,18 @@ public:
         using OutAlgoDataType = Types::OutAlgoDataType;
         using InUniquePtr     = std::unique_ptr<InAlgoDataType [], detail::FFTwImplFreeIn<TData>>;
         using OutUniquePtr    = std::unique_ptr<OutAlgoDataType [], detail::FFTwImplFreeOut<TData>>;
-        using PlanUniquePtr   = std::unique_ptr<std::remove_pointer_t<PlanType>, detail::FFTwImplDestroyPlan<TData>>;
+        using PlanDeleter     = detail::FFTwImplDestroyPlan<TData>;
+        using PlanSharedPtr   = std::shared_ptr<std::remove_pointer_t<PlanType>>;
 
-        static void execute(const PlanType p) { fftw_execute(p); }
+        static void execute(const PlanType p, InAlgoDataType *p_in, OutAlgoDataType *p_out) {
+            if constexpr (std::is_same_v<InAlgoDataType, double>) {
+                fftw_execute_dft_r2c(p, p_in, p_out);
+            } else {
+                fftw_execute_dft(p, p_in, p_out);
+            }
+        }
+        static int alignmentOf(InAlgoDataType *p) { return fftw_alignment_of(reinterpret_cast<double*>(p)); }
+        static int alignmentOf(OutAlgoDataType *p) requires (!std::is_same_v<InAlgoDataType, OutAlgoDataType>) { return fftw_alignment_of(reinterpret_cast<double*>(p)); }
         static void cleanup() { fftw_cleanup(); }
         static void * malloc(std::size_t n) { return fftw_malloc(n);}
         static PlanType plan(int p_n, InAlgoDataType *p_in, OutAlgoDataType *p_out, int p_sign, unsigned int p_flags) {
@@ -147,15 +288,16 @@ public:
     using OutAlgoDataType = typename FFTwImpl<AlgoDataType>::OutAlgoDataType;
     using InUniquePtr     = typename FFTwImpl<AlgoDataType>::InUniquePtr;
     using OutUniquePtr    = typename FFTwImpl<AlgoDataType>::OutUniquePtr;
-    using PlanUniquePtr   = typename FFTwImpl<AlgoDataType>::PlanUniquePtr;
+    using PlanSharedPtr   = typename FFTwImpl<AlgoDataType>::PlanSharedPtr;
 
     std::size_t   fftSize{0};
-    std::string   wisdomPath{".gr_fftw_wisdom"};
+    std::string   wisdomPath{".gr_fftw_wisdom"}; // also forwarded to 'FFTwPlanCache' if 'usePlanCache == true'
     int           sign{FFTW_FORWARD};
     unsigned int  flags{FFTW_ESTIMATE}; // FFTW_EXHAUSTIVE, FFTW_MEASURE, FFTW_ESTIMATE
+    bool          usePlanCache{true};   // share plans with other instances via the process-wide 'FFTwPlanCache'
     InUniquePtr   fftwIn{};
     OutUniquePtr  fftwOut{};
-    PlanUniquePtr fftwPlan{};
+    PlanSharedPtr fftwPlan{};
 
     FFTw()                               = default;
     FFTw(const FFTw& rhs)                = delete;
@@ -165,7 +307,7 @@ public:
 
     ~FFTw() { clearFftw(); }
 
-    auto compute(const std::ranges::input_range auto& in, std::ranges::output_range<TOutput> auto&& out) {
+    decltype(auto) compute(const std::ranges::input_range auto& in, std::ranges::output_range<TOutput> auto&& out) {
         if constexpr (requires(std::size_t n) { out.resize(n); }) {
             if (out.size() != in.size()) {
                 out.resize(in.size());
@@ -195,7 +337,7 @@ public:
             std::memcpy(fftwIn.get(), &(*in.begin()), sizeof(InAlgoDataType) * fftSize);
         }
 
-        FFTwImpl<AlgoDataType>::execute(fftwPlan.get());
+        FFTwImpl<AlgoDataType>::execute(fftwPlan.get(), fftwIn.get(), fftwOut.get()); // new-array execute: thread-safe for shared plans
 
         static_assert(sizeof(TOutput) == sizeof(OutAlgoDataType), "Sizes of TOutput type and OutAlgoDataType are not equal.");
 #pragma GCC diagnostic push
@@ -212,7 +354,7 @@ public:
             std::reverse(halfIt, out.end());
         }
 
-        return out;
+        return std::forward<decltype(out)>(out); // N.B. reference to 'out' avoids copying the spectrum
     }
 
     auto compute(const std::ranges::input_range auto& in) { return compute(in, std::vector<TOutput>()); }
@@ -247,20 +389,22 @@ private:
         fftwIn  = InUniquePtr(static_cast<InAlgoDataType*>(FFTwImpl<AlgoDataType>::malloc(sizeof(InAlgoDataType) * fftSize)));
         fftwOut = OutUniquePtr(static_cast<OutAlgoDataType*>(FFTwImpl<AlgoDataType>::malloc(sizeof(OutAlgoDataType) * getOutputSize())));
 
-        {
-            std::lock_guard lg{fftw_plan_mutex};
-            // what to do if error is returned
-            std::ignore = importWisdom();
-            fftwPlan    = PlanUniquePtr(FFTwImpl<AlgoDataType>::plan(static_cast<int>(fftSize), fftwIn.get(), fftwOut.get(), sign, flags));
-            std::ignore = exportWisdom();
+        if (usePlanCache) {
+            const FFTwPlanCache::Key key{.size = fftSize, .doublePrecision = std::is_same_v<typename TOutput::value_type, double>, .realInput = !gr::meta::complex_like<TInput>, .sign = sign, .flags = flags, //
+                .inputAlignment = FFTwImpl<AlgoDataType>::alignmentOf(fftwIn.get()), .outputAlignment = FFTwImpl<AlgoDataType>::alignmentOf(fftwOut.get())};
+            fftwPlan = FFTwPlanCache::instance().getOrCreate<FFTwImpl<AlgoDataType>>(key, fftwIn.get(), fftwOut.get(), wisdomPath);
+            return;
         }
+
+        std::lock_guard lg{detail::fftwPlannerMutex()};
+        // what to do if error is returned
+        std::ignore = importWisdom();
+        fftwPlan    = PlanSharedPtr(FFTwImpl<AlgoDataType>::plan(static_cast<int>(fftSize), fftwIn.get(), fftwOut.get(), sign, flags), typename FFTwImpl<AlgoDataType>::PlanDeleter{});
+        std::ignore = exportWisdom();
     }
 
     void clearFftw() {
-        {
-            std::lock_guard lg{fftw_plan_mutex};
-            fftwPlan.reset();
-        }
+        fftwPlan.reset(); // N.B. plan deleter acquires the planner mutex
         fftwIn.reset();
         fftwOut.reset();
     }
@@ -273,6 +273,85 @@ const boost::ut::suite<"IIR FilterTool"> iirFilterToolTests = [] {
     } | std::tuple{Filter<double, 32UZ, Form::DF_I>(), Filter<double, 32UZ, Form::DF_II>(), Filter<double, 32UZ, Form::DF_I_TRANSPOSED>(), Filter<double, 32UZ, Form::DF_II_TRANSPOSED>()};
     ;
 
+    "IIR bulk vs. sample-by-sample processing"_test = []<typename FilterType>(FilterType) {
+        using namespace gr::filter::iir;
+        constexpr double fs              = 1000.;
+        const auto       digitalBandPass = iir::designFilter<double>(Type::BANDPASS, {.order = 4UZ, .fLow = 4., .fHigh = 6., .fs = fs}, Design::BUTTERWORTH);
+        const auto       biquadSections  = iir::designFilter<double>(Type::LOWPASS, {.order = 6UZ, .fLow = 50., .fs = fs}, Design::CHEBYSHEV1);
+
+        std::vector<double> input(3'000UZ);
+        for (std::size_t i = 0UZ; i < input.size(); ++i) {
+            input[i] = std::sin(2. * std::numbers::pi * 5. / fs * static_cast<double>(i)) + ((i % 7UZ) == 0UZ ? 0.5 : 0.0);
+        }
+
+        for (const auto& sections : {digitalBandPass, biquadSections}) {
+            auto reference = FilterType(sections);
+            auto bulk      = FilterType(sections);
+
+            auto mixed     = FilterType(sections);
+
+            std::vector<double> expected(input.size());
+            std::ranges::transform(input, expected.begin(), [&reference](double x) { return reference.processOne(x); });
+
+            // irregular chunks, optionally interleaved with single-sample calls to verify that the filter states remain compatible
+            const auto process = [&input](FilterType& filter, bool interleaved) {
+                std::vector<double> actual(input.size());
+                std::size_t         offset = 0UZ;
+                for (std::size_t chunk = 1UZ; offset < input.size(); chunk = (3UZ * chunk + 1UZ) % 1'021UZ) {
+                    const std::size_t n = std::min(chunk, input.size() - offset);
+                    filter.process(std::span(input).subspan(offset, n), std::span(actual).subspan(offset, n));
+                    offset += n;
+                    if (interleaved && offset < input.size()) {
+                        actual[offset] = filter.processOne(input[offset]);
+                        offset++;
+                    }
+                }
+                return actual;
+            };
+
+            // N.B. the w-state (DF_II, DF_I_TRANSPOSED) <-> TDF-II state conversion is ill-conditioned for narrow-band sections
+            constexpr bool   kWState         = std::is_same_v<FilterType, Filter<double, 32UZ, Form::DF_II>> || std::is_same_v<FilterType, Filter<double, 32UZ, Form::DF_I_TRANSPOSED>>;
+            constexpr double kMixedTolerance = kWState ? 1e-5 : 1e-6;
+
+            const std::vector<double> actualBulk  = process(bulk, false);
+            const std::vector<double> actualMixed = process(mixed, true);
+            for (std::size_t i = 0UZ; i < input.size(); ++i) {
+                expect(approx(actualBulk[i], expected[i], 1e-6)) << fmt::format("sample {}: bulk {} vs. processOne {}", i, actualBulk[i], expected[i]);
+                expect(approx(actualMixed[i], expected[i], kMixedTolerance)) << fmt::format("sample {}: mixed {} vs. processOne {}", i, actualMixed[i], expected[i]);
+            }
+        }
+    } | std::tuple{Filter<double, 32UZ, Form::DF_I>(), Filter<double, 32UZ, Form::DF_II>(), Filter<double, 32UZ, Form::DF_I_TRANSPOSED>(), Filter<double, 32UZ, Form::DF_II_TRANSPOSED>()};
+
+    "multi-channel IIR filter"_test = [] {
+        using namespace gr::filter::iir;
+        constexpr double      fs        = 1000.;
+        constexpr std::size_t nChannels = 3UZ;
+        constexpr std::size_t nSamples  = 1'000UZ;
+        const auto            lowPass   = iir::designFilter<double>(Type::LOWPASS, {.order = 4UZ, .fLow = 20., .fs = fs}, Design::BUTTERWORTH);
+
+        MultiChannelFilter<double, nChannels>      multiChannel(lowPass);
+        std::array<Filter<double>, nChannels>      reference{Filter<double>(lowPass), Filter<double>(lowPass), Filter<double>(lowPass)};
+        std::vector<double>                        interleaved(nChannels * nSamples);
+        std::array<std::vector<double>, nChannels> expected;
+        for (std::size_t ch = 0UZ; ch < nChannels; ++ch) {
+            expected[ch].resize(nSamples);
+            for (std::size_t i = 0UZ; i < nSamples; ++i) {
+                const double x                  = std::cos(2. * std::numbers::pi * (5. + 10. * static_cast<double>(ch)) / fs * static_cast<double>(i)) + static_cast<double>(ch);
+                interleaved[i * nChannels + ch] = x;
+                expected[ch][i]                 = reference[ch].processOne(x);
+            }
+        }
+
+        multiChannel.process(interleaved, interleaved); // in-place
+        for (std::size_t ch = 0UZ; ch < nChannels; ++ch) {
+            for (std::size_t i = 0UZ; i < nSamples; ++i) {
+                expect(approx(interleaved[i * nChannels + ch], expected[ch][i], 1e-9)) << fmt::format("channel {} sample {}", ch, i);
+            }
+        }
+
+        expect(throws<std::invalid_argument>([] { std::ignore = MultiChannelFilter<double, 2UZ>(FilterCoefficients<double>{.b = {1., 0., 0., 0., 0., 0.}, .a = {1.}}); })) << "section order exceeds register limit";
+    };
+
     tag("visual") / "basic analog low-/high-/band-pass filter - frequency"_test = []() {
         using namespace gr::graphs;
         using T                 = float;
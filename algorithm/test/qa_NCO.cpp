@@ -0,0 +1,93 @@
+#include <boost/ut.hpp>
+
+#include <algorithm>
+#include <array>
+#include <complex>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <vector>
+
+#include <fmt/format.h>
+#include <magic_enum.hpp>
+
+#include <gnuradio-4.0/algorithm/NCO.hpp>
+
+const boost::ut::suite<"numerically-controlled oscillator"> ncoTests = [] {
+    using namespace boost::ut;
+    using namespace boost::ut::reflection;
+    using gr::algorithm::NCO;
+    using gr::algorithm::NcoMode;
+
+    constexpr auto kModes = std::array{NcoMode::Exact, NcoMode::Table, NcoMode::Polynomial};
+
+    "frequency and phase setters"_test = []<typename T>() {
+        NCO<T> nco(-0.25, 0.5);
+        expect(approx(nco.frequency(), -0.25, 1e-9));
+        expect(approx(nco.phase(), 0.5, 1e-8));
+        nco.setFrequency(1.25); // aliases to 0.25
+        expect(approx(nco.frequency(), 0.25, 1e-9));
+        nco.setPhase(-3. * std::numbers::pi); // wraps to [-π, π)
+        expect(approx(nco.phase(), -std::numbers::pi, 1e-8));
+        expect(throws<std::invalid_argument>([&nco] { nco.setFrequency(std::numeric_limits<double>::quiet_NaN()); }));
+    } | std::tuple<float, double>{};
+
+    "accuracy vs. std::sin/std::cos"_test = [&kModes]<typename T>() {
+        constexpr double frequency = 0.0123; // cycles/sample
+        constexpr double phase0    = 0.3;
+        constexpr double tolerance = std::is_same_v<T, float> ? 2e-5 : 1e-6; // float: includes 2^-32 frequency quantisation over 4k samples
+
+        for (const NcoMode mode : kModes) {
+            NCO<T>                       nco(frequency, phase0, mode);
+            std::vector<std::complex<T>> out(4099UZ); // N.B. not a multiple of the SIMD width
+            nco.generate(out);
+            double maxError = 0.;
+            for (std::size_t i = 0UZ; i < out.size(); i++) {
+                const double phi = phase0 + 2. * std::numbers::pi * frequency * static_cast<double>(i);
+                maxError         = std::max({maxError, std::abs(static_cast<double>(out[i].real()) - std::cos(phi)), std::abs(static_cast<double>(out[i].imag()) - std::sin(phi))});
+            }
+            expect(lt(maxError, tolerance)) << fmt::format("<{}> mode {}: max error {}", type_name<T>(), magic_enum::enum_name(mode), maxError);
+        }
+    } | std::tuple<float, double>{};
+
+    "bulk vs. sample-by-sample generation"_test = [&kModes]<typename T>() {
+        for (const NcoMode mode : kModes) {
+            NCO<T> reference(0.1, 0.2, mode);
+            NCO<T> sinNco(0.1, 0.2, mode);
+            NCO<T> cosNco(0.1, 0.2, mode);
+
+            std::vector<T> sin(1000UZ);
+            std::vector<T> cos(1000UZ);
+            for (std::size_t offset = 0UZ, chunk = 1UZ; offset < sin.size(); offset += chunk, chunk = chunk * 2UZ + 1UZ) { // irregular chunks
+                const std::size_t n = std::min(chunk, sin.size() - offset);
+                sinNco.sin(std::span(sin).subspan(offset, n));
+                cosNco.cos(std::span(cos).subspan(offset, n));
+            }
+
+            bool equal = true;
+            for (std::size_t i = 0UZ; i < sin.size(); i++) {
+                const std::complex<T> expected = reference.next();
+                equal                          = equal && std::abs(expected.imag() - sin[i]) < T(1e-6) && std::abs(expected.real() - cos[i]) < T(1e-6);
+            }
+            expect(equal) << fmt::format("<{}> mode {}", type_name<T>(), magic_enum::enum_name(mode));
+            expect(approx(sinNco.phase(), reference.phase(), 1e-6)) << "phase continuity";
+        }
+    } | std::tuple<float, double>{};
+
+    "mixer/rotator"_test = []<typename T>() {
+        constexpr double             frequency = -0.05;
+        NCO<T>                       nco(frequency);
+        std::vector<std::complex<T>> signal(1000UZ);
+        for (std::size_t i = 0UZ; i < signal.size(); i++) { // tone at +0.05 cycles/sample -> shifted to DC
+            signal[i] = std::polar(T(2), static_cast<T>(2. * std::numbers::pi * 0.05 * static_cast<double>(i)));
+        }
+        nco.mix(signal, signal); // in-place
+        for (const auto& sample : signal) {
+            expect(approx(sample.real(), T(2), T(1e-4)));
+            expect(approx(sample.imag(), T(0), T(1e-4)));
+        }
+        expect(throws<std::invalid_argument>([&nco, &signal] { nco.mix(signal, std::span(signal).first(10UZ)); }));
+    } | std::tuple<float, double>{};
+};
+
+int main() { /* not needed for UT */ }
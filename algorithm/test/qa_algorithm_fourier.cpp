@@ -1,7 +1,9 @@
 #include <array>
 #include <cassert>
+#include <filesystem>
 #include <numbers>
 #include <numeric>
+#include <thread>
 
 #include <boost/ut.hpp>
 
@@ -160,6 +162,81 @@ const boost::ut::suite<"FFT algorithms and window functions"> windowTests = [] {
         expect(equalVectors(phase, expOut)) << "unwrapped phases are equal";
     };
 
+    "fused spectrum kernel tests"_test = []<typename T>() {
+        using namespace gr::algorithm::fft;
+        constexpr std::size_t N{1024};
+        constexpr std::size_t nBins{N / 2 + 3}; // not a multiple of the SIMD width -> also covers the scalar remainder
+
+        std::vector<std::complex<T>> spectrum(N);
+        for (std::size_t i = 0; i < N; i++) {
+            const auto x = static_cast<T>(i);
+            spectrum[i]  = {std::sin(x * T(0.37)) * x, std::cos(x * T(0.11)) * T(50)};
+        }
+        spectrum[5] = {0, 0}; // zero magnitude -> lowest() in dB
+
+        for (const bool outputInDb : {false, true}) {
+            for (const bool outputInDeg : {false, true}) {
+                for (const bool unwrap : {false, true}) {
+                    std::vector<T> re(nBins);
+                    std::vector<T> im(nBins);
+                    std::vector<T> mag(nBins);
+                    std::vector<T> phase(nBins);
+                    const auto     ranges = computeSpectrum(std::span<const std::complex<T>>(spectrum), std::span(re), std::span(im), std::span(mag), std::span(phase), ConfigSpectrum{.outputInDb = outputInDb, .outputInDeg = outputInDeg, .unwrapPhase = unwrap});
+
+                    auto expMag = computeMagnitudeSpectrum(spectrum, ConfigMagnitude{.outputInDb = outputInDb});
+                    expMag.resize(nBins);
+                    const auto expPhase = computePhaseSpectrum(std::vector(spectrum.begin(), std::next(spectrum.begin(), nBins)), ConfigPhase{.outputInDeg = outputInDeg, .unwrapPhase = unwrap});
+
+                    const std::string config = fmt::format("<{}> dB:{} deg:{} unwrap:{}", type_name<T>(), outputInDb, outputInDeg, unwrap);
+                    expect(equalVectors(mag, expMag, 1e-3)) << fmt::format("{} equal magnitude", config);
+                    expect(equalVectors(phase, expPhase, 1e-3)) << fmt::format("{} equal phase", config);
+                    expect(std::ranges::equal(re, std::views::take(spectrum, nBins) | std::views::transform([](const auto& c) { return c.real(); }))) << fmt::format("{} equal real", config);
+                    expect(std::ranges::equal(im, std::views::take(spectrum, nBins) | std::views::transform([](const auto& c) { return c.imag(); }))) << fmt::format("{} equal imag", config);
+
+                    expect(eq(ranges.real.min, std::ranges::min(re)) && eq(ranges.real.max, std::ranges::max(re))) << fmt::format("{} real range", config);
+                    expect(eq(ranges.imag.min, std::ranges::min(im)) && eq(ranges.imag.max, std::ranges::max(im))) << fmt::format("{} imag range", config);
+                    expect(eq(ranges.magnitude.min, std::ranges::min(mag)) && eq(ranges.magnitude.max, std::ranges::max(mag))) << fmt::format("{} magnitude range", config);
+                    expect(eq(ranges.phase.min, std::ranges::min(phase)) && eq(ranges.phase.max, std::ranges::max(phase))) << fmt::format("{} phase range", config);
+                }
+            }
+        }
+
+        expect(throws<std::invalid_argument>([&spectrum] {
+            std::vector<T> tooShort(2);
+            std::vector<T> bins(4);
+            std::ignore = computeSpectrum(std::span<const std::complex<T>>(spectrum), std::span(tooShort), std::span(bins), std::span(bins), std::span(bins));
+        })) << "output size mismatch";
+    } | std::tuple<float, double>{};
+
+    "window kernel tests"_test = []<typename T>() {
+        using namespace gr::algorithm::fft;
+        constexpr std::size_t N{67}; // not a multiple of the SIMD width
+        const auto            window = gr::algorithm::window::create<T>(gr::algorithm::window::Type::Hann, N);
+
+        std::vector<T>               real(N);
+        std::vector<std::complex<T>> cplx(N);
+        std::vector<double>          otherPrecision(N);
+        for (std::size_t i = 0; i < N; i++) {
+            real[i]           = static_cast<T>(i) + T(1);
+            cplx[i]           = {real[i], -real[i]};
+            otherPrecision[i] = static_cast<double>(i) + 1.;
+        }
+
+        std::vector<T>               realOut(N);
+        std::vector<std::complex<T>> cplxOut(N);
+        applyWindow(std::span<const T>(real), std::span<const T>(window), std::span(realOut));
+        applyWindow(std::span<const std::complex<T>>(cplx), std::span<const T>(window), std::span(cplxOut));
+        for (std::size_t i = 0; i < N; i++) {
+            expect(approx(realOut[i], real[i] * window[i], T(1e-5))) << fmt::format("<{}> real sample {}", type_name<T>(), i);
+            expect(approx(cplxOut[i].real(), cplx[i].real() * window[i], T(1e-5)) && approx(cplxOut[i].imag(), cplx[i].imag() * window[i], T(1e-5))) << fmt::format("<{}> complex sample {}", type_name<T>(), i);
+        }
+
+        applyWindow(std::span<const double>(otherPrecision), std::span<const T>(window), std::span(realOut));
+        for (std::size_t i = 0; i < N; i++) {
+            expect(approx(realOut[i], real[i] * window[i], T(1e-5))) << fmt::format("<{}> converted sample {}", type_name<T>(), i);
+        }
+    } | std::tuple<float, double>{};
+
     "FFTw types tests"_test = [] {
         testFFTwTypes<std::complex<float>, std::complex<float>, fftwf_complex, fftwf_complex, fftwf_plan>();
         testFFTwTypes<std::complex<double>, std::complex<double>, fftw_complex, fftw_complex, fftw_plan>();
@@ -180,6 +257,75 @@ const boost::ut::suite<"FFT algorithms and window functions"> windowTests = [] {
         // expect(eq(wisdomString1, wisdomString2)) << "Wisdom strings are the same.";
     };
 
+    "FFTW plan cache tests"_test = []<typename T>() {
+        using namespace gr::algorithm;
+        const auto wisdomPath = std::filesystem::temp_directory_path() / fmt::format("qa_gr_fftw_wisdom_{}", type_name<T>());
+        std::filesystem::remove(wisdomPath);
+        std::filesystem::remove(wisdomPath.string() + 'f');
+        FFTwPlanCache& cache = FFTwPlanCache::instance();
+        cache.clear();
+
+        const auto signal       = generateSinSample<std::complex<T>>(1024, 128., 10., 1.);
+        auto       equalSpectra = [](const auto& lhs, const auto& rhs) { return lhs.size() == rhs.size() && std::ranges::equal(lhs, rhs, [](const auto& l, const auto& r) { return std::abs(l - r) < T(1e-3); }); };
+
+        FFTw<std::complex<T>, std::complex<T>> fftw1;
+        FFTw<std::complex<T>, std::complex<T>> fftw2;
+        FFTw<std::complex<T>, std::complex<T>> fftwUncached;
+        fftw1.wisdomPath          = wisdomPath.string(); // forwarded to the plan cache
+        fftw2.wisdomPath          = wisdomPath.string();
+        fftwUncached.usePlanCache = false;
+        fftwUncached.wisdomPath   = "";
+
+        const std::size_t nCreated = cache.nPlansCreated();
+        const auto        result1  = fftw1.compute(signal);
+        const auto        result2  = fftw2.compute(signal);
+        expect(eq(cache.size(), 1UZ)) << fmt::format("<{}> one shared plan", type_name<T>());
+        expect(eq(cache.nPlansCreated(), nCreated + 1UZ)) << fmt::format("<{}> second instance re-uses the cached plan", type_name<T>());
+        expect(fftw1.fftwPlan.get() == fftw2.fftwPlan.get()) << fmt::format("<{}> same plan", type_name<T>());
+        expect(equalSpectra(result1, result2)) << fmt::format("<{}> shared plan results", type_name<T>());
+        expect(equalSpectra(result1, fftwUncached.compute(signal))) << fmt::format("<{}> cached vs. uncached results", type_name<T>());
+        expect(fftwUncached.fftwPlan.get() != fftw1.fftwPlan.get()) << fmt::format("<{}> uncached instance owns its plan", type_name<T>());
+
+        std::ignore = fftw2.compute(generateSinSample<std::complex<T>>(512, 128., 10., 1.));
+        expect(eq(cache.size(), 2UZ)) << fmt::format("<{}> new plan for different size", type_name<T>());
+        expect(fftw1.fftwPlan.get() != fftw2.fftwPlan.get()) << fmt::format("<{}> different plans", type_name<T>());
+
+        FFTw<T, std::complex<T>> fftwReal;
+        fftwReal.wisdomPath = wisdomPath.string();
+        std::ignore = fftwReal.compute(generateSinSample<T>(1024, 128., 10., 1.));
+        expect(eq(cache.size(), 3UZ)) << fmt::format("<{}> real-valued input uses a separate plan", type_name<T>());
+
+        const bool isDouble = std::is_same_v<T, double>;
+        expect(std::filesystem::exists(isDouble ? wisdomPath.string() : wisdomPath.string() + 'f')) << fmt::format("<{}> instance wisdom path honoured by the cache: {}", type_name<T>(), wisdomPath.string());
+
+        cache.clear();
+        expect(eq(cache.size(), 0UZ));
+        expect(equalSpectra(result1, fftw1.compute(signal))) << fmt::format("<{}> plan remains valid after clearing the cache", type_name<T>());
+
+        std::filesystem::remove(wisdomPath);
+        std::filesystem::remove(wisdomPath.string() + 'f');
+    } | std::tuple<float, double>{};
+
+    "FFTW plan cache concurrent misses"_test = [] {
+        using namespace gr::algorithm;
+        FFTwPlanCache& cache = FFTwPlanCache::instance();
+        cache.clear();
+        constexpr std::size_t                                                nThreads = 8UZ;
+        std::array<FFTw<std::complex<float>, std::complex<float>>, nThreads> instances;
+        std::vector<std::thread>                                             threads;
+        const auto                                                           signal   = generateSinSample<std::complex<float>>(2048, 128., 10., 1.);
+        const std::size_t                                                    nCreated = cache.nPlansCreated();
+        for (auto& fftw : instances) {
+            fftw.wisdomPath = ""; // no wisdom persistence
+            threads.emplace_back([&fftw, &signal] { std::ignore = fftw.compute(signal); });
+        }
+        std::ranges::for_each(threads, [](auto& thread) { thread.join(); });
+        expect(eq(cache.size(), 1UZ)) << "concurrently created duplicates are discarded";
+        expect(eq(cache.nPlansCreated(), nCreated + 1UZ));
+        expect(std::ranges::all_of(instances, [&instances](const auto& fftw) { return fftw.fftwPlan.get() == instances[0].fftwPlan.get(); })) << "all instances share the first inserted plan";
+        cache.clear();
+    };
+
     "window pre-computed array tests"_test = []<typename T>() { // this tests regression w.r.t. changed implementations
         // Expected value for size 8
         std::array RectangularRef{1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f};
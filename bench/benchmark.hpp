@@ -2,12 +2,19 @@
 #define GNURADIO_BENCHMARK_HPP
 
 #include <algorithm>
+#include <array>
+#include <cctype>
 #include <charconv>
 #include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
 #include <map>
 #include <mutex>
 #include <numeric>
+#include <optional>
 #include <ranges>
 #include <string>
 #include <string_view>
@@ -816,6 +823,262 @@ public:
 
 [[nodiscard]] auto operator""_benchmark(const char* name, std::size_t size) { return ::benchmark::benchmark<1LU>{{name, size}}; }
 
+/**
+ * machine-readable results and regression checks, controlled via environment variables and evaluated after all benchmarks ran:
+ *  - BM_OUTPUT_FILE=<file>[.json|.csv]  writes all results as JSON (default) or CSV (one 'name,metric,value,unit' row per metric)
+ *  - BM_BASELINE=<file>.json            compares the results against a baseline previously written via 'BM_OUTPUT_FILE'
+ *  - BM_REGRESSION_THRESHOLD=<percent>  tolerated relative deterioration of 'mean' and 'ops/s' (default: 10%) -- exceeding it
+ *                                       for any benchmark contained in the baseline makes the executable return a failure
+ * e.g. 'BM_OUTPUT_FILE=baseline.json ./bm_GraphThroughput' for the reference and 'BM_BASELINE=baseline.json ./bm_GraphThroughput' for the candidate version.
+ */
+namespace io {
+using Data     = std::vector<std::pair<std::string, ResultMap>>;
+using Metrics  = std::map<std::string, long double, std::less<>>;
+using Baseline = std::map<std::string, Metrics, std::less<>>;
+
+enum class Direction { LowerIsBetter, HigherIsBetter };
+
+struct RegressionMetric {
+    std::string_view key;
+    Direction        direction;
+};
+
+inline constexpr std::array<RegressionMetric, 2> kRegressionMetrics{{{"mean", Direction::LowerIsBetter}, {"ops/s", Direction::HigherIsBetter}}};
+inline constexpr double                          kDefaultRegressionThreshold = 10.0; // [%]
+
+/// invokes 'fn(key, value, unit)' for all numeric metrics of a result, perf sub-metrics are split into '<key>.misses', '<key>.total', and '<key>.ratio'
+template<typename Fn>
+inline void forEachMetric(const ResultMap& resultMap, Fn&& fn) {
+    for (const auto& [key, entry] : resultMap) {
+        const auto& [value, unit, _] = entry;
+        if (const auto* real = std::get_if<long double>(&value)) {
+            fn(key, *real, unit);
+        } else if (const auto* integer = std::get_if<uint64_t>(&value)) {
+            fn(key, static_cast<long double>(*integer), unit);
+        } else if (const auto* stat = std::get_if<perf_sub_metric>(&value)) {
+            fn(key + ".misses", static_cast<long double>(stat->misses), unit);
+            fn(key + ".total", static_cast<long double>(stat->total), unit);
+            fn(key + ".ratio", static_cast<long double>(stat->ratio), std::string{});
+        }
+    }
+}
+
+[[nodiscard]] inline Metrics flatten(const ResultMap& resultMap) {
+    Metrics metrics;
+    forEachMetric(resultMap, [&metrics](const std::string& key, long double value, const std::string& /*unit*/) { metrics.insert_or_assign(key, value); });
+    return metrics;
+}
+
+[[nodiscard]] inline std::string jsonEscape(std::string_view str) {
+    std::string result;
+    for (const char c : str) {
+        if (c == '"' || c == '\\') {
+            result.push_back('\\');
+        }
+        result.push_back(c);
+    }
+    return result;
+}
+
+[[nodiscard]] inline std::string csvEscape(std::string_view str) {
+    std::string result;
+    for (const char c : str) {
+        if (c == '"') {
+            result.push_back('"');
+        }
+        result.push_back(c);
+    }
+    return result;
+}
+
+inline void writeJson(std::ostream& out, const Data& data) {
+    out << "[";
+    bool first = true;
+    for (const auto& [name, resultMap] : data) {
+        if (name.empty()) {
+            continue; // separator
+        }
+        out << (first ? "\n" : ",\n") << fmt::format("  {{\"name\": \"{}\"", jsonEscape(name));
+        for (const auto& [key, value] : flatten(resultMap)) {
+            out << fmt::format(", \"{}\": {}", jsonEscape(key), std::isfinite(value) ? fmt::format("{:.9g}", value) : "null");
+        }
+        out << "}";
+        first = false;
+    }
+    out << "\n]\n";
+}
+
+inline void writeCsv(std::ostream& out, const Data& data) {
+    out << "name,metric,value,unit\n";
+    for (const auto& [name, resultMap] : data) {
+        forEachMetric(resultMap, [&](const std::string& key, long double value, const std::string& unit) { //
+            out << fmt::format("\"{}\",\"{}\",{:.9g},{}\n", csvEscape(name), csvEscape(key), value, unit);
+        });
+    }
+}
+
+/// minimal reader for the JSON written by 'writeJson(..)', i.e. an array of flat objects with a 'name' and numeric (or null) metrics
+[[nodiscard]] inline std::optional<Baseline> readJson(std::string_view json) {
+    std::size_t pos        = 0UZ;
+    const auto  skipSpaces = [&] {
+        while (pos < json.size() && std::isspace(static_cast<unsigned char>(json[pos]))) {
+            pos++;
+        }
+    };
+    const auto consume = [&](char expected) {
+        skipSpaces();
+        if (pos < json.size() && json[pos] == expected) {
+            pos++;
+            return true;
+        }
+        return false;
+    };
+    const auto parseString = [&]() -> std::optional<std::string> {
+        if (!consume('"')) {
+            return std::nullopt;
+        }
+        std::string result;
+        for (; pos < json.size() && json[pos] != '"'; pos++) {
+            if (json[pos] == '\\' && pos + 1 < json.size()) {
+                pos++;
+            }
+            result.push_back(json[pos]);
+        }
+        return consume('"') ? std::optional(std::move(result)) : std::nullopt;
+    };
+
+    Baseline baseline;
+    if (!consume('[')) {
+        return std::nullopt;
+    }
+    if (consume(']')) {
+        return baseline;
+    }
+    do {
+        if (!consume('{')) {
+            return std::nullopt;
+        }
+        std::string name;
+        Metrics     metrics;
+        do {
+            const auto key = parseString();
+            if (!key || !consume(':')) {
+                return std::nullopt;
+            }
+            skipSpaces();
+            if (*key == "name") {
+                const auto value = parseString();
+                if (!value) {
+                    return std::nullopt;
+                }
+                name = *value;
+            } else if (json.substr(pos).starts_with("null")) {
+                pos += 4UZ;
+            } else {
+                const std::size_t end = json.find_first_of(",} \t\r\n", pos);
+                if (end == std::string_view::npos) {
+                    return std::nullopt;
+                }
+                const std::string number(json.substr(pos, end - pos)); // N.B. std::from_chars(.., long double&) is not available with all standard libraries
+                char*             parsedEnd = nullptr;
+                const long double value     = std::strtold(number.c_str(), &parsedEnd);
+                if (parsedEnd != number.c_str() + number.size()) {
+                    return std::nullopt;
+                }
+                metrics.insert_or_assign(*key, value);
+                pos = end;
+            }
+        } while (consume(','));
+        if (!consume('}')) {
+            return std::nullopt;
+        }
+        baseline.insert_or_assign(std::move(name), std::move(metrics));
+    } while (consume(','));
+    return consume(']') ? std::optional(std::move(baseline)) : std::nullopt;
+}
+
+[[nodiscard]] inline double regressionThreshold() {
+    const char* ptr = std::getenv("BM_REGRESSION_THRESHOLD");
+    if (ptr == nullptr) {
+        return kDefaultRegressionThreshold;
+    }
+    const std::string_view env{ptr};
+    double                 threshold{};
+    const auto [_, ec] = std::from_chars(env.data(), env.data() + env.size(), threshold);
+    if (ec != std::errc() || threshold < 0.0) {
+        fmt::print("Invalid value for BM_REGRESSION_THRESHOLD: '{}' -- using {}%\n", env, kDefaultRegressionThreshold);
+        return kDefaultRegressionThreshold;
+    }
+    return threshold;
+}
+
+/// writes the results to 'BM_OUTPUT_FILE' (if defined)
+inline void exportResults(const Data& data) {
+    const char* ptr = std::getenv("BM_OUTPUT_FILE");
+    if (ptr == nullptr) {
+        return;
+    }
+    const std::string_view fileName{ptr};
+    std::ofstream          file{std::string(fileName)};
+    if (!file) {
+        fmt::print("\033[31mcould not open BM_OUTPUT_FILE '{}'\n\033[0m", fileName);
+        return;
+    }
+    if (fileName.ends_with(".csv")) {
+        writeCsv(file, data);
+    } else {
+        writeJson(file, data);
+    }
+    fmt::print("benchmark results written to '{}'\n", fileName);
+}
+
+/// compares the results against the 'BM_BASELINE' (if defined) and returns the number of regressions, i.e. metrics that deteriorated by more than the threshold
+[[nodiscard]] inline std::size_t compareToBaseline(const Data& data) {
+    const char* ptr = std::getenv("BM_BASELINE");
+    if (ptr == nullptr) {
+        return 0UZ;
+    }
+    const std::string_view fileName{ptr};
+    std::ifstream          file{std::string(fileName)};
+    const std::string      content{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    const auto             baseline = file ? readJson(content) : std::nullopt;
+    if (!baseline) {
+        fmt::print("\033[31mcould not read BM_BASELINE '{}'\n\033[0m", fileName);
+        return 1UZ;
+    }
+
+    const double threshold    = regressionThreshold();
+    std::size_t  nRegressions = 0UZ;
+    fmt::print("comparison against baseline '{}' (regression threshold: {}%):\n", fileName, threshold);
+    for (const auto& [name, resultMap] : data) {
+        if (name.empty() || resultMap.size() <= 1UZ) {
+            continue; // separator or failed/skipped benchmark
+        }
+        const auto reference = baseline->find(name);
+        if (reference == baseline->end()) {
+            fmt::print("  {:<60} not in baseline\n", name);
+            continue;
+        }
+        const Metrics metrics = flatten(resultMap);
+        for (const auto& [key, direction] : kRegressionMetrics) {
+            const auto current  = metrics.find(key);
+            const auto previous = reference->second.find(key);
+            if (current == metrics.end() || previous == reference->second.end() || !std::isfinite(current->second) || previous->second <= 0.0L) {
+                continue;
+            }
+            const double change     = static_cast<double>(100.0L * (current->second - previous->second) / previous->second); // [%]
+            const bool   regression = direction == Direction::LowerIsBetter ? change > threshold : -change > threshold;
+            nRegressions += regression ? 1UZ : 0UZ;
+            fmt::print("  {:<60} {:>6}: {:>+7.1f}% {}\n", name, key, change, regression ? "\033[31mREGRESSION\033[0m" : "\033[32mOK\033[0m");
+        }
+    }
+    if (nRegressions > 0UZ) {
+        fmt::print("\033[31m{} metric(s) regressed by more than {}%\n\033[0m", nRegressions, threshold);
+    }
+    return nRegressions;
+}
+} // namespace io
+
 } // namespace benchmark
 
 namespace cfg {
@@ -889,8 +1152,15 @@ public:
             std::cout << _printer.colors().pass << "all micro-benchmarks passed:\n" << _printer.colors().none;
         }
         print();
+        const auto& data = benchmark::results::data();
+        benchmark::io::exportResults(data);
+        const std::size_t nRegressions = benchmark::io::compareToBaseline(data);
         std::cerr.flush();
         std::cout.flush();
+        if (nRegressions > 0UZ) {
+            std::fflush(nullptr);
+            std::_Exit(EXIT_FAILURE); // N.B. the summary is reported during static destruction, 'std::exit(..)' is not safe here
+        }
     }
 
     template<std::size_t SIGNIFICANT_DIGITS = 3>
@@ -898,6 +1168,7 @@ public:
         const auto& data = benchmark::results::data();
         if (data.empty()) {
             fmt::print("no benchmark tests executed\n");
+            return;
         }
         std::vector<std::size_t> v(data.size());
         // N.B. using <algorithm> rather than <ranges> to be compatible with libc/Emscripten
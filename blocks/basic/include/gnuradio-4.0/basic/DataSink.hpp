@@ -5,6 +5,7 @@
 #include <gnuradio-4.0/BlockRegistry.hpp>
 #include <gnuradio-4.0/CircularBuffer.hpp>
 #include <gnuradio-4.0/DataSet.hpp>
+#include <gnuradio-4.0/DataSetPool.hpp>
 #include <gnuradio-4.0/HistoryBuffer.hpp>
 #include <gnuradio-4.0/Tag.hpp>
 #include <gnuradio-4.0/TriggerMatcher.hpp>
@@ -41,6 +42,8 @@ concept DataSetMatcher = std::invocable<T, gr::DataSet<V>> && std::is_same_v<std
 namespace detail {
 constexpr std::size_t data_sink_buffer_size          = 65536;
 constexpr std::size_t data_sink_data_set_buffer_size = 1024;
+constexpr std::size_t data_sink_data_set_pool_size   = 4;
+constexpr std::size_t data_sink_max_history_size     = 1UZ << 22; // default limit for the pre-trigger history
 } // namespace detail
 
 template<typename T>
@@ -84,6 +87,103 @@ struct StreamingPoller {
     }
 };
 
+/**
+ * @brief zero-copy alternative to StreamingPoller: rather than receiving a private copy of the data, the poller is attached
+ * by the sink as an additional reader to the sink's upstream stream and tag buffers, i.e. all pollers read the same (double-mapped) memory.
+ *
+ * Blocking pollers hold back the upstream block (same as a blocking StreamingPoller holding back the sink).
+ * Non-blocking pollers are kept by the sink within half the upstream buffer size of the stream, samples beyond that are dropped (-> `drop_count`).
+ * The poller receives data from the chunk being processed by the sink when attaching (i.e. on the first `processBulk` after the registration).
+ */
+template<typename T>
+struct ZeroCopyStreamingPoller {
+    using ReaderType    = decltype(std::declval<gr::CircularBuffer<T>>().new_reader());
+    using TagReaderType = decltype(std::declval<gr::CircularBuffer<Tag>>().new_reader());
+
+    std::optional<ReaderType>              reader;       // upstream stream buffer, valid once `attached`
+    std::optional<TagReaderType>           tag_reader;   // upstream tag buffer, valid once `attached`
+    std::atomic_flag                       _readerInUse; // arbitrates `reader`/`tag_reader` between the polling thread and the sink's drop policy
+
+    gr::CircularBuffer<Tag>                metadata_buffer = gr::CircularBuffer<Tag>(64); // sink metadata (signal name, unit, ...) -- not part of the upstream tags
+    decltype(metadata_buffer.new_reader()) metadata_reader = metadata_buffer.new_reader();
+    decltype(metadata_buffer.new_writer()) metadata_writer = metadata_buffer.new_writer();
+    std::size_t                            samples_read    = 0;                           // reader thread
+    std::atomic<bool>                      attached        = false;
+    std::atomic<bool>                      finished        = false;
+    std::atomic<std::size_t>               drop_count      = 0;
+
+    void attach(gr::CircularBuffer<T> streamBuffer, gr::CircularBuffer<Tag> tagBuffer, const ReaderType& sinkReader, const TagReaderType& sinkTagReader) {
+        reader.emplace(streamBuffer.new_reader(sinkReader));
+        tag_reader.emplace(tagBuffer.new_reader(sinkTagReader));
+        attached.store(true, std::memory_order_release);
+    }
+
+    template<typename Handler>
+    [[nodiscard]] bool process(Handler fnc, std::size_t requested = std::numeric_limits<std::size_t>::max()) {
+        if (!attached.load(std::memory_order_acquire) || _readerInUse.test_and_set(std::memory_order_acquire)) {
+            return false; // not yet attached or the sink is currently dropping samples
+        }
+        struct ReleaseGuard {
+            std::atomic_flag& flag;
+            ~ReleaseGuard() { flag.clear(std::memory_order_release); }
+        } guard{_readerInUse};
+
+        const auto nProcess = std::min(reader->available(), requested);
+        if (nProcess == 0) {
+            return false;
+        }
+
+        auto              readData = reader->get(nProcess);
+        const std::size_t position = reader->position();
+        auto              tags     = tag_reader->get();
+        const auto        tagsEnd  = std::ranges::find_if_not(tags, [until = position + nProcess](const auto& tag) { return tag.index < until; });
+        const auto        nTags    = static_cast<std::size_t>(std::distance(tags.begin(), tagsEnd));
+        if constexpr (requires { fnc(std::span<const T>(), std::span<const Tag>()); }) {
+            auto             metadataTags = metadata_reader.get();
+            const auto       metadataEnd  = std::ranges::find_if_not(metadataTags, [until = position + nProcess](const auto& tag) { return tag.index < until; });
+            const auto       nMetadata    = static_cast<std::size_t>(std::distance(metadataTags.begin(), metadataEnd));
+            std::vector<Tag> relevantTags;
+            relevantTags.reserve(nTags + nMetadata);
+            auto toRelative = [position](const Tag& tag) { return Tag{tag.index > position ? tag.index - position : 0UZ, tag.map}; }; // tags preceding the poller's stream are moved to its first sample
+            std::ranges::transform(tags.begin(), tagsEnd, std::back_inserter(relevantTags), toRelative);
+            std::ranges::transform(metadataTags.begin(), metadataEnd, std::back_inserter(relevantTags), toRelative); // sink metadata supersedes upstream tags
+            std::ranges::stable_sort(relevantTags, {}, &Tag::index);
+
+            fnc(readData, relevantTags);
+            std::ignore = metadataTags.consume(nMetadata);
+        } else {
+            auto metadataTags = metadata_reader.get();
+            std::ignore       = metadataTags.consume(metadataTags.size());
+            fnc(readData);
+        }
+        std::ignore = tags.consume(nTags);
+        std::ignore = readData.consume(nProcess);
+        samples_read += nProcess;
+        return true;
+    }
+
+    /// called by the sink (non-blocking mode): drops the oldest unread samples if the poller lags more than half the buffer behind `streamEnd`
+    void dropLaggingSamples(std::size_t streamEnd) {
+        if (_readerInUse.test_and_set(std::memory_order_acquire)) {
+            return; // poller is busy reading -- retry with the next chunk
+        }
+        const std::size_t maxLag   = reader->buffer().size() / 2UZ;
+        const std::size_t position = reader->position();
+        if (streamEnd > position + maxLag) {
+            const std::size_t nDrop = std::min(streamEnd - maxLag - position, reader->available());
+            {
+                auto dropped = reader->get(nDrop);
+                std::ignore  = dropped.consume(nDrop);
+            }
+            auto       tags    = tag_reader->get();
+            const auto tagsEnd = std::ranges::find_if_not(tags, [until = position + nDrop](const auto& tag) { return tag.index < until; });
+            std::ignore        = tags.consume(static_cast<std::size_t>(std::distance(tags.begin(), tagsEnd)));
+            drop_count += nDrop;
+        }
+        _readerInUse.clear(std::memory_order_release);
+    }
+};
+
 template<typename T>
 struct DataSetPoller {
     gr::CircularBuffer<DataSet<T>> buffer = gr::CircularBuffer<DataSet<T>>(detail::data_sink_data_set_buffer_size);
@@ -197,6 +297,14 @@ public:
         return sink ? sink->getStreamingPoller(block) : nullptr;
     }
 
+    template<typename T>
+    std::shared_ptr<ZeroCopyStreamingPoller<T>> getZeroCopyStreamingPoller(const DataSinkQuery& query, BlockingMode block = BlockingMode::Blocking) {
+        std::lock_guard lg{_mutex};
+        auto            sink = find<DataSink<T>>(query);
+        return sink ? sink->getZeroCopyStreamingPoller(block) : nullptr;
+    }
+
+    /// @return poller, or nullptr if no matching sink exists or `preSamples` exceeds its `max_history_size` (reported on stderr)
     template<typename T, trigger::Matcher M>
     std::shared_ptr<DataSetPoller<T>> getTriggerPoller(const DataSinkQuery& query, M&& matcher, std::size_t preSamples, std::size_t postSamples, BlockingMode block = BlockingMode::Blocking) {
         std::lock_guard lg{_mutex};
@@ -252,8 +360,7 @@ public:
             return false;
         }
 
-        sink->registerTriggerCallback(std::forward<M>(matcher), preSamples, postSamples, std::forward<Callback>(callback));
-        return true;
+        return sink->registerTriggerCallback(std::forward<M>(matcher), preSamples, postSamples, std::forward<Callback>(callback));
     }
 
     template<typename T, DataSetCallback<T> Callback, trigger::Matcher M>
@@ -377,6 +484,74 @@ inline std::optional<property_map> tagAndMetadata(const std::optional<property_m
     return merged;
 }
 
+// TODO: replace std::atomic_load/store_explicit by `std::atomic<std::shared_ptr<...>>` once libc++ supports it (see also Sequence.hpp)
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+
+/**
+ * @brief read-copy-update (RCU) listener list: registration (writer) threads modify a private master list and publish
+ * immutable snapshots of it, the processing (reader) thread iterates the latest snapshot without taking any lock.
+ *
+ * The reader only polls a version counter on each call and re-acquires the snapshot after a new one has been published.
+ * Expired listeners are skipped by the reader and removed by the next `publish()`. All writer-side methods need to be
+ * serialised by the caller (i.e. the sink's listener mutex), all reader-side methods must be called from a single thread.
+ */
+template<typename TListener>
+class CopyOnWriteListeners {
+public:
+    struct Snapshot {
+        std::vector<std::shared_ptr<TListener>> listeners;
+        std::size_t                             historySize = 0UZ; // required history (max. pre-trigger samples of all listeners)
+    };
+
+private:
+    std::deque<std::shared_ptr<TListener>> _master; // writer-side
+    std::shared_ptr<const Snapshot>        _published = std::make_shared<const Snapshot>();
+    std::atomic<std::size_t>               _version{0UZ};
+    alignas(hardware_destructive_interference_size) std::shared_ptr<const Snapshot> _active = _published; // reader-side
+    std::size_t                                                                     _activeVersion = 0UZ;
+
+public:
+    // writer side
+    [[nodiscard]] const std::deque<std::shared_ptr<TListener>>& master() const noexcept { return _master; }
+
+    void add(std::shared_ptr<TListener> listener, bool atBack) {
+        if (atBack) {
+            _master.push_back(std::move(listener));
+        } else {
+            _master.push_front(std::move(listener));
+        }
+        publish();
+    }
+
+    void publish() {
+        std::erase_if(_master, [](const auto& l) { return l->expired.load(std::memory_order_relaxed); });
+        std::size_t historySize = 0UZ; // N.B. shrinks again once the listener requiring the longest history is gone
+        if constexpr (requires(const TListener& l) { l.historySize(); }) {
+            for (const auto& l : _master) {
+                historySize = std::max(historySize, l->historySize());
+            }
+        }
+        std::atomic_store_explicit(&_published, std::make_shared<const Snapshot>(Snapshot{std::vector(_master.begin(), _master.end()), historySize}), std::memory_order_release);
+        _version.fetch_add(1UZ, std::memory_order_release);
+    }
+
+    // reader side
+    [[nodiscard]] const Snapshot& acquire() noexcept {
+        if (const std::size_t version = _version.load(std::memory_order_acquire); version != _activeVersion) [[unlikely]] {
+            _active        = std::atomic_load_explicit(&_published, std::memory_order_acquire);
+            _activeVersion = version;
+        }
+        return *_active;
+    }
+};
+
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
+
 template<typename T>
 [[nodiscard]] inline DataSet<T> makeDataSetTemplate(Metadata metadata) {
     DataSet<T> tmpl;
@@ -386,6 +561,13 @@ template<typename T>
     return tmpl;
 }
 
+template<typename T>
+inline void setTimingEvent(DataSet<T>& dataset, std::ptrdiff_t index, property_map tagData) {
+    dataset.timing_events.resize(1UZ);
+    dataset.timing_events[0].clear();
+    dataset.timing_events[0].emplace_back(index, std::move(tagData));
+}
+
 } // namespace detail
 
 /**
@@ -466,22 +648,24 @@ This block type is mean for non-data set input streams. For input streams of typ
 )"">;
     struct AbstractListener;
 
-    std::deque<std::unique_ptr<AbstractListener>> _listeners;
-    bool                                          _listeners_finished = false;
-    std::mutex                                    _listener_mutex;
-    std::optional<gr::HistoryBuffer<T>>           _history;
-    bool                                          _registered = false;
+    detail::CopyOnWriteListeners<AbstractListener> _listeners; // writers: guarded by _listener_mutex, reader: processBulk (lock-free)
+    bool                                           _listeners_finished = false;
+    std::mutex                                     _listener_mutex;
+    std::optional<gr::HistoryBuffer<T>>            _history; // processing thread only
+    std::atomic<std::size_t>                       _maxHistorySize{detail::data_sink_max_history_size};
+    bool                                           _registered = false;
 
 public:
     PortIn<T, RequiredSamples<std::dynamic_extent, detail::data_sink_buffer_size>> in;
 
-    Annotated<float, "sample rate", Doc<"signal sample rate">, Unit<"Hz">>           sample_rate = 1.f;
-    Annotated<std::string, "signal name", Visible>                                   signal_name = "unknown signal";
-    Annotated<std::string, "signal unit", Visible, Doc<"signal's physical SI unit">> signal_unit = "a.u.";
-    Annotated<float, "signal min", Doc<"signal physical min. (e.g. DAQ) limit">>     signal_min  = -1.0f;
-    Annotated<float, "signal max", Doc<"signal physical max. (e.g. DAQ) limit">>     signal_max  = +1.0f;
+    Annotated<float, "sample rate", Doc<"signal sample rate">, Unit<"Hz">>           sample_rate      = 1.f;
+    Annotated<std::string, "signal name", Visible>                                   signal_name      = "unknown signal";
+    Annotated<std::string, "signal unit", Visible, Doc<"signal's physical SI unit">> signal_unit      = "a.u.";
+    Annotated<float, "signal min", Doc<"signal physical min. (e.g. DAQ) limit">>     signal_min       = -1.0f;
+    Annotated<float, "signal max", Doc<"signal physical max. (e.g. DAQ) limit">>     signal_max       = +1.0f;
+    Annotated<gr::Size_t, "max history size", Doc<"limit for pre-trigger samples">>  max_history_size = static_cast<gr::Size_t>(detail::data_sink_max_history_size);
 
-    GR_MAKE_REFLECTABLE(DataSink, in, sample_rate, signal_name, signal_unit, signal_min, signal_max);
+    GR_MAKE_REFLECTABLE(DataSink, in, sample_rate, signal_name, signal_unit, signal_min, signal_max, max_history_size);
 
     using Block<DataSink<T>>::Block; // needed to inherit mandatory base-class Block(property_map) constructor
 
@@ -490,8 +674,10 @@ public:
         if (oldSignalName != signal_name && _registered) {
             DataSinkRegistry::instance().updateSignalName(this, oldSignalName.value_or(""), signal_name);
         }
+        _maxHistorySize = max_history_size; // N.B. existing listeners exceeding the limit receive fewer pre-trigger samples
+        // N.B. settings are applied by the processing thread, i.e. no listener is concurrently within process()
         std::lock_guard lg{_listener_mutex};
-        for (auto& listener : _listeners) {
+        for (auto& listener : _listeners.master()) {
             listener->setMetadata(detail::Metadata{sample_rate, signal_name, signal_unit, signal_min, signal_max});
         }
     }
@@ -501,18 +687,30 @@ public:
         auto            handler = std::make_shared<StreamingPoller<T>>();
         std::lock_guard lg(_listener_mutex);
         handler->finished = _listeners_finished;
-        addListener(std::make_unique<ContinuousListener<gr::meta::null_type>>(handler, block, *this), block);
+        addListener(std::make_shared<ContinuousListener<gr::meta::null_type>>(handler, block, *this), block);
+        return handler;
+    }
+
+    std::shared_ptr<ZeroCopyStreamingPoller<T>> getZeroCopyStreamingPoller(BlockingMode blockMode = BlockingMode::Blocking) {
+        const auto      block   = blockMode == BlockingMode::Blocking;
+        auto            handler = std::make_shared<ZeroCopyStreamingPoller<T>>();
+        std::lock_guard lg(_listener_mutex);
+        handler->finished = _listeners_finished;
+        addListener(std::make_shared<ZeroCopyListener>(handler, block, *this), block);
         return handler;
     }
 
+    /// @return poller, or nullptr if `preSamples` exceeds `max_history_size` (reported on stderr)
     template<trigger::Matcher M>
     std::shared_ptr<DataSetPoller<T>> getTriggerPoller(M&& matcher, std::size_t preSamples, std::size_t postSamples, BlockingMode blockMode = BlockingMode::Blocking) {
+        if (!isHistorySizeSupported(preSamples)) {
+            return nullptr;
+        }
         const auto      block   = blockMode == BlockingMode::Blocking;
         auto            handler = std::make_shared<DataSetPoller<T>>();
         std::lock_guard lg(_listener_mutex);
         handler->finished = _listeners_finished;
-        addListener(std::make_unique<TriggerListener<gr::meta::null_type, M>>(std::forward<M>(matcher), handler, preSamples, postSamples, block), block);
-        ensureHistorySize(preSamples);
+        addListener(std::make_shared<TriggerListener<gr::meta::null_type, M>>(std::forward<M>(matcher), handler, preSamples, postSamples, block), block);
         return handler;
     }
 
@@ -521,7 +719,7 @@ public:
         std::lock_guard lg(_listener_mutex);
         const auto      block   = blockMode == BlockingMode::Blocking;
         auto            handler = std::make_shared<DataSetPoller<T>>();
-        addListener(std::make_unique<MultiplexedListener<gr::meta::null_type, M>>(std::forward<M>(matcher), maximumWindowSize, handler, block), block);
+        addListener(std::make_shared<MultiplexedListener<gr::meta::null_type, M>>(std::forward<M>(matcher), maximumWindowSize, handler, block), block);
         return handler;
     }
 
@@ -530,33 +728,37 @@ public:
         const auto      block   = blockMode == BlockingMode::Blocking;
         auto            handler = std::make_shared<DataSetPoller<T>>();
         std::lock_guard lg(_listener_mutex);
-        addListener(std::make_unique<SnapshotListener<gr::meta::null_type, M>>(std::forward<M>(matcher), delay, handler, block), block);
+        addListener(std::make_shared<SnapshotListener<gr::meta::null_type, M>>(std::forward<M>(matcher), delay, handler, block), block);
         return handler;
     }
 
     template<StreamCallback<T> Callback>
     void registerStreamingCallback(std::size_t maxChunkSize, Callback&& callback) {
         std::lock_guard lg(_listener_mutex);
-        addListener(std::make_unique<ContinuousListener<Callback>>(maxChunkSize, std::forward<Callback>(callback), *this), false);
+        addListener(std::make_shared<ContinuousListener<Callback>>(maxChunkSize, std::forward<Callback>(callback), *this), false);
     }
 
+    /// @return false (callback not registered) if `preSamples` exceeds `max_history_size` (reported on stderr)
     template<trigger::Matcher M, DataSetCallback<T> Callback>
-    void registerTriggerCallback(M&& matcher, std::size_t preSamples, std::size_t postSamples, Callback&& callback) {
+    bool registerTriggerCallback(M&& matcher, std::size_t preSamples, std::size_t postSamples, Callback&& callback) {
+        if (!isHistorySizeSupported(preSamples)) {
+            return false;
+        }
         std::lock_guard lg(_listener_mutex);
-        addListener(std::make_unique<TriggerListener<Callback, M>>(std::forward<M>(matcher), preSamples, postSamples, std::forward<Callback>(callback)), false);
-        ensureHistorySize(preSamples);
+        addListener(std::make_shared<TriggerListener<Callback, M>>(std::forward<M>(matcher), preSamples, postSamples, std::forward<Callback>(callback)), false);
+        return true;
     }
 
     template<trigger::Matcher M, DataSetCallback<T> Callback>
     void registerMultiplexedCallback(M&& matcher, std::size_t maximumWindowSize, Callback&& callback) {
         std::lock_guard lg(_listener_mutex);
-        addListener(std::make_unique<MultiplexedListener<Callback, M>>(std::forward<M>(matcher), maximumWindowSize, std::forward<Callback>(callback)), false);
+        addListener(std::make_shared<MultiplexedListener<Callback, M>>(std::forward<M>(matcher), maximumWindowSize, std::forward<Callback>(callback)), false);
     }
 
     template<trigger::Matcher M, DataSetCallback<T> Callback>
     void registerSnapshotCallback(M&& matcher, std::chrono::nanoseconds delay, Callback&& callback) {
         std::lock_guard lg(_listener_mutex);
-        addListener(std::make_unique<SnapshotListener<Callback, M>>(std::forward<M>(matcher), delay, std::forward<Callback>(callback)), false);
+        addListener(std::make_shared<SnapshotListener<Callback, M>>(std::forward<M>(matcher), delay, std::forward<Callback>(callback)), false);
     }
 
     void start() noexcept {
@@ -568,7 +770,7 @@ public:
         DataSinkRegistry::instance().unregisterSink(this);
         _registered = false;
         std::lock_guard lg(_listener_mutex);
-        for (auto& listener : _listeners) {
+        for (auto& listener : _listeners.master()) {
             listener->stop();
         }
         _listeners_finished = true;
@@ -583,55 +785,72 @@ public:
             tagData = this->mergedInputTag().map;
         }
 
-        {
-            std::lock_guard lg(_listener_mutex); // TODO review/profile if a lock-free data structure should be used here
-            const auto      historyView = _history ? _history->get_span(0) : std::span<const T>();
-            std::erase_if(_listeners, [](const auto& l) { return l->expired; });
-            for (auto& listener : _listeners) {
+        const auto& snapshot = _listeners.acquire(); // lock-free, new listeners are picked up at the start of the next chunk
+        resizeHistory(std::min(snapshot.historySize, _maxHistorySize.load(std::memory_order_relaxed)));
+        const auto historyView = _history ? _history->get_span(0) : std::span<const T>();
+        bool       hasExpired  = false;
+        for (const auto& listener : snapshot.listeners) {
+            if (!listener->expired.load(std::memory_order_relaxed)) {
                 listener->process(historyView, inData, tagData);
             }
-            if (_history) {
-                _history->push_back_bulk(inData.begin(), inData.end());
-            }
+            hasExpired |= listener->expired.load(std::memory_order_relaxed);
+        }
+        if (_history) {
+            _history->push_back_bulk(inData.begin(), inData.end());
+        }
+        if (hasExpired) [[unlikely]] {
+            pruneExpiredListeners();
         }
         return work::Status::OK;
     }
 
 private:
-    void ensureHistorySize(std::size_t new_size) {
-        const auto old_size = _history ? _history->capacity() : std::size_t{0};
-        if (new_size <= old_size) {
+    [[nodiscard]] bool isHistorySizeSupported(std::size_t preSamples) const {
+        const std::size_t maxHistorySize = _maxHistorySize.load(std::memory_order_relaxed);
+        if (preSamples > maxHistorySize) {
+            fmt::println(stderr, "{}: requested pre-trigger samples {} exceed max_history_size {} -> trigger listener rejected", this->name, preSamples, maxHistorySize);
+            return false;
+        }
+        return true;
+    }
+
+    void resizeHistory(std::size_t newSize) {
+        const auto oldSize = _history ? _history->capacity() : 0UZ;
+        if (newSize == oldSize) [[likely]] {
             return;
         }
-        // TODO Important!
-        //  - History size must be limited to avoid users causing OOM
-        //  - History should shrink again
+        if (newSize == 0UZ) {
+            _history.reset();
+        } else if (_history) {
+            _history->set_capacity(newSize); // keeps the newest samples
+        } else {
+            _history.emplace(newSize);
+        }
+    }
 
-        auto new_history = gr::HistoryBuffer<T>(new_size);
-        if (_history) {
-            new_history.push_back_bulk(_history->begin(), _history->end());
+    void pruneExpiredListeners() {
+        std::unique_lock lk(_listener_mutex, std::try_to_lock);
+        if (lk.owns_lock()) { // otherwise: the concurrent registration prunes or a later call retries
+            _listeners.publish();
         }
-        _history = std::move(new_history);
     }
 
-    void addListener(std::unique_ptr<AbstractListener>&& l, bool block) {
+    void addListener(std::shared_ptr<AbstractListener>&& l, bool block) {
         l->setMetadata(detail::Metadata{sample_rate, signal_name, signal_unit, signal_min, signal_max});
-        if (block) {
-            _listeners.push_back(std::move(l));
-        } else {
-            _listeners.push_front(std::move(l));
-        }
+        _listeners.add(std::move(l), block); // blocking listeners at the back, so that non-blocking ones are served first
     }
 
     struct AbstractListener {
-        bool expired = false;
+        std::atomic<bool> expired = false;
 
         virtual ~AbstractListener() = default;
 
-        void setExpired() { expired = true; }
+        void setExpired() { expired.store(true, std::memory_order_relaxed); }
 
         virtual void setMetadata(detail::Metadata) = 0;
 
+        [[nodiscard]] virtual std::size_t historySize() const noexcept { return 0UZ; }
+
         virtual void process(std::span<const T> history, std::span<const T> data, std::optional<property_map> tagData0) = 0;
         virtual void stop()                                                                                             = 0;
     };
@@ -641,15 +860,25 @@ private:
         bool                            isBlocking = false;
         std::weak_ptr<DataSetPoller<T>> poller;
         Callback                        callback;
+        DataSetPool<T>                  pool{detail::data_sink_data_set_pool_size}; // recycles the data sets already consumed from the poller
 
         template<typename CallbackFW>
         explicit DataSetBaseListener(CallbackFW&& callback_) : callback(std::forward<CallbackFW>(callback_)) {}
 
         explicit DataSetBaseListener(std::shared_ptr<DataSetPoller<T>> poller_, bool isBlocking_) : isBlocking(isBlocking_), poller(std::move(poller_)) {}
 
+        [[nodiscard]] bool isPollerReleased() const noexcept {
+            if constexpr (std::is_same_v<Callback, gr::meta::null_type>) {
+                return poller.expired();
+            } else {
+                return false;
+            }
+        }
+
         inline void publishDataSet(DataSet<T>&& data) {
             if constexpr (!std::is_same_v<Callback, gr::meta::null_type>) {
                 callback(std::move(data));
+                pool.release(std::move(data)); // recycled unless the callback took ownership
             } else {
                 auto pollerPtr = poller.lock();
                 if (!pollerPtr) {
@@ -659,11 +888,12 @@ private:
 
                 if (isBlocking || pollerPtr->writer.available() > 0) {
                     auto writeData = pollerPtr->writer.reserve(1);
-                    writeData[0]   = std::move(data);
+                    std::swap(writeData[0], data); // 'data' now holds the slot's previous (already consumed) data set
                     writeData.publish(1);
                 } else {
                     pollerPtr->drop_count++;
                 }
+                pool.release(std::move(data));
             }
         }
     };
@@ -796,6 +1026,46 @@ private:
         }
     };
 
+    struct ZeroCopyListener : public AbstractListener {
+        DataSink<T>&                              parent_sink;
+        bool                                      block = false;
+        std::weak_ptr<ZeroCopyStreamingPoller<T>> polling_handler;
+        std::optional<detail::Metadata>           _pendingMetadata;
+
+        explicit ZeroCopyListener(std::shared_ptr<ZeroCopyStreamingPoller<T>> poller, bool doBlock, DataSink<T>& parent) : parent_sink(parent), block(doBlock), polling_handler{std::move(poller)} {}
+
+        void setMetadata(detail::Metadata metadata) override { _pendingMetadata = std::move(metadata); }
+
+        void process(std::span<const T>, std::span<const T> data, std::optional<property_map>) override {
+            auto poller = polling_handler.lock();
+            if (!poller) {
+                this->setExpired(); // N.B. destroying the poller also detaches its readers from the upstream buffers
+                return;
+            }
+
+            const std::size_t streamPosition = parent_sink.in.streamReader().position(); // not yet advanced by the current chunk
+            if (!poller->attached.load(std::memory_order_relaxed)) {
+                auto [streamBuffer, tagBuffer] = parent_sink.in.buffer();
+                poller->attach(streamBuffer, tagBuffer, parent_sink.in.streamReader(), parent_sink.in.tagReader());
+            }
+            if (_pendingMetadata && poller->metadata_writer.available() > 0) {
+                auto tw = poller->metadata_writer.reserve(1);
+                tw[0]   = {streamPosition, _pendingMetadata->toTagMap()};
+                tw.publish(1);
+                _pendingMetadata.reset();
+            }
+            if (!block) {
+                poller->dropLaggingSamples(streamPosition + data.size());
+            }
+        }
+
+        void stop() override {
+            if (auto p = polling_handler.lock()) {
+                p->finished = true;
+            }
+        }
+    };
+
     struct PendingWindow {
         DataSet<T>  dataset;
         std::size_t pending_post_samples = 0;
@@ -819,15 +1089,22 @@ private:
 
         void setMetadata(detail::Metadata metadata) override { dataset_template = detail::makeDataSetTemplate<T>(std::move(metadata)); }
 
+        [[nodiscard]] std::size_t historySize() const noexcept override { return preSamples; }
+
         void process(std::span<const T> history, std::span<const T> inData, std::optional<property_map> tagData0) override {
+            if (this->isPollerReleased()) { // N.B. releases the listener's pre-trigger history without waiting for the next trigger
+                this->setExpired();
+                return;
+            }
             if (tagData0 && trigger_matcher("", Tag{0, *tagData0}, trigger_matcher_state) == trigger::MatchResult::Matching) {
-                DataSet<T> dataset = dataset_template;
-                dataset.signal_values.reserve(preSamples + postSamples); // TODO maybe make the circ. buffer smaller but preallocate these
+                DataSet<T> dataset = this->pool.acquire();
+                dataset            = dataset_template; // re-uses the capacities of the recycled data set
+                dataset.signal_values.reserve(preSamples + postSamples);
 
                 const auto preSampleView = history.subspan(0UZ, std::min(preSamples, history.size()));
                 dataset.signal_values.insert(dataset.signal_values.end(), preSampleView.rbegin(), preSampleView.rend());
 
-                dataset.timing_events = {{{static_cast<std::ptrdiff_t>(preSampleView.size()), *tagData0}}};
+                detail::setTimingEvent(dataset, static_cast<std::ptrdiff_t>(preSampleView.size()), *tagData0);
                 pending_trigger_windows.push_back({.dataset = std::move(dataset), .pending_post_samples = postSamples});
             }
 
@@ -888,9 +1165,10 @@ private:
                     }
                 }
                 if (obsr == trigger::MatchResult::Matching) {
-                    pending_dataset = dataset_template;
+                    pending_dataset  = this->pool.acquire();
+                    *pending_dataset = dataset_template; // re-uses the capacities of the recycled data set
                     pending_dataset->signal_values.reserve(maximumWindowSize); // TODO might be too much?
-                    pending_dataset->timing_events = {{{0, *tagData0}}};
+                    detail::setTimingEvent(*pending_dataset, 0, *tagData0);
                 }
             }
             if (pending_dataset) {
@@ -957,9 +1235,10 @@ private:
                     break;
                 }
 
-                DataSet<T> dataset    = dataset_template;
-                dataset.timing_events = {{{-static_cast<std::ptrdiff_t>(it->delay), std::move(it->tag_data)}}};
-                dataset.signal_values = {inData[it->pending_samples]};
+                DataSet<T> dataset = this->pool.acquire();
+                dataset            = dataset_template; // re-uses the capacities of the recycled data set
+                detail::setTimingEvent(dataset, -static_cast<std::ptrdiff_t>(it->delay), std::move(it->tag_data));
+                dataset.signal_values.assign(1UZ, inData[it->pending_samples]);
                 this->publishDataSet(std::move(dataset));
                 it = pending.erase(it);
             }
@@ -994,9 +1273,9 @@ class DataSetSink : public Block<DataSetSink<T>> {
  @tparam T sample type in the data set
 )"">;
     struct AbstractListener;
-    std::deque<std::unique_ptr<AbstractListener>> _listeners;
-    bool                                          _listeners_finished = false;
-    std::mutex                                    _listener_mutex;
+    detail::CopyOnWriteListeners<AbstractListener> _listeners; // writers: guarded by _listener_mutex, reader: processBulk (lock-free)
+    bool                                           _listeners_finished = false;
+    std::mutex                                     _listener_mutex;
 
 public:
     PortIn<DataSet<T>>       in;
@@ -1012,7 +1291,7 @@ public:
         auto            handler = std::make_shared<DataSetPoller<T>>();
         std::lock_guard lg(_listener_mutex);
         handler->finished = _listeners_finished;
-        addListener(std::make_unique<Listener<gr::meta::null_type, M>>(std::forward<M>(matcher), handler, block), block);
+        addListener(std::make_shared<Listener<gr::meta::null_type, M>>(std::forward<M>(matcher), handler, block), block);
         return handler;
     }
 
@@ -1023,7 +1302,7 @@ public:
     template<DataSetMatcher<T> M, DataSetCallback<T> Callback>
     void registerCallback(M&& matcher, Callback&& callback) {
         std::lock_guard lg(_listener_mutex);
-        addListener(std::make_unique<Listener<Callback, M>>(std::forward<M>(matcher), std::forward<Callback>(callback)), false);
+        addListener(std::make_shared<Listener<Callback, M>>(std::forward<M>(matcher), std::forward<Callback>(callback)), false);
     }
 
     template<DataSetCallback<T> Callback>
@@ -1036,7 +1315,7 @@ public:
     void stop() noexcept {
         DataSinkRegistry::instance().unregisterSink(this);
         std::lock_guard lg(_listener_mutex);
-        for (auto& listener : _listeners) {
+        for (auto& listener : _listeners.master()) {
             listener->stop();
         }
         _listeners_finished = true;
@@ -1059,28 +1338,31 @@ public:
             this->notifyListeners(block::property::kSetting, {{"signal_names", signal_names}, {"signal_units", signal_units}});
         }
 
-        std::lock_guard lg(_listener_mutex);
-        for (auto& listener : _listeners) {
-            listener->process(inData);
+        bool hasExpired = false;
+        for (const auto& listener : _listeners.acquire().listeners) { // lock-free
+            if (!listener->expired.load(std::memory_order_relaxed)) {
+                listener->process(inData);
+            }
+            hasExpired |= listener->expired.load(std::memory_order_relaxed);
+        }
+        if (hasExpired) [[unlikely]] {
+            std::unique_lock lk(_listener_mutex, std::try_to_lock);
+            if (lk.owns_lock()) { // otherwise: the concurrent registration prunes or a later call retries
+                _listeners.publish();
+            }
         }
         return work::Status::OK;
     }
 
 private:
-    void addListener(std::unique_ptr<AbstractListener>&& l, bool block) {
-        if (block) {
-            _listeners.push_back(std::move(l));
-        } else {
-            _listeners.push_front(std::move(l));
-        }
-    }
+    void addListener(std::shared_ptr<AbstractListener>&& l, bool block) { _listeners.add(std::move(l), block); }
 
     struct AbstractListener {
-        bool expired = false;
+        std::atomic<bool> expired = false;
 
         virtual ~AbstractListener() = default;
 
-        void setExpired() { expired = true; }
+        void setExpired() { expired.store(true, std::memory_order_relaxed); }
 
         virtual void process(std::span<const DataSet<T>> data) = 0;
         virtual void stop()                                    = 0;
@@ -0,0 +1,62 @@
+#ifndef GNURADIO_FREQUENCY_SHIFT_HPP
+#define GNURADIO_FREQUENCY_SHIFT_HPP
+
+#include <complex>
+
+#include <gnuradio-4.0/Block.hpp>
+#include <gnuradio-4.0/BlockRegistry.hpp>
+#include <gnuradio-4.0/algorithm/NCO.hpp>
+
+#include <magic_enum.hpp>
+
+namespace gr::basic {
+
+template<std::floating_point T>
+struct FrequencyShift : Block<FrequencyShift<T>> {
+    using Description = Doc<R""(
+@brief Complex mixer/rotator translating the input spectrum by `frequency_shift`: y[n] = x[n] * exp(j * (2 * pi * f_shift / fs * n + phase))
+
+Typically used as the first stage of a digital down-converter (DDC), followed by a low-pass/decimating filter.
+The rotation factors are generated by a phase-accumulator NCO (see `gr::algorithm::NCO`):
+* 'Exact': std::sin/std::cos per sample
+* 'Table': look-up table with linear interpolation (|error| < 3e-7)
+* 'Polynomial' (default): SIMD-vectorised polynomial (~1 ulp), fastest
+)"">;
+    PortIn<std::complex<T>>  in;
+    PortOut<std::complex<T>> out;
+
+    Annotated<float, "sample_rate", Visible, Doc<"sample rate">>                      sample_rate     = 1.f;
+    Annotated<double, "frequency_shift", Visible, Doc<"in Hz, negative: down-shift">> frequency_shift = 0.;
+    Annotated<double, "phase", Doc<"initial phase in rad">>                           phase           = 0.;
+    Annotated<std::string, "nco_mode", Doc<"'Exact', 'Table' or 'Polynomial'">>       nco_mode        = std::string(magic_enum::enum_name(algorithm::NcoMode::Polynomial));
+
+    GR_MAKE_REFLECTABLE(FrequencyShift, in, out, sample_rate, frequency_shift, phase, nco_mode);
+
+    algorithm::NCO<T> _nco{};
+
+    void settingsChanged(const property_map& /*old_settings*/, const property_map& new_settings) {
+        const auto ncoMode = magic_enum::enum_cast<algorithm::NcoMode>(nco_mode.value, magic_enum::case_insensitive);
+        if (!ncoMode) {
+            throw gr::exception(fmt::format("invalid nco_mode: {}", nco_mode.value));
+        }
+        if (sample_rate <= 0.f) {
+            throw gr::exception(fmt::format("invalid sample_rate: {}", sample_rate.value));
+        }
+        _nco.mode = *ncoMode;
+        _nco.setFrequency(frequency_shift / static_cast<double>(sample_rate));
+        if (new_settings.contains("phase")) { // otherwise keep the phase continuous, e.g. for frequency hops
+            _nco.setPhase(phase);
+        }
+    }
+
+    [[nodiscard]] work::Status processBulk(std::span<const std::complex<T>> input, std::span<std::complex<T>> output) {
+        _nco.mix(input, output.first(input.size()));
+        return work::Status::OK;
+    }
+};
+
+} // namespace gr::basic
+
+inline static auto registerFrequencyShift = gr::registerBlock<gr::basic::FrequencyShift, float, double>(gr::globalBlockRegistry());
+
+#endif // GNURADIO_FREQUENCY_SHIFT_HPP
@@ -25,6 +25,16 @@ C++ and Python. This is a proof-of-concept implementation that can and should be
 extended (e.g. notably pmt-integration, and message handling) but should provide a start for
 'processBulk(...)' based signal processing using Python.
 
+The NumPy arrays passed to 'process_bulk(ins, outs)' wrap the port buffers directly (zero-copy), i.e. their content is
+only valid for the duration of the call (use '.copy()' to retain data). The argument tuple and lists are re-used between
+calls, an array view is only re-used if its port buffer region did not move -- since the read/write positions of the
+(circular) port buffers advance, this usually means one new array object per port and call. This per-call overhead is
+amortised by batching many small chunks into a single Python invocation by setting 'min_chunk_size'.
+
+By default all PythonBlocks share the global interpreter and thus serialise on its GIL. With 'execution = "isolated"'
+(Python >= 3.12) the block runs in its own sub-interpreter that owns its GIL and thus executes in parallel to other blocks.
+N.B. NumPy does not support such sub-interpreters: in this mode 'ins'/'outs' are passed as typed (zero-copy) 'memoryview's.
+
 Usage Example:
 @code
 #include <gnuradio-4.0/PythonBlock.hpp>
@@ -81,17 +91,25 @@ myBlock.processBulk(ins, outs);
     using poc_property_map = std::map<std::string, std::string, std::less<>>; // TODO: needs to be replaced with 'property_map` aka. 'pmtv::map_t'
     using tag_type         = std::string;
 
-    std::vector<PortIn<T>>                                                        inputs{};
-    std::vector<PortOut<T>>                                                       outputs{};
-    A<gr::Size_t, "n_inputs", Visible, Doc<"number of inputs">, Limits<1U, 32U>>  n_inputs     = 0U;
-    A<gr::Size_t, "n_outputs", Visible, Doc<"number of inputs">, Limits<1U, 32U>> n_outputs    = 0U;
-    std::string                                                                   pythonScript = "";
-
-    GR_MAKE_REFLECTABLE(PythonBlock, inputs, outputs, n_inputs, n_outputs, pythonScript);
-
-    PyModuleDef*        _moduleDefinitions = myBlockPythonDefinitions<T>();
-    python::Interpreter _interpreter{this, _moduleDefinitions};
-    std::string         _prePythonDefinition = fmt::format(R"p(import {0}
+    constexpr static std::string_view kSharedExecution   = "shared";
+    constexpr static std::string_view kIsolatedExecution = "isolated";
+
+    std::vector<PortIn<T>>                                                                                                 inputs{};
+    std::vector<PortOut<T>>                                                                                                outputs{};
+    A<gr::Size_t, "n_inputs", Visible, Doc<"number of inputs">, Limits<1U, 32U>>                                           n_inputs       = 0U;
+    A<gr::Size_t, "n_outputs", Visible, Doc<"number of inputs">, Limits<1U, 32U>>                                          n_outputs      = 0U;
+    A<gr::Size_t, "min chunk size", Visible, Doc<"min. number of samples per 'process_bulk' call">, Limits<1U, 1U << 20U>> min_chunk_size = 1U;
+    A<std::string, "execution", Doc<"'shared': global interpreter, 'isolated': own sub-interpreter and GIL">>              execution      = std::string(kSharedExecution);
+    std::string                                                                                                            pythonScript   = "";
+
+    GR_MAKE_REFLECTABLE(PythonBlock, inputs, outputs, n_inputs, n_outputs, min_chunk_size, execution, pythonScript);
+
+    PyModuleDef*                  _moduleDefinitions = myBlockPythonDefinitions<T>();
+    python::Interpreter           _interpreter{this, _moduleDefinitions};
+    python::PyObjectGuard         _pyProcessBulk;       // cached 'process_bulk' function object, updated when the script changes
+    python::PyArrayArguments      _pyArguments;         // persistent '(ins, outs)' tuple/lists, NumPy views re-created whenever the port buffer region moved
+    python::PyMemoryViewArguments _pyIsolatedArguments; // as above using memoryviews -- NumPy is not available within sub-interpreters
+    std::string                   _prePythonDefinition = fmt::format(R"p(import {0}
 import warnings
 
 class WarningException(Exception):
@@ -121,9 +139,9 @@ class PythonBlockWrapper: ## helper class to make the C++ class appear as a Pyth
 
 this_block = PythonBlockWrapper(capsule))p",
                 _moduleDefinitions->m_name);
-    poc_property_map    _settingsMap{{"key1", "value1"}, {"key2", "value2"}};
-    bool                _tagAvailable = false;
-    tag_type            _tag          = "Simulated Tag";
+    poc_property_map         _settingsMap{{"key1", "value1"}, {"key2", "value2"}};
+    bool                     _tagAvailable = false;
+    tag_type                 _tag          = "Simulated Tag";
 
     void settingsChanged(const gr::property_map& old_settings, const gr::property_map& new_settings) {
         if (new_settings.contains("n_inputs") || new_settings.contains("n_outputs")) {
@@ -139,7 +157,31 @@ this_block = PythonBlockWrapper(capsule))p",
             outputs.resize(n_outputs);
         }
 
-        if (new_settings.contains("pythonScript")) {
+        if (new_settings.contains("n_inputs") || new_settings.contains("min_chunk_size")) {
+            // N.B. the scheduler accumulates at least 'min_chunk_size' samples (or the remainder up to an end-of-stream) before calling processBulk
+            for (auto& port : inputs) {
+                port.min_samples = min_chunk_size;
+            }
+        }
+
+        bool reloadScript = new_settings.contains("pythonScript");
+        if (new_settings.contains("execution")) {
+            if (execution.value == kIsolatedExecution) {
+                if (!_interpreter.isIsolated()) {
+                    releasePythonObjects(); // belong to the shared interpreter
+                    _interpreter.isolate();
+                    reloadScript = reloadScript || !pythonScript.empty();
+                }
+            } else if (execution.value == kSharedExecution) {
+                if (_interpreter.isIsolated()) {
+                    throw gr::exception(fmt::format("{}(aka. {})::settingsChanged(...) - execution cannot be changed back from '{}' to '{}'", this->unique_name, this->name, kIsolatedExecution, kSharedExecution));
+                }
+            } else {
+                throw gr::exception(fmt::format("{}(aka. {})::settingsChanged(...) - unknown execution '{}' (supported: '{}', '{}')", this->unique_name, this->name, execution.value, kSharedExecution, kIsolatedExecution));
+            }
+        }
+
+        if (reloadScript) {
             _interpreter.invoke(
                 [this] {
                     if (python::PyObjectGuard testImport(PyRun_StringFlags(_prePythonDefinition.data(), Py_file_input, _interpreter.getDictionary(), _interpreter.getDictionary(), nullptr)); !testImport) {
@@ -171,11 +213,14 @@ this_block = PythonBlockWrapper(capsule))p",
                     if (!pyFunc.get() || !PyCallable_Check(pyFunc.get())) {
                         python::throwCurrentPythonError(fmt::format("{}(aka. {})::settingsChanged(...) Python function process_bulk not found or is not callable", this->unique_name, this->name), std::source_location::current(), pythonScript);
                     }
+                    _pyProcessBulk = std::move(pyFunc);
                 },
                 pythonScript);
         }
     }
 
+    ~PythonBlock() { releasePythonObjects(); }
+
     const poc_property_map& getSettings() const {
         // TODO: replace with this->settings().get() once the property_map is Python wrapped
         return _settingsMap;
@@ -215,23 +260,21 @@ this_block = PythonBlockWrapper(capsule))p",
     // clang-format on
 
 private:
-    template<typename TInputSpan, typename TOutputSpan>
-    void callPythonFunction(std::span<TInputSpan> ins, std::span<TOutputSpan> outs) {
-        PyObject* pIns = PyList_New(static_cast<Py_ssize_t>(ins.size()));
-        for (size_t i = 0; i < ins.size(); ++i) {
-            PyList_SetItem(pIns, Py_ssize_t(i), python::toPyArray(ins[i].data(), {ins[i].size()}));
-        }
+    void releasePythonObjects() {
+        auto guard = _interpreter.acquire(); // persistent Python objects need to be released while holding the GIL of their interpreter
+        _pyArguments.clear();
+        _pyIsolatedArguments.clear();
+        _pyProcessBulk = python::PyObjectGuard();
+    }
 
-        PyObject* pOuts = PyList_New(static_cast<Py_ssize_t>(outs.size()));
-        for (size_t i = 0; i < outs.size(); ++i) {
-            PyList_SetItem(pOuts, Py_ssize_t(i), python::toPyArray(outs[i].data(), {outs[i].size()}));
+    template<typename TInputSpan, typename TOutputSpan>
+    void callPythonFunction(std::span<TInputSpan> ins, std::span<TOutputSpan> outs) { // N.B. called with the GIL held by '_interpreter.invoke(...)'
+        if (!_pyProcessBulk) {
+            throw gr::exception(fmt::format("{}(aka. {})::callPythonFunction(..) Python function process_bulk not defined", this->unique_name, this->name));
         }
+        PyObject* pyArgs = _interpreter.isIsolated() ? _pyIsolatedArguments.update(ins, outs) : _pyArguments.update(ins, outs); // borrowed reference
 
-        python::PyObjectGuard pyArgs(PyTuple_New(2));
-        PyTuple_SetItem(pyArgs, 0, pIns);
-        PyTuple_SetItem(pyArgs, 1, pOuts);
-
-        if (python::PyObjectGuard pyValue = _interpreter.invokeFunction("process_bulk", pyArgs); !pyValue) {
+        if (python::PyObjectGuard pyValue(PyObject_CallObject(_pyProcessBulk, pyArgs)); !pyValue) {
             python::throwCurrentPythonError(fmt::format("{}(aka. {})::callPythonFunction(..) Python function call failed", this->unique_name, this->name), std::source_location::current(), pythonScript);
         }
     }
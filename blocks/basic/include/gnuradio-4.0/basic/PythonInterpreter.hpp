@@ -1,6 +1,8 @@
 #ifndef GNURADIO_PYTHONINTERPRETER_HPP
 #define GNURADIO_PYTHONINTERPRETER_HPP
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <cassert>
 #include <cctype>
@@ -11,6 +13,7 @@
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <utility>
 
 #include <gnuradio-4.0/Message.hpp>
 
@@ -50,13 +53,13 @@ class PyObjectGuard {
 
     void move(PyObjectGuard&& other) noexcept {
         PyDecRef(_ptr);
-        std::swap(_ptr, other._ptr);
+        _ptr = std::exchange(other._ptr, nullptr);
     }
 
 public:
     explicit PyObjectGuard(PyObject* ptr = nullptr) : _ptr(ptr) {}
 
-    explicit PyObjectGuard(PyObjectGuard&& other) noexcept : _ptr(other._ptr) { move(std::move(other)); }
+    explicit PyObjectGuard(PyObjectGuard&& other) noexcept : _ptr(std::exchange(other._ptr, nullptr)) {}
 
     ~PyObjectGuard() { PyDecRef(_ptr); }
 
@@ -75,8 +78,9 @@ public:
         if (this == &other) {
             return *this;
         }
+        PyIncRef(other._ptr);
+        PyDecRef(_ptr);
         _ptr = other._ptr;
-        PyIncRef(_ptr);
         return *this;
     }
 
@@ -97,6 +101,64 @@ public:
     PyGILGuard& operator=(const PyGILGuard&) = delete;
 };
 
+[[nodiscard]] inline PyThreadState* currentThreadState() noexcept { // N.B. does not fail if there is no current thread state
+#if PY_VERSION_HEX >= 0x030D0000
+    return PyThreadState_GetUnchecked();
+#else
+    return _PyThreadState_UncheckedGet();
+#endif
+}
+
+/**
+ * @brief acquires the GIL of the main interpreter (interpreter == nullptr) or of a sub-interpreter that owns its GIL.
+ *
+ * For sub-interpreters the given (e.g. per worker-thread cached) thread state is attached to the calling thread, or -- if
+ * none is given -- a temporary one is created and deleted again with the guard.
+ * Any thread state that is current on this thread is swapped out for the life-time of the guard and restored afterwards.
+ */
+class PyInterpreterGuard {
+    PyInterpreterState* _interpreter;
+    PyGILState_STATE    _gilState{};
+    PyThreadState*      _threadState     = nullptr;
+    PyThreadState*      _previousState   = nullptr;
+    bool                _ownsThreadState = false;
+
+public:
+    explicit PyInterpreterGuard(PyInterpreterState* interpreter = nullptr, PyThreadState* threadState = nullptr) : _interpreter(interpreter), _threadState(threadState) {
+        if (_interpreter == nullptr) {
+            _gilState = PyGILState_Ensure();
+            return;
+        }
+        if (currentThreadState() != nullptr) {
+            _previousState = PyEval_SaveThread();
+        }
+        if (_threadState == nullptr) {
+            _threadState     = PyThreadState_New(_interpreter);
+            _ownsThreadState = true;
+        }
+        PyEval_RestoreThread(_threadState);
+    }
+
+    ~PyInterpreterGuard() {
+        if (_interpreter == nullptr) {
+            PyGILState_Release(_gilState);
+            return;
+        }
+        if (_ownsThreadState) {
+            PyThreadState_Clear(_threadState);
+            PyThreadState_DeleteCurrent(); // also releases the sub-interpreter's GIL
+        } else {
+            std::ignore = PyEval_SaveThread(); // detaches the cached thread state and releases the sub-interpreter's GIL
+        }
+        if (_previousState != nullptr) {
+            PyEval_RestoreThread(_previousState);
+        }
+    }
+
+    PyInterpreterGuard(const PyInterpreterGuard&)            = delete;
+    PyInterpreterGuard& operator=(const PyInterpreterGuard&) = delete;
+};
+
 [[nodiscard]] inline std::string toString(PyObject* object) {
     PyObjectGuard strObj(PyObject_Repr(object));
     PyObjectGuard bytesObj(PyUnicode_AsEncodedString(strObj.get(), "utf-8", "strict"));
@@ -212,7 +274,9 @@ requires std::is_arithmetic_v<T> || std::is_same_v<T, std::complex<float>> || st
 constexpr inline PyObject* toPyArray(T* arrayData, std::initializer_list<std::size_t> dimensions) {
     assert(dimensions.size() >= 1 && "nDim needs to be >= 1");
 
-    std::vector<npy_intp> npyDims(dimensions.begin(), dimensions.end());
+    assert(dimensions.size() <= NPY_MAXDIMS && "nDim needs to be <= NPY_MAXDIMS");
+    std::array<npy_intp, NPY_MAXDIMS> npyDims{}; // N.B. no heap allocation on the (per-call) view creation path
+    std::ranges::copy(dimensions, npyDims.begin());
     // N.B. reinterpret cast is needed to access NumPy's unsafe C-API
     void*     data    = const_cast<void*>(reinterpret_cast<const void*>(arrayData));
     PyObject* npArray = PyArray_SimpleNewFromData(static_cast<int>(dimensions.size()), npyDims.data(), python::numpyType<std::remove_cv_t<T>>(), data);
@@ -229,6 +293,150 @@ constexpr inline PyObject* toPyArray(T* arrayData, std::initializer_list<std::si
     return npArray;
 }
 
+/**
+ * @brief stores a 1D NumPy array wrapping 'arrayData' at 'list[index]', re-using the array object already stored there if possible.
+ *
+ * The array already stored at 'list[index]' is kept if it wraps the same memory region (pointer, size, type and
+ * writeability), is not referenced anywhere else and does not share its memory with another array. Otherwise a new array
+ * view is created via NumPy's public C-API (PyArray_SimpleNewFromData) and replaces the previous one, which keeps pointing
+ * to its old memory if still referenced (e.g. kept by the user script).
+ * @return true if a new array view has been created
+ * N.B. the GIL must be held.
+ */
+template<typename T>
+requires std::is_arithmetic_v<T> || std::is_same_v<T, std::complex<float>> || std::is_same_v<T, std::complex<double>>
+inline bool setPyListArray(PyObject* list, Py_ssize_t index, T* arrayData, std::size_t size) {
+    if (PyObject* item = PyList_GET_ITEM(list, index); item != nullptr && Py_REFCNT(item) == 1 && PyArray_Check(item)) {
+        auto* npArray = reinterpret_cast<PyArrayObject*>(item);
+        if (PyArray_NDIM(npArray) == 1 && PyArray_TYPE(npArray) == python::numpyType<std::remove_cv_t<T>>() && PyArray_BASE(npArray) == nullptr //
+            && PyArray_DATA(npArray) == reinterpret_cast<const void*>(arrayData) && PyArray_DIM(npArray, 0) == static_cast<npy_intp>(size) && static_cast<bool>(PyArray_ISWRITEABLE(npArray)) == !std::is_const_v<T>) {
+            return false; // unchanged memory region -> keep the existing view
+        }
+    }
+    PyList_SetItem(list, index, python::toPyArray(arrayData, {size})); // steals the new reference and releases the previous item
+    return true;
+}
+
+template<typename T>
+constexpr const char* bufferFormat() noexcept { // Python 'struct' module format characters
+    // clang-format off
+    if constexpr (std::is_same_v<T, bool>)               return "?";
+    else if constexpr (std::is_same_v<T, std::int8_t>)   return "b";
+    else if constexpr (std::is_same_v<T, std::uint8_t>)  return "B";
+    else if constexpr (std::is_same_v<T, std::int16_t>)  return "h";
+    else if constexpr (std::is_same_v<T, std::uint16_t>) return "H";
+    else if constexpr (std::is_same_v<T, std::int32_t>)  return "i";
+    else if constexpr (std::is_same_v<T, std::uint32_t>) return "I";
+    else if constexpr (std::is_same_v<T, std::int64_t>)  return "q";
+    else if constexpr (std::is_same_v<T, std::uint64_t>) return "Q";
+    else if constexpr (std::is_same_v<T, float>)         return "f";
+    else if constexpr (std::is_same_v<T, double>)        return "d";
+    else return nullptr;
+    // clang-format on
+}
+
+/**
+ * @brief zero-copy typed 'memoryview' of external memory -- the NumPy-free counterpart of 'toPyArray(...)' used within
+ * sub-interpreters that own their GIL (NumPy cannot be loaded into these as of Python 3.12).
+ */
+template<typename T>
+requires std::is_arithmetic_v<T>
+inline PyObject* toPyMemoryView(T* arrayData, std::size_t size) {
+    static_assert(python::bufferFormat<std::remove_cv_t<T>>() != nullptr, "unsupported memoryview type");
+    PyObjectGuard bytes(PyMemoryView_FromMemory(static_cast<char*>(const_cast<void*>(reinterpret_cast<const void*>(arrayData))), static_cast<Py_ssize_t>(size * sizeof(T)), std::is_const_v<T> ? PyBUF_READ : PyBUF_WRITE));
+    if (!bytes) {
+        python::throwCurrentPythonError("Unable to create memoryview");
+    }
+    PyObject* typedView = PyObject_CallMethod(bytes, "cast", "s", python::bufferFormat<std::remove_cv_t<T>>());
+    if (!typedView) {
+        python::throwCurrentPythonError("Unable to cast memoryview");
+    }
+    return typedView;
+}
+
+/**
+ * @brief stores a typed memoryview wrapping 'arrayData' at 'list[index]', re-using the view already stored there if it
+ * wraps the same memory region and is not referenced anywhere else -- the memoryview counterpart of 'setPyListArray(...)'.
+ * @return true if a new memoryview has been created
+ * N.B. the GIL must be held.
+ */
+template<typename T>
+requires std::is_arithmetic_v<T>
+inline bool setPyListMemoryView(PyObject* list, Py_ssize_t index, T* arrayData, std::size_t size) {
+    if (PyObject* item = PyList_GET_ITEM(list, index); item != nullptr && Py_REFCNT(item) == 1 && PyMemoryView_Check(item)) {
+        const Py_buffer* buffer = PyMemoryView_GET_BUFFER(item);
+        if (buffer->buf == reinterpret_cast<const void*>(arrayData) && buffer->len == static_cast<Py_ssize_t>(size * sizeof(T)) && static_cast<bool>(buffer->readonly) == std::is_const_v<T>) {
+            return false; // unchanged memory region -> keep the existing view
+        }
+    }
+    PyList_SetItem(list, index, python::toPyMemoryView(arrayData, size)); // steals the new reference and releases the previous item
+    return true;
+}
+
+enum class ArgumentView { NumPy, MemoryView };
+
+/**
+ * @brief persistent '(ins, outs)' argument tuple of NumPy arrays or typed memoryviews (sub-interpreters) wrapping external
+ * (e.g. port buffer) memory.
+ *
+ * The tuple and lists are created once, the views are only re-created if the wrapped memory region changed (see
+ * 'setPyListArray(...)' and 'setPyListMemoryView(...)'). Any of these objects still referenced by the user script after the
+ * previous call is replaced by a new one.
+ * N.B. the read/write position of a (circular) port buffer usually advances between calls, i.e. typically one view per
+ * port and call is re-created (one Python object allocation each) -- 'nCreatedViews()' and 'nUpdates()' report the
+ * effective re-use. The GIL of the interpreter owning the objects must be held for 'update(...)' and 'clear()'.
+ */
+template<ArgumentView view>
+class PyArguments {
+    PyObjectGuard _args;
+    std::size_t   _nUpdates      = 0UZ;
+    std::size_t   _nCreatedViews = 0UZ;
+
+    template<typename TSpan>
+    void updateList(PyObject* tuple, Py_ssize_t position, std::span<TSpan> spans) {
+        const auto nSpans = static_cast<Py_ssize_t>(spans.size());
+        PyObject*  list   = PyTuple_GET_ITEM(tuple, position); // borrowed reference
+        if (list == nullptr || Py_REFCNT(list) > 1 || PyList_GET_SIZE(list) != nSpans) {
+            list = PyList_New(nSpans);
+            if (!list) {
+                python::throwCurrentPythonError("Unable to create argument list");
+            }
+            PyTuple_SetItem(tuple, position, list); // steals the new reference and releases the previous list
+        }
+        for (Py_ssize_t i = 0; i < nSpans; ++i) {
+            auto& span = spans[static_cast<std::size_t>(i)];
+            if constexpr (view == ArgumentView::NumPy) {
+                _nCreatedViews += python::setPyListArray(list, i, span.data(), span.size()) ? 1UZ : 0UZ;
+            } else {
+                _nCreatedViews += python::setPyListMemoryView(list, i, span.data(), span.size()) ? 1UZ : 0UZ;
+            }
+        }
+    }
+
+public:
+    template<typename TInputSpan, typename TOutputSpan>
+    PyObject* update(std::span<TInputSpan> ins, std::span<TOutputSpan> outs) {
+        if (!_args || Py_REFCNT(_args.get()) > 1) {
+            _args = PyObjectGuard(PyTuple_New(2));
+            if (!_args) {
+                python::throwCurrentPythonError("Unable to create argument tuple");
+            }
+        }
+        updateList(_args, 0, ins);
+        updateList(_args, 1, outs);
+        _nUpdates++;
+        return _args;
+    }
+
+    void clear() { _args = PyObjectGuard(); }
+
+    [[nodiscard]] std::size_t nUpdates() const noexcept { return _nUpdates; }           // number of 'update(...)' calls
+    [[nodiscard]] std::size_t nCreatedViews() const noexcept { return _nCreatedViews; } // number of (re-)created array views or memoryviews
+};
+
+using PyArrayArguments      = PyArguments<ArgumentView::NumPy>;
+using PyMemoryViewArguments = PyArguments<ArgumentView::MemoryView>;
+
 template<typename T>
 std::string sanitizedPythonBlockName() {
     std::string str = gr::meta::type_name<T>();
@@ -245,7 +453,10 @@ std::string sanitizedPythonBlockName() {
 #endif
 
 #include <fmt/format.h>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 namespace gr::python {
@@ -253,6 +464,8 @@ namespace gr::python {
 enum class EnforceFunction { MANDATORY, OPTIONAL };
 
 class Interpreter {
+    using ThreadStates = std::unordered_map<std::thread::id, PyThreadState*>;
+
     static std::atomic<std::size_t> _nInterpreters;
     static std::atomic<std::size_t> _nNumPyInit;
     static PyThreadState*           _interpreterThreadState;
@@ -260,10 +473,72 @@ class Interpreter {
     PyObject*                       _pMainModule; // borrowed reference
     PyObject*                       _pMainDict;   // borrowed reference
     PyObjectGuard                   _pCapsule;
+    void*                           _classReference = nullptr;
+    PyInterpreterState*             _subInterpreter = nullptr; // nullptr: shared main interpreter (and GIL)
+    PyThreadState*                  _subThreadState = nullptr; // initial (detached) thread state of the sub-interpreter
+    mutable std::mutex              _threadStatesMutex;
+    mutable ThreadStates            _threadStates; // (detached) sub-interpreter thread state per calling (e.g. worker) thread
+
+    void createModule(std::source_location location) {
+        // replaces the 'PyImport_AppendInittab("ClassName", &classDefinition)' to allow for other blocks being added
+        // after the global Python interpreter is already being initialised
+        PyObject* m = PyModule_Create(_moduleDefinitions);
+        if (m) {
+            int ret = PyDict_SetItemString(PyImport_GetModuleDict(), _moduleDefinitions->m_name, m);
+            python::PyDecRef(m); // The module dict holds a reference now.
+            if (ret != 0) {
+                python::throwCurrentPythonError(fmt::format("Error inserting module {}.", _moduleDefinitions->m_name), location);
+            }
+        } else {
+            python::throwCurrentPythonError(fmt::format("failed to create the module {}.", _moduleDefinitions->m_name), location);
+        }
+        if (PyDict_GetItemString(PyImport_GetModuleDict(), _moduleDefinitions->m_name)) { // module successfully inserted - performing some additional checks
+            assert(python::getDictionary(_moduleDefinitions->m_name).size() > 0 && "dictionary exist for module");
+
+            if (PyObject* imported_module = PyImport_ImportModule(_moduleDefinitions->m_name); imported_module != nullptr) {
+                python::PyDecRef(imported_module);
+            } else {
+                python::throwCurrentPythonError(fmt::format("Check import of {} failed.", _moduleDefinitions->m_name), location);
+            }
+        } else {
+            python::throwCurrentPythonError(fmt::format("Manual import of {} failed.", _moduleDefinitions->m_name), location);
+        }
+    }
+
+    [[nodiscard]] PyThreadState* workerThreadState() const { // N.B. thread states are bound to the OS thread that attaches them
+        if (_subInterpreter == nullptr) {
+            return nullptr;
+        }
+        std::lock_guard lock(_threadStatesMutex);
+        auto [it, inserted] = _threadStates.try_emplace(std::this_thread::get_id(), nullptr);
+        if (inserted) {
+            it->second = PyThreadState_New(_subInterpreter);
+        }
+        return it->second;
+    }
+
+    void endSubInterpreter() noexcept {
+        PyThreadState* previousState = currentThreadState() != nullptr ? PyEval_SaveThread() : nullptr;
+        PyEval_RestoreThread(_subThreadState);
+        {
+            std::lock_guard lock(_threadStatesMutex);
+            for (const auto& entry : _threadStates) { // 'Py_EndInterpreter(..)' requires the calling thread state to be the last one
+                PyThreadState_Clear(entry.second);
+                PyThreadState_Delete(entry.second);
+            }
+            _threadStates.clear();
+        }
+        Py_EndInterpreter(_subThreadState); // N.B. leaves no current thread state behind
+        if (previousState != nullptr) {
+            PyEval_RestoreThread(previousState);
+        }
+        _subInterpreter = nullptr;
+        _subThreadState = nullptr;
+    }
 
 public:
     template<typename T>
-    explicit(false) Interpreter(T* classReference, PyModuleDef* moduleDefinitions = nullptr, std::source_location location = std::source_location::current()) : _moduleDefinitions(moduleDefinitions) {
+    explicit(false) Interpreter(T* classReference, PyModuleDef* moduleDefinitions = nullptr, std::source_location location = std::source_location::current()) : _moduleDefinitions(moduleDefinitions), _classReference(static_cast<void*>(classReference)) {
         if (_nInterpreters.fetch_add(1UZ, std::memory_order_relaxed) == 0UZ) {
             Py_Initialize();
             if (PyErr_Occurred()) {
@@ -300,33 +575,13 @@ public:
         }
         PyDict_SetItemString(_pMainDict, "capsule", _pCapsule);
         python::PyIncRef(_pCapsule); // need to explicitly increas count for the Python interpreter not to delete the reference by 'accident'
-
-        // replaces the 'PyImport_AppendInittab("ClassName", &classDefinition)' to allow for other blocks being added
-        // after the global Python interpreter is already being initialised
-        PyObject* m = PyModule_Create(moduleDefinitions);
-        if (m) {
-            int ret = PyDict_SetItemString(PyImport_GetModuleDict(), moduleDefinitions->m_name, m);
-            python::PyDecRef(m); // The module dict holds a reference now.
-            if (ret != 0) {
-                python::throwCurrentPythonError(fmt::format("Error inserting module {}.", _moduleDefinitions->m_name), location);
-            }
-        } else {
-            python::throwCurrentPythonError(fmt::format("failed to create the module {}.", _moduleDefinitions->m_name), location);
-        }
-        if (PyDict_GetItemString(PyImport_GetModuleDict(), moduleDefinitions->m_name)) { // module successfully inserted - performing some additional checks
-            assert(python::getDictionary(moduleDefinitions->m_name).size() > 0 && "dictionary exist for module");
-
-            if (PyObject* imported_module = PyImport_ImportModule(moduleDefinitions->m_name); imported_module != nullptr) {
-                python::PyDecRef(imported_module);
-            } else {
-                python::throwCurrentPythonError(fmt::format("Check import of {} failed.", _moduleDefinitions->m_name), location);
-            }
-        } else {
-            python::throwCurrentPythonError(fmt::format("Manual import of {} failed.", _moduleDefinitions->m_name), location);
-        }
+        createModule(location);
     }
 
     ~Interpreter() {
+        if (_subInterpreter != nullptr && Py_IsInitialized()) {
+            endSubInterpreter();
+        }
         if (_nInterpreters.fetch_sub(1UZ, std::memory_order_acq_rel) == 1UZ && Py_IsInitialized()) {
             Py_Finalize();
         }
@@ -342,11 +597,77 @@ public:
 
     PyObject* getDictionary() { return _pMainDict; }
 
+    [[nodiscard]] bool isIsolated() const noexcept { return _subInterpreter != nullptr; }
+
+    [[nodiscard]] PyInterpreterGuard acquire() const { return PyInterpreterGuard(_subInterpreter, workerThreadState()); }
+
+    /// unique ID of the interpreter executing the Python code (0: shared main interpreter)
+    [[nodiscard]] std::int64_t id() const {
+        auto guard = acquire();
+        return PyInterpreterState_GetID(PyInterpreterState_Get());
+    }
+
+    /**
+     * @brief moves the execution into a new sub-interpreter that owns its GIL (PEP 684, Python >= 3.12) so that blocks
+     * using different interpreters do not serialise on the global GIL. The block module and 'capsule' are re-registered
+     * within the new interpreter -- any previously executed code and objects of the shared interpreter are not carried over.
+     * N.B. extension modules that do not support multiple interpreters (notably NumPy) cannot be imported in isolated mode.
+     */
+    void isolate(std::source_location location = std::source_location::current()) {
+        if (_subInterpreter != nullptr) {
+            return;
+        }
+#if PY_VERSION_HEX >= 0x030C0000
+        PyGILGuard     mainGuard; // creating a sub-interpreter requires a current thread state
+        PyThreadState* mainState = PyThreadState_Get();
+
+        PyInterpreterConfig config{};
+        config.use_main_obmalloc             = 0;
+        config.allow_fork                    = 0;
+        config.allow_exec                    = 0;
+        config.allow_threads                 = 1;
+        config.allow_daemon_threads          = 0;
+        config.check_multi_interp_extensions = 1;
+        config.gil                           = PyInterpreterConfig_OWN_GIL;
+
+        PyThreadState* subState = nullptr;
+        if (const PyStatus status = Py_NewInterpreterFromConfig(&subState, &config); PyStatus_Exception(status) || subState == nullptr) {
+            throw gr::exception(fmt::format("Interpreter::isolate() - failed to create sub-interpreter: {}", status.err_msg != nullptr ? status.err_msg : "<unknown>"), location);
+        }
+        // N.B. the new sub-interpreter's GIL is now held by this thread, the one of the main interpreter has been released
+        PyObject* sharedModule = std::exchange(_pMainModule, PyImport_AddModule("__main__"));
+        PyObject* sharedDict   = std::exchange(_pMainDict, PyModule_GetDict(_pMainModule));
+        _subInterpreter        = PyThreadState_GetInterpreter(subState);
+        try {
+            if (_classReference != nullptr && _moduleDefinitions != nullptr) {
+                PyObjectGuard capsule(PyCapsule_New(_classReference, _moduleDefinitions->m_name, nullptr));
+                if (!capsule || PyDict_SetItemString(_pMainDict, "capsule", capsule) != 0) {
+                    python::throwCurrentPythonError("Interpreter::isolate() - failed to create a capsule", location);
+                }
+                createModule(location);
+            }
+        } catch (...) {
+            Py_EndInterpreter(subState);
+            PyEval_RestoreThread(mainState);
+            _subInterpreter = nullptr;
+            _pMainModule    = sharedModule;
+            _pMainDict      = sharedDict;
+            throw;
+        }
+        // N.B. the initial thread state is kept (detached) until 'Py_EndInterpreter(..)' since some CPython versions fail to
+        // re-initialise it once deleted. Further thread states are created once per calling thread by 'workerThreadState()'.
+        _subThreadState = PyEval_SaveThread(); // releases the sub-interpreter's GIL
+        PyEval_RestoreThread(mainState);
+#else
+        throw gr::exception("Interpreter::isolate() - sub-interpreters with their own GIL require Python >= 3.12", location);
+#endif
+    }
+
     template<NoParamNoReturn Func>
     void invoke(Func func, std::string_view pythonCode = "", std::source_location location = std::source_location::current()) {
         assert(Py_IsInitialized());
-        PyGILGuard localGuard;
-        if (_interpreterThreadState != PyThreadState_Get()) {
+        PyInterpreterGuard localGuard(_subInterpreter, workerThreadState());
+        if (_subInterpreter == nullptr && _interpreterThreadState != PyThreadState_Get()) {
             python::throwCurrentPythonError("detected sub-interpreter change which is not supported by NumPy", location, pythonCode);
         }
         if (PyErr_Occurred()) {
@@ -362,7 +683,7 @@ public:
 
     template<EnforceFunction forced = EnforceFunction::MANDATORY>
     python::PyObjectGuard invokeFunction(std::string_view functionName, PyObject* functionArguments = nullptr, std::source_location location = std::source_location::current()) {
-        PyGILGuard localGuard;
+        PyInterpreterGuard localGuard(_subInterpreter, workerThreadState());
         const bool hasFunction = PyObject_HasAttrString(getModule(), functionName.data());
         if constexpr (forced == EnforceFunction::MANDATORY) {
             if (!hasFunction) {
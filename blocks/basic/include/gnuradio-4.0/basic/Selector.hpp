@@ -73,6 +73,14 @@ For uses where all input ports should be read even if they are not connected
 to any output port (thus reading and ignoring all the values from the input),
 you can set the `backPressure` property to false.
 
+Zero-copy routing: pure 1->N routes (i.e. outputs that are fed by exactly one input)
+can be resolved at connect time via `resolveZeroCopyRoutes(graph, selector)`. The
+downstream blocks of these outputs are then connected directly to the buffer of the
+upstream block (as additional readers) and no samples are copied. Only N->1 (synchronised)
+merges and the monitor output are still copied. Aliased routes are graph edges: remapping
+them at runtime is done via a topology update (graph 'RemoveEdge'/'EmplaceEdge' messages),
+`map_in`/`map_out` changes only affect the remaining (copied) routes.
+
 )"">;
     // optional shortening
     template<typename U, gr::meta::fixed_string description = "", typename... Arguments>
@@ -95,6 +103,7 @@ you can set the `backPressure` property to false.
 
     std::map<std::size_t, std::vector<std::size_t>> _internalMappingInOut{};
     std::map<std::size_t, std::vector<std::size_t>> _internalMappingOutIn{};
+    std::set<std::pair<std::size_t, std::size_t>>   _zeroCopyRoutes{}; // (input, output) routes resolved by buffer aliasing, see resolveZeroCopyRoutes(..)
 
     std::size_t _selectedSrc = 0UZ;
 
@@ -116,8 +125,10 @@ you can set the `backPressure` property to false.
             std::set<std::pair<gr::Size_t, gr::Size_t>> duplicateSet{};
 
             for (std::size_t i = 0U; i < map_out.value.size(); ++i) {
-                _internalMappingInOut[static_cast<std::size_t>(map_in.value[i])].push_back(static_cast<std::size_t>(map_out.value[i]));
-                _internalMappingOutIn[static_cast<std::size_t>(map_out.value[i])].push_back(static_cast<std::size_t>(map_in.value[i]));
+                if (!_zeroCopyRoutes.contains({static_cast<std::size_t>(map_in.value[i]), static_cast<std::size_t>(map_out.value[i])})) {
+                    _internalMappingInOut[static_cast<std::size_t>(map_in.value[i])].push_back(static_cast<std::size_t>(map_out.value[i]));
+                    _internalMappingOutIn[static_cast<std::size_t>(map_out.value[i])].push_back(static_cast<std::size_t>(map_in.value[i]));
+                }
 
                 const auto isDuplicate = !duplicateSet.insert({map_in.value[i], map_out.value[i]}).second;
                 if (isDuplicate) {
@@ -135,9 +146,24 @@ you can set the `backPressure` property to false.
         }
     }
 
+    void aliasRoute(std::size_t inIndex, std::size_t outIndex) {
+        _zeroCopyRoutes.insert({inIndex, outIndex});
+        if (auto it = _internalMappingInOut.find(inIndex); it != _internalMappingInOut.end()) {
+            std::erase(it->second, outIndex);
+            if (it->second.empty()) {
+                _internalMappingInOut.erase(it);
+            }
+        }
+        _internalMappingOutIn.erase(outIndex);
+    }
+
+    [[nodiscard]] bool isZeroCopyInput(std::size_t inIndex) const noexcept {
+        return std::ranges::any_of(_zeroCopyRoutes, [inIndex](const auto& route) { return route.first == inIndex; });
+    }
+
     template<gr::InputSpanLike TInSpan, gr::OutputSpanLike TOutSpan>
     gr::work::Status processBulk(InputSpanLike auto& selectSpan, std::span<TInSpan>& ins, OutputSpanLike auto& monOut, std::span<TOutSpan>& outs) {
-        if (_internalMappingInOut.empty()) {
+        if (_internalMappingInOut.empty() && _zeroCopyRoutes.empty()) {
             std::ranges::for_each(ins, [this](auto& input) { std::ignore = input.consume(back_pressure ? 0UZ : input.size()); });
             return work::Status::OK;
         }
@@ -237,7 +263,8 @@ you can set the `backPressure` property to false.
         }
 
         for (std::size_t inIndex = 0UZ; inIndex < ins.size(); inIndex++) {
-            const std::size_t nBackPressure = back_pressure ? 0UZ : ins[inIndex].size();
+            // N.B. the samples of aliased inputs are read directly by the downstream blocks -> never hold them back
+            const std::size_t nBackPressure = back_pressure && !isZeroCopyInput(inIndex) ? 0UZ : ins[inIndex].size();
             const std::size_t nFinal        = nSamplesToConsume[inIndex] == std::numeric_limits<std::size_t>::max() ? nBackPressure : nSamplesToConsume[inIndex];
             std::ignore                     = ins[inIndex].consume(nFinal);
             ins[inIndex].consumeTags(nFinal);
@@ -245,6 +272,58 @@ you can set the `backPressure` property to false.
         return work::Status::OK;
     }
 };
+
+/**
+ * @brief resolves the pure 1->N routes of 'selector' at connect time by aliasing the upstream buffer.
+ *
+ * For every output that is fed by exactly one input, the not yet connected edges 'selector.outputs#k -> downstream' are
+ * re-targeted to the block/port feeding 'selector.inputs#i', i.e. the downstream blocks become additional readers of the
+ * upstream CircularBuffer and the selector no longer copies these samples. Needs to be called after the edges have been
+ * defined and before the graph is handed to the scheduler.
+ *
+ * @return number of aliased (input, output) routes
+ */
+template<typename TGraph, typename T>
+std::size_t resolveZeroCopyRoutes(TGraph& graph, Selector<T>& selector) {
+    auto selectorIt = std::ranges::find_if(graph.blocks(), [&selector](const auto& block) { return block->raw() == std::addressof(selector); });
+    if (selectorIt == graph.blocks().end()) {
+        throw gr::exception(fmt::format("Selector {} was not found in the graph", selector.name));
+    }
+    BlockModel& selectorModel = **selectorIt;
+
+    auto isPendingEdge = [](const Edge& edge) { return edge.state() == Edge::EdgeState::WaitingToBeConnected; };
+    auto isInputEdge   = [&selectorModel](Edge& edge, std::size_t inIndex) { //
+        return edge._destinationBlock == &selectorModel && std::addressof(selectorModel.dynamicInputPort(edge._destinationPortDefinition)) == std::addressof(selectorModel.dynamicInputPort(fmt::format("inputs#{}", inIndex)));
+    };
+    auto isOutputEdge = [&selectorModel](Edge& edge, std::size_t outIndex) { //
+        return edge._sourceBlock == &selectorModel && std::addressof(selectorModel.dynamicOutputPort(edge._sourcePortDefinition)) == std::addressof(selectorModel.dynamicOutputPort(fmt::format("outputs#{}", outIndex)));
+    };
+
+    std::size_t nAliased = 0UZ;
+    const auto  mapping  = selector._internalMappingOutIn; // copy: aliasRoute(..) modifies the mapping
+    for (const auto& [outIndex, inIndices] : mapping) {
+        if (inIndices.size() != 1UZ) { // N->1 merges need to be copied
+            continue;
+        }
+        const std::size_t inIndex = inIndices[0];
+
+        auto  edges        = graph.edges();
+        auto  upstreamEdge = std::ranges::find_if(edges, [&](Edge& edge) { return isInputEdge(edge, inIndex); });
+        auto  outputEdges  = edges | std::views::filter([&](Edge& edge) { return isOutputEdge(edge, outIndex); });
+        if (upstreamEdge == edges.end() || !isPendingEdge(*upstreamEdge) || std::ranges::empty(outputEdges) || !std::ranges::all_of(outputEdges, isPendingEdge)) {
+            continue; // unconnected or already connected (-> topology update) routes are left as they are
+        }
+
+        for (Edge& edge : outputEdges) {
+            edge._sourceBlock          = upstreamEdge->_sourceBlock;
+            edge._sourcePortDefinition = upstreamEdge->_sourcePortDefinition;
+        }
+        selector.aliasRoute(inIndex, outIndex);
+        nAliased++;
+    }
+    return nAliased;
+}
+
 } // namespace gr::basic
 
 auto registerSelector = gr::registerBlock<gr::basic::Selector, float, double>(gr::globalBlockRegistry());
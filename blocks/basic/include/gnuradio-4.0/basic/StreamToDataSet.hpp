@@ -4,12 +4,103 @@
 #include "gnuradio-4.0/TriggerMatcher.hpp"
 #include <gnuradio-4.0/Block.hpp>
 #include <gnuradio-4.0/DataSet.hpp>
+#include <gnuradio-4.0/DataSetPool.hpp>
 #include <gnuradio-4.0/HistoryBuffer.hpp>
 #include <gnuradio-4.0/algorithm/dataset/DataSetUtils.hpp>
 #include <gnuradio-4.0/meta/utils.hpp>
 
 namespace gr::basic {
 
+namespace detail {
+struct AccumulationState {
+    bool        isActive           = false;
+    bool        isPreActive        = false;
+    bool        isPostActive       = false;
+    bool        isSingleTrigger    = false;
+    std::size_t nPostSamplesRemain = 0UZ;
+    std::size_t nPreSamples        = 0UZ;
+    std::size_t nSamples           = 0UZ;
+
+    void update(bool startTrigger, bool endTrigger, bool isSingle, gr::Size_t nPre, gr::Size_t nPost) {
+        isSingleTrigger = isSingle;
+        if (!isActive) {
+            if (startTrigger) {
+                isPreActive = nPre > 0; // No pre samples -> Done
+                isActive    = true;
+                nSamples    = 0UZ;
+                if (isSingleTrigger) {
+                    isPostActive       = true;
+                    nPostSamplesRemain = nPost;
+                }
+            }
+        }
+
+        if (isActive && !isPostActive && endTrigger) {
+            isPostActive       = true;
+            nPostSamplesRemain = nPost;
+        }
+    }
+
+    void updatePostSamples(std::size_t nPostSamplesToCopy) {
+        nPostSamplesRemain -= nPostSamplesToCopy;
+        nSamples += nPostSamplesToCopy;
+
+        if (nPostSamplesRemain == 0UZ) {
+            isActive     = false;
+            isPostActive = false;
+        }
+    }
+
+    void reset() {
+        isActive           = false;
+        isPreActive        = false;
+        isPostActive       = false;
+        nPostSamplesRemain = 0UZ;
+    }
+};
+
+template<typename T, typename TBlock>
+void initNewDataSet(DataSet<T>& dataSet, const TBlock& block, std::string_view filterDefinition) {
+    // N.B. 'dataSet' may be recycled -> (re-)assign all fields in-place to re-use the capacities of its previous use
+    dataSet.timestamp = 0;
+    dataSet.axis_names.resize(1UZ);
+    dataSet.axis_names[0] = "time";
+    dataSet.axis_units.resize(1UZ);
+    dataSet.axis_units[0] = "s";
+    dataSet.axis_values.resize(1UZ);
+    dataSet.axis_values[0].clear();
+    dataSet.extents.assign({1, 0}); // 1-dim data, size of 1-dim data
+    dataSet.layout = LayoutRight{};
+
+    dataSet.signal_names.resize(1UZ);
+    dataSet.signal_names[0] = block.signal_name.value;
+    dataSet.signal_quantities.resize(1UZ);
+    dataSet.signal_quantities[0] = block.signal_quantity.value;
+    dataSet.signal_units.resize(1UZ);
+    dataSet.signal_units[0] = block.signal_unit.value;
+    dataSet.signal_values.clear();
+    dataSet.signal_errors.clear();
+    dataSet.signal_ranges.resize(1UZ);    // one data set
+    dataSet.signal_ranges[0].resize(2UZ); // [min, max]s
+    dataSet.meta_information.resize(1);   // one data set (keys are always the same -> existing entries are overwritten)
+    dataSet.meta_information[0]["ctx"]    = std::string(filterDefinition);
+    dataSet.meta_information[0]["n_pre"]  = block.n_pre.value;
+    dataSet.meta_information[0]["n_post"] = block.n_post.value;
+    dataSet.meta_information[0]["n_max"]  = block.n_max.value;
+
+    dataSet.timing_events.resize(1UZ); // one data set
+    dataSet.timing_events[0].clear();
+}
+
+template<typename T>
+void fillAxisValues(DataSet<T>& ds, int start, std::size_t nSamples, float sampleRate) {
+    ds.axis_values[0].reserve(ds.axis_values[0].size() + nSamples);
+    for (int j = 0; j < static_cast<int>(nSamples); j++) {
+        ds.axis_values[0].emplace_back(static_cast<float>(start + j) / sampleRate);
+    }
+}
+} // namespace detail
+
 template<typename T, bool streamOut = true, trigger::Matcher TMatcher = trigger::BasicTriggerNameCtxMatcher::Filter>
 requires(std::is_arithmetic_v<T> || gr::meta::complex_like<T>)
 struct StreamFilterImpl : Block<StreamFilterImpl<T, streamOut, TMatcher>> {
@@ -55,55 +146,11 @@ If multiple 'start' or 'stop' Tags arrive in a single merged tag, only one DataS
     HistoryBuffer<T> _history{MIN_BUFFER_SIZE + n_pre};
     TMatcher         _matcher{};
 
-    struct AccumulationState {
-        bool        isActive           = false;
-        bool        isPreActive        = false;
-        bool        isPostActive       = false;
-        bool        isSingleTrigger    = false;
-        std::size_t nPostSamplesRemain = 0UZ;
-        std::size_t nPreSamples        = 0UZ;
-        std::size_t nSamples           = 0UZ;
-
-        void update(bool startTrigger, bool endTrigger, bool isSingle, gr::Size_t nPre, gr::Size_t nPost) {
-            isSingleTrigger = isSingle;
-            if (!isActive) {
-                if (startTrigger) {
-                    isPreActive = nPre > 0; // No pre samples -> Done
-                    isActive    = true;
-                    nSamples    = 0UZ;
-                    if (isSingleTrigger) {
-                        isPostActive       = true;
-                        nPostSamplesRemain = nPost;
-                    }
-                }
-            }
-
-            if (isActive && !isPostActive && endTrigger) {
-                isPostActive       = true;
-                nPostSamplesRemain = nPost;
-            }
-        }
-
-        void updatePostSamples(std::size_t nPostSamplesToCopy) {
-            nPostSamplesRemain -= nPostSamplesToCopy;
-            nSamples += nPostSamplesToCopy;
-
-            if (nPostSamplesRemain == 0UZ) {
-                isActive     = false;
-                isPostActive = false;
-            }
-        }
-
-        void reset() {
-            isActive           = false;
-            isPreActive        = false;
-            isPostActive       = false;
-            nPostSamplesRemain = 0UZ;
-        }
-    };
+    using AccumulationState = detail::AccumulationState;
 
     std::conditional_t<streamOut, AccumulationState, std::deque<AccumulationState>> _accState{};
     std::deque<DataSet<T>>                                                          _tempDataSets;
+    DataSetPool<T>                                                                  _dataSetPool{4UZ}; // recycles the consumed output buffer slots
     std::conditional_t<streamOut, property_map, std::deque<property_map>>           _filterState;
 
     void reset() {
@@ -199,10 +246,11 @@ If multiple 'start' or 'stop' Tags arrive in a single merged tag, only one DataS
     gr::work::Status processBulkDataSet(InputSpanLike auto& inSamples, OutputSpanLike auto& outSamples) {
         //    This is a workaround to support cases of overlapping datasets, for example, Start1-Start2-Stop1-Stop2 case.
         //    always add new DataSet when Start trigger is present
+        // N.B. only a tag can start a new DataSet -> untagged chunks skip the (allocating) initialisation of a new filter state
         property_map tmpFilterState;
-        const auto [startTrigger, endTrigger, isSingleTrigger] = detectTrigger(tmpFilterState);
+        const auto [startTrigger, endTrigger, isSingleTrigger] = this->inputTagsPresent() ? detectTrigger(tmpFilterState) : decltype(detectTrigger(tmpFilterState)){};
         if (startTrigger) {
-            _tempDataSets.emplace_back();
+            _tempDataSets.emplace_back(_dataSetPool.acquire());
             initNewDataSet(_tempDataSets.back());
 
             _accState.emplace_back();
@@ -286,7 +334,8 @@ If multiple 'start' or 'stop' Tags arrive in a single merged tag, only one DataS
                 if (!ds.signal_values.empty()) { // TODO: do we need to publish empty  DataSet at all, empty DataSet can occur when n_max is set.
                     gr::dataset::updateMinMax(ds);
                 }
-                outSamples[publishedCounter] = std::move(ds);
+                std::swap(outSamples[publishedCounter], ds); // 'ds' now holds the slot's previous (already consumed) data set
+                _dataSetPool.release(std::move(ds));
                 _tempDataSets.pop_front();
                 _accState.pop_front();
                 _filterState.pop_front();
@@ -325,33 +374,9 @@ private:
         }
     }
 
-    void fillAxisValues(DataSet<T>& ds, int start, std::size_t nSamples) {
-        ds.axis_values[0].reserve(ds.axis_values[0].size() + nSamples);
-        for (int j = 0; j < static_cast<int>(nSamples); j++) {
-            ds.axis_values[0].emplace_back(static_cast<float>(start + j) / sample_rate);
-        }
-    }
+    void fillAxisValues(DataSet<T>& ds, int start, std::size_t nSamples) { detail::fillAxisValues(ds, start, nSamples, sample_rate); }
 
-    void initNewDataSet(DataSet<T>& dataSet) const {
-        dataSet.axis_names.emplace_back("time");
-        dataSet.axis_units.emplace_back("s");
-        dataSet.axis_values.resize(1UZ);
-        dataSet.extents.emplace_back(1); // 1-dim data
-        dataSet.extents.emplace_back(0); // size of 1-dim data
-
-        dataSet.signal_names.emplace_back(signal_name);
-        dataSet.signal_quantities.emplace_back(signal_quantity);
-        dataSet.signal_units.emplace_back(signal_unit);
-        dataSet.signal_ranges.resize(1UZ);    // one data set
-        dataSet.signal_ranges[0].resize(2UZ); // [min, max]s
-        dataSet.meta_information.resize(1);   // one data set
-        dataSet.meta_information[0]["ctx"]    = filter;
-        dataSet.meta_information[0]["n_pre"]  = n_pre;
-        dataSet.meta_information[0]["n_post"] = n_post;
-        dataSet.meta_information[0]["n_max"]  = n_max;
-
-        dataSet.timing_events.resize(1UZ); // one data set
-    }
+    void initNewDataSet(DataSet<T>& dataSet) const { detail::initNewDataSet(dataSet, *this, filter.value); }
 };
 
 template<typename T>
@@ -360,10 +385,168 @@ using StreamToDataSet = StreamFilterImpl<T, false>;
 template<typename T>
 using StreamFilter = StreamFilterImpl<T, true>;
 
+template<typename T>
+requires(std::is_arithmetic_v<T> || gr::meta::complex_like<T>)
+struct MultiStreamToDataSet : Block<MultiStreamToDataSet<T>> {
+    using Description = Doc<R"(
+@brief Converts a stream of input data into chunked discrete DataSet<T>s for many trigger filters at once, one output per filter.
+The filter definitions are parsed once and each incoming tag is evaluated against all of them in a single pass, i.e. only
+the filters referring to the tag's (interned) trigger name are evaluated. The per-filter semantic (start/stop conditions,
+n_pre, n_post, n_max, overlapping windows) corresponds to that of StreamToDataSet<T>.)">;
+
+    constexpr static std::size_t MIN_BUFFER_SIZE = 1024U;
+    template<typename U, gr::meta::fixed_string description = "", typename... Arguments> // optional annotation shortening
+    using A = Annotated<U, description, Arguments...>;
+
+    // port definitions
+    PortIn<T>                               in;
+    std::vector<PortOut<DataSet<T>, Async>> outputs{};
+
+    // settings
+    A<std::vector<std::string>, "filters", Visible, Doc<"one '[<start trigger name>/<ctx1>, <stop trigger name>/<ctx2>]' per output">> filters;
+    A<gr::Size_t, "n samples pre", Visible, Doc<"number of pre-trigger samples">>                                                       n_pre  = 0U;
+    A<gr::Size_t, "n samples post", Visible, Doc<"number of post-trigger samples">>                                                     n_post = 0U;
+    A<gr::Size_t, "n samples max", Doc<"maximum number of samples (0: infinite)">>                                                      n_max  = 0U;
+
+    // meta information (will be usually set by incoming tags/upstream sources
+    A<float, "sample_rate", Doc<"signal sample rate">>                                                       sample_rate = 1.f;
+    A<std::string, "signal_name", Doc<"signal name">>                                                        signal_name;
+    A<std::string, "signal quantity", Doc<"physical quantity (e.g., 'voltage'). Follows ISO 80000-1:2022.">> signal_quantity;
+    A<std::string, "signal unit", Doc<"unit of measurement (e.g., '[V]', '[m]'). Follows ISO 80000-1:2022">> signal_unit;
+    A<float, "signal_min", Doc<"signal physical max. (e.g. DAQ) limit">>                                     signal_min = 0.f;
+    A<float, "signal_max", Doc<"signal physical max. (e.g. DAQ) limit">>                                     signal_max = 1.f;
+
+    GR_MAKE_REFLECTABLE(MultiStreamToDataSet, in, outputs, filters, n_pre, n_post, n_max, sample_rate, signal_name, signal_quantity, signal_unit, signal_min, signal_max);
+
+    struct PendingDataSet {
+        DataSet<T>                                      dataSet;
+        detail::AccumulationState                       accState;
+        trigger::BasicTriggerNameCtxMatcher::FilterState filterState; // stop condition state of this window
+    };
+
+    HistoryBuffer<T>                                 _history{MIN_BUFFER_SIZE + n_pre};
+    trigger::BasicTriggerNameCtxMatcher::MatcherSet _matchers;
+    std::vector<std::deque<PendingDataSet>>          _pending; // per output
+    DataSetPool<T>                                   _dataSetPool{4UZ}; // recycles the consumed output buffer slots
+
+    void reset() {
+        _pending.assign(_matchers.size(), {});
+        _matchers.reset();
+    }
+
+    void settingsChanged(const gr::property_map& /*oldSettings*/, const gr::property_map& newSettings) {
+        if (newSettings.contains("filters")) {
+            _matchers = trigger::BasicTriggerNameCtxMatcher::MatcherSet(filters.value); // parse once
+            outputs.resize(filters.value.size());
+            _pending.assign(filters.value.size(), {});
+        }
+        if (newSettings.contains("n_pre")) {
+            _history.set_capacity(MIN_BUFFER_SIZE + n_pre);
+        }
+        if (newSettings.contains("n_pre") || newSettings.contains("n_post") || newSettings.contains("n_max")) {
+            if (n_max != 0UZ && n_pre + n_post > n_max) {
+                throw gr::exception(fmt::format("ill-formed settings: n_pre({}) + n_post({}) > n_max({})", n_pre, n_post, n_max));
+            }
+        }
+    }
+
+    template<gr::OutputSpanLike TOutSpan>
+    gr::work::Status processBulk(InputSpanLike auto& inSamples, std::span<TOutSpan>& outs) {
+        using namespace trigger::BasicTriggerNameCtxMatcher;
+        const Tag& mergedTag = this->mergedInputTag();
+        if (!mergedTag.map.empty()) {
+            const auto [triggerName, triggerCtx] = triggerNameAndCtx(mergedTag);
+
+            // start conditions: evaluated (stateless, as in StreamToDataSet) only for filters that refer to this trigger name
+            _matchers.forEachCandidate(triggerName, [&](std::size_t i) {
+                const CompiledFilter& filter = _matchers.filter(i);
+                FilterState           state;
+                if (match(filter.view(), triggerName, triggerCtx, state) == trigger::MatchResult::Matching) {
+                    auto& pending = _pending[i].emplace_back(_dataSetPool.acquire(), detail::AccumulationState{}, state);
+                    detail::initNewDataSet(pending.dataSet, *this, filter.definition);
+                    pending.accState.update(true, false, filter.isSingleTrigger(), n_pre, n_post);
+                }
+            });
+
+            // stop conditions: evaluated for the oldest window (per output) that did not yet receive its stop condition
+            for (std::size_t i = 0UZ; i < _pending.size(); i++) {
+                auto it = std::ranges::find_if(_pending[i], [](const PendingDataSet& pending) { return !pending.accState.isPostActive; });
+                if (it != _pending[i].end() && match(_matchers.filter(i).view(), triggerName, triggerCtx, it->filterState) == trigger::MatchResult::NotMatching) {
+                    it->accState.update(false, true, _matchers.filter(i).isSingleTrigger(), n_pre, n_post);
+                }
+            }
+        }
+
+        const std::size_t maxSamples = n_max.value == 0U ? std::numeric_limits<std::size_t>::max() : static_cast<std::size_t>(n_max.value);
+        for (auto& pendingQueue : _pending) {
+            for (auto& [ds, accState, filterState] : pendingQueue) {
+                if (maxSamples > ds.signal_values.size() && !mergedTag.map.empty() && accState.isActive) { // do not add Tags if DataSet is full
+                    ds.timing_events[0].emplace_back(static_cast<std::ptrdiff_t>(ds.signal_values.size()), mergedTag.map);
+                }
+
+                if (accState.isPreActive) { // pre samples data accumulation (n_pre + n_post <= n_max)
+                    const std::size_t nPreSamplesToCopy = std::min(static_cast<std::size_t>(n_pre.value), _history.size());
+                    const auto        historyEnd        = std::next(_history.cbegin(), static_cast<std::ptrdiff_t>(nPreSamplesToCopy));
+                    ds.signal_values.insert(ds.signal_values.end(), std::make_reverse_iterator(historyEnd), std::make_reverse_iterator(_history.cbegin()));
+                    detail::fillAxisValues(ds, -static_cast<int>(nPreSamplesToCopy), nPreSamplesToCopy, sample_rate);
+                    accState.isPreActive = false;
+                    accState.nPreSamples = nPreSamplesToCopy;
+                    accState.nSamples += nPreSamplesToCopy;
+                }
+
+                if (!accState.isPostActive) { // normal data accumulation
+                    const std::size_t nSamplesToCopy = std::min(maxSamples - ds.signal_values.size(), inSamples.size());
+                    if (nSamplesToCopy > 0) {
+                        ds.signal_values.insert(ds.signal_values.end(), inSamples.begin(), std::next(inSamples.begin(), static_cast<std::ptrdiff_t>(nSamplesToCopy)));
+                        detail::fillAxisValues(ds, static_cast<int>(accState.nSamples - accState.nPreSamples), nSamplesToCopy, sample_rate);
+                        accState.nSamples += nSamplesToCopy;
+                    }
+                } else { // post samples data accumulation
+                    const std::size_t nPostSamplesToCopy = std::min({maxSamples - ds.signal_values.size(), accState.nPostSamplesRemain, inSamples.size()});
+                    if (nPostSamplesToCopy > 0) {
+                        ds.signal_values.insert(ds.signal_values.end(), inSamples.begin(), std::next(inSamples.begin(), static_cast<std::ptrdiff_t>(nPostSamplesToCopy)));
+                        detail::fillAxisValues(ds, static_cast<int>(accState.nSamples - accState.nPreSamples), nPostSamplesToCopy, sample_rate);
+                        accState.updatePostSamples(nPostSamplesToCopy);
+                    } else {
+                        accState.isActive = false;
+                    }
+                }
+            }
+        }
+        this->_mergedInputTag.map.clear(); // ensure that the input tag is only propagated once
+
+        if (n_pre > 0) {
+            _history.push_back_bulk(inSamples.begin(), inSamples.end());
+        }
+        std::ignore = inSamples.consume(inSamples.size());
+
+        // publish all completed DataSet<T>s on their filter's output
+        for (std::size_t i = 0UZ; i < _pending.size(); i++) {
+            auto&       pendingQueue     = _pending[i];
+            auto&       outSpan          = outs[i];
+            std::size_t publishedCounter = 0UZ;
+            while (!pendingQueue.empty() && !pendingQueue.front().accState.isActive && publishedCounter < outSpan.size()) {
+                auto& ds      = pendingQueue.front().dataSet;
+                ds.extents[1] = static_cast<std::int32_t>(ds.signal_values.size());
+                if (!ds.signal_values.empty()) {
+                    gr::dataset::updateMinMax(ds);
+                }
+                std::swap(outSpan[publishedCounter], ds); // 'ds' now holds the slot's previous (already consumed) data set
+                _dataSetPool.release(std::move(ds));
+                pendingQueue.pop_front();
+                publishedCounter++;
+            }
+            outSpan.publish(publishedCounter);
+        }
+
+        return work::Status::OK;
+    }
+};
+
 } // namespace gr::basic
 
 static_assert(gr::HasProcessBulkFunction<gr::basic::StreamFilterImpl<float>>);
 
-inline static auto registerStreamFilters = gr::registerBlock<gr::basic::StreamToDataSet, uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double, std::complex<float>, std::complex<double>>(gr::globalBlockRegistry()) | gr::registerBlock<gr::basic::StreamFilter, uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double, std::complex<float>, std::complex<double>>(gr::globalBlockRegistry());
+inline static auto registerStreamFilters = gr::registerBlock<gr::basic::StreamToDataSet, uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double, std::complex<float>, std::complex<double>>(gr::globalBlockRegistry()) | gr::registerBlock<gr::basic::StreamFilter, uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double, std::complex<float>, std::complex<double>>(gr::globalBlockRegistry()) | gr::registerBlock<gr::basic::MultiStreamToDataSet, float, double>(gr::globalBlockRegistry());
 
 #endif // GNURADIO_STREAMTODATASET_HPP
@@ -1,6 +1,10 @@
 #ifndef GNURADIO_SYNC_BLOCK_HPP
 #define GNURADIO_SYNC_BLOCK_HPP
 
+#include <chrono>
+#include <cstring>
+#include <deque>
+
 #include <gnuradio-4.0/Block.hpp>
 #include <gnuradio-4.0/HistoryBuffer.hpp>
 
@@ -116,6 +120,17 @@ in2: s1-s2-s3-s4-s5-s6-s7-s8-s9   → out2: s1-s2  →   s3-s4-s5-s6-s7-s8-s9
 New synchronization occurs with `s8`, prior samples (`s6-s7`) are NOT included to the output for zero padding.
 
 Note: We assume that desynchronization should not exceed the buffer size of the SyncBlock; if it does, the samples will be dropped.
+The number of samples held back per input is bounded by `max_history_size`, which is limited to 80% of the input buffer size.
+
+### Bounded latency
+If `timeout` is non-zero and no samples could be published for longer than `timeout`, the block stops waiting:
+for every input it drops the samples before the last (not yet synchronisable) sync tag, or all samples if there is none,
+and marks the streams as desynchronised. The dropped samples are reported via the desync tag (`N_DROPPED_SAMPLES`)
+with the next synchronised output (see scenario 3a/3b).
+
+### Implementation note
+Sync tags are indexed incrementally, i.e. each input tag is inspected only once when its sample becomes available and
+subsequent calls only evaluate the (few) cached sync tags.
 )"">;
 
 template<typename T>
@@ -128,12 +143,21 @@ struct SyncBlock : public gr::Block<SyncBlock<T>, NoDefaultTagForwarding, SyncBl
     Annotated<gr::Size_t, "max_history_size", Doc<"Max size of history">>                                          max_history_size = 32000U; // should be less than actual buffer size (better < 80%)
     Annotated<std::string, "filter", Doc<"trigger name filter">>                                                   filter           = "";
     Annotated<std::uint64_t, "tolerance", Doc<"trigger time tolerance [ns]">>                                      tolerance        = 5ULL;
+    Annotated<std::uint64_t, "timeout", Doc<"max. time w/o output before forcing re-sync (0: disabled)">, Unit<"ms">> timeout          = 0ULL;
 
-    GR_MAKE_REFLECTABLE(SyncBlock, inputs, outputs, n_ports, max_history_size, filter, tolerance);
+    GR_MAKE_REFLECTABLE(SyncBlock, inputs, outputs, n_ports, max_history_size, filter, tolerance, timeout);
 
     bool                     _isStreamSynchronized = false;
     std::vector<std::size_t> _nDroppedSamples{}; // number of dropped samples, to be sent with desynchronized tag
 
+    struct SyncTag {
+        std::size_t   index; // absolute sample index
+        std::uint64_t time;
+    };
+    std::vector<std::deque<SyncTag>>      _syncTags{};        // per input: sync tags of the already scanned samples, ordered by index
+    std::vector<std::size_t>              _nScannedSamples{}; // per input: absolute sample index up to which the tags have been scanned
+    std::chrono::steady_clock::time_point _lastProgress = std::chrono::steady_clock::now();
+
     int _processBulkCounter = 0;
 
     struct SyncData {
@@ -141,6 +165,7 @@ struct SyncBlock : public gr::Block<SyncBlock<T>, NoDefaultTagForwarding, SyncBl
         std::size_t nPre;  // number of pre samples, sample with sync index is not included
         std::size_t nPost; // number of post samples, sample with sync index is not included
     };
+    std::vector<SyncData> _syncData{}; // re-used between calls
 
     void settingsChanged(const property_map& oldSettings, const property_map& newSettings) {
         if (newSettings.contains("n_ports") && oldSettings.at("n_ports") != newSettings.at("n_ports")) {
@@ -154,20 +179,35 @@ struct SyncBlock : public gr::Block<SyncBlock<T>, NoDefaultTagForwarding, SyncBl
             inputs.resize(n_ports);
             outputs.resize(n_ports);
             _nDroppedSamples.resize(n_ports, 0UZ);
+            _syncTags.resize(n_ports);
+            _nScannedSamples.resize(n_ports, 0UZ);
+            _syncData.reserve(n_ports);
         }
 
-        if (newSettings.contains("max_history_size")) {
-            // should be less than actual buffer size (better < 80%)
-            // The logic has to be implemented when the new Port API is available
+        if (newSettings.contains("filter")) { // re-scan all pending tags with the new filter
+            std::ranges::for_each(_syncTags, [](auto& syncTags) { syncTags.clear(); });
+            std::ranges::fill(_nScannedSamples, 0UZ);
         }
+        // N.B. 'max_history_size' should be less than the actual buffer size (better < 80%) and is limited accordingly in 'maxHistorySize(..)'
+    }
+
+    void start() { _lastProgress = std::chrono::steady_clock::now(); } // N.B. the time-out counts from the start, not from the construction
+
+    void reset() {
+        _isStreamSynchronized = false;
+        std::ranges::fill(_nDroppedSamples, 0UZ);
+        std::ranges::for_each(_syncTags, [](auto& syncTags) { syncTags.clear(); });
+        std::ranges::fill(_nScannedSamples, 0UZ);
+        _lastProgress = std::chrono::steady_clock::now();
     }
 
     template<InputSpanLike TInput, OutputSpanLike TOutput>
     gr::work::Status processBulk(const std::span<TInput>& ins, std::span<TOutput>& outs) {
         std::size_t nPorts = ins.size();
 
-        const std::vector<SyncData> syncData = synchronize(ins);
-        const bool                  canSync  = !syncData.empty();
+        updateSyncTagIndex(ins);
+        const bool                   canSync  = synchronize(ins);
+        const std::vector<SyncData>& syncData = _syncData;
 
         if (canSync) {
             const std::size_t minPre            = std::ranges::min(syncData | std::views::transform([](const SyncData& data) { return data.nPre; }));
@@ -179,7 +219,7 @@ struct SyncBlock : public gr::Block<SyncBlock<T>, NoDefaultTagForwarding, SyncBl
                 const std::size_t nSamplesToDrop    = syncData[i].index - minPre;
                 const std::size_t nSamplesToConsume = nSamplesToDrop + nSamplesToPublish;
 
-                std::ranges::copy_n(ins[i].begin() + nSamplesToDrop, static_cast<std::ptrdiff_t>(nSamplesToPublish), outs[i].begin());
+                copySamples(ins[i], nSamplesToDrop, nSamplesToPublish, outs[i]);
                 const std::size_t totalDroppedSamples = _nDroppedSamples[i] + nSamplesToDrop;
 
                 publishDroppedSamplesTagIfNotZero(outs[i], totalDroppedSamples);
@@ -191,13 +231,14 @@ struct SyncBlock : public gr::Block<SyncBlock<T>, NoDefaultTagForwarding, SyncBl
                 outs[i].publish(nSamplesToPublish);
             }
             _isStreamSynchronized = true;
+            _lastProgress         = std::chrono::steady_clock::now();
         } else {
-            const std::size_t minSamplesBeforeSyncTag = std::ranges::min(ins | std::views::transform([&](const auto& in) { return getNSamplesBeforeSyncTag(in); }));
+            const std::size_t minSamplesBeforeSyncTag = std::ranges::min(std::views::iota(0UZ, nPorts) | std::views::transform([&](std::size_t i) { return getNSamplesBeforeSyncTag(i, ins[i]); }));
             const std::size_t minSamplesOut           = std::ranges::min(outs | std::views::transform([&](const auto& out) { return out.size(); }));
             const std::size_t nSamplesToCopy          = std::min(minSamplesBeforeSyncTag, minSamplesOut);
             if (_isStreamSynchronized && nSamplesToCopy > 0UZ) { // all streams are in sync -> write sample before first Sync tag
                 for (std::size_t i = 0; i < nPorts; i++) {
-                    std::ranges::copy_n(ins[i].begin(), static_cast<std::ptrdiff_t>(nSamplesToCopy), outs[i].begin());
+                    copySamples(ins[i], 0UZ, nSamplesToCopy, outs[i]);
 
                     publishDroppedSamplesTagIfNotZero(outs[i], _nDroppedSamples[i]);
                     publishInputTags(ins[i], outs[i], 0UZ, nSamplesToCopy);
@@ -208,9 +249,23 @@ struct SyncBlock : public gr::Block<SyncBlock<T>, NoDefaultTagForwarding, SyncBl
                     ins[i].consumeTags(nSamplesToCopy);
                     outs[i].publish(nSamplesToCopy);
                 }
+                _lastProgress = std::chrono::steady_clock::now();
+            } else if (isTimedOut(ins)) { // waited too long for data that can be synchronised -> force progress
+                for (std::size_t i = 0; i < nPorts; i++) {
+                    const std::size_t nSamplesToDrop = getNSamplesBeforeLastSyncTag(i, ins[i]);
+                    if (nSamplesToDrop != 0UZ) {
+                        std::ignore = ins[i].consume(nSamplesToDrop);
+                        ins[i].consumeTags(nSamplesToDrop);
+                        _nDroppedSamples[i] += nSamplesToDrop;
+                        outs[i].publish(0UZ);
+                    }
+                }
+                _isStreamSynchronized = false;
+                _lastProgress         = std::chrono::steady_clock::now();
             } else { // streams are NOT in sync -> check back pressure and drop samples if needed
                 for (std::size_t i = 0; i < nPorts; i++) {
-                    const std::size_t nSamplesToDrop = ins[i].size() < static_cast<std::size_t>(max_history_size) ? 0UZ : ins[i].size() - static_cast<std::size_t>(max_history_size);
+                    const std::size_t maxHistory     = maxHistorySize(i);
+                    const std::size_t nSamplesToDrop = ins[i].size() < maxHistory ? 0UZ : ins[i].size() - maxHistory;
                     if (nSamplesToDrop != 0UZ) {
                         std::ignore = ins[i].consume(nSamplesToDrop);
                         ins[i].consumeTags(nSamplesToDrop);
@@ -247,92 +302,138 @@ struct SyncBlock : public gr::Block<SyncBlock<T>, NoDefaultTagForwarding, SyncBl
         }
     }
 
+    template<InputSpanLike TInput, OutputSpanLike TOutput>
+    static void copySamples(const TInput& in, std::size_t offset, std::size_t nSamples, TOutput& out) {
+        // N.B. each channel lives in its own buffer -> one contiguous (vectorised) copy per channel
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (nSamples > 0UZ) {
+                std::memcpy(std::to_address(out.begin()), std::to_address(std::next(in.begin(), static_cast<std::ptrdiff_t>(offset))), nSamples * sizeof(T));
+            }
+        } else {
+            std::ranges::copy_n(std::next(in.begin(), static_cast<std::ptrdiff_t>(offset)), static_cast<std::ptrdiff_t>(nSamples), out.begin());
+        }
+    }
+
+    [[nodiscard]] std::size_t maxHistorySize(std::size_t portIndex) const {
+        const std::size_t bufferSize = inputs[portIndex].bufferSize();
+        const std::size_t limit      = bufferSize == 0UZ ? std::numeric_limits<std::size_t>::max() : bufferSize * 4UZ / 5UZ; // < 80% of the buffer size to avoid stalling the upstream
+        return std::min(static_cast<std::size_t>(max_history_size), limit);
+    }
+
+    template<InputSpanLike TInput>
+    [[nodiscard]] bool isTimedOut(const std::span<TInput>& ins) const {
+        if (timeout == 0ULL || std::ranges::all_of(ins, [](const auto& in) { return in.size() == 0UZ; })) {
+            return false;
+        }
+        return std::chrono::steady_clock::now() - _lastProgress > std::chrono::milliseconds(static_cast<std::chrono::milliseconds::rep>(timeout.value));
+    }
+
+    template<InputSpanLike TInput>
+    void updateSyncTagIndex(const std::span<TInput>& ins) {
+        for (std::size_t i = 0UZ; i < ins.size(); i++) {
+            const auto& in       = ins[i];
+            auto&       syncTags = _syncTags[i];
+            while (!syncTags.empty() && syncTags.front().index < in.streamIndex) { // drop tags of already consumed samples
+                syncTags.pop_front();
+            }
+
+            // scan only tags of samples that became available since the last call
+            const std::size_t scanFrom  = std::max(_nScannedSamples[i], in.streamIndex);
+            const std::size_t scanUntil = in.streamIndex + in.size();
+            for (auto it = std::ranges::lower_bound(in.rawTags, scanFrom, {}, &Tag::index); it != in.rawTags.end() && it->index < scanUntil; ++it) {
+                if (isSyncTag(*it)) {
+                    syncTags.push_back({it->index, getTime(*it)});
+                }
+            }
+            _nScannedSamples[i] = std::max(_nScannedSamples[i], scanUntil);
+        }
+    }
+
     template<InputSpanLike TInput>
-    [[nodiscard]] constexpr std::vector<SyncData> synchronize(const std::span<TInput>& ins) {
+    [[nodiscard]] constexpr bool synchronize(const std::span<TInput>& ins) {
+        _syncData.clear();
         const std::uint64_t syncTime = findSyncTime(ins);
         if (syncTime == std::numeric_limits<std::uint64_t>::max()) {
-            return {};
+            return false;
         }
 
-        std::vector<SyncData> syncData;
-        syncData.reserve(ins.size());
-        for (const auto& inSpan : ins) {
-            for (const auto& tag : inSpan.rawTags) {
-                const std::size_t relativeTagIndex = getRelativeTagIndex(inSpan, tag);
-                if (isTimeDifferenceWithinTolerance(getTime(tag), syncTime) && relativeTagIndex != std::numeric_limits<std::size_t>::max()) {
-                    const std::size_t nPre  = getAvailablePreSamples(inSpan, relativeTagIndex);
-                    const std::size_t nPost = getAvailablePostSamples(inSpan, relativeTagIndex);
-                    syncData.push_back({relativeTagIndex, nPre, nPost});
+        for (std::size_t i = 0UZ; i < ins.size(); i++) {
+            for (const SyncTag& syncTag : syncTagsInSpan(i, ins[i])) {
+                if (isTimeDifferenceWithinTolerance(syncTag.time, syncTime)) {
+                    const std::size_t relativeTagIndex = syncTag.index - ins[i].streamIndex;
+                    _syncData.push_back({relativeTagIndex, getAvailablePreSamples(i, ins[i], relativeTagIndex), getAvailablePostSamples(i, ins[i], relativeTagIndex)});
                     break;
                 }
             }
         }
 
-        assert(ins.size() == syncData.size());
-
-        return syncData;
+        assert(ins.size() == _syncData.size());
+        return true;
     }
 
     template<InputSpanLike TInput>
-    [[nodiscard]] constexpr std::uint64_t findSyncTime(const std::span<TInput>& ins) {
-        std::vector<std::vector<std::uint64_t>> syncTimesPerInSpan; // Collect sync times for each input span
-        syncTimesPerInSpan.reserve(ins.size());
-        std::set<std::uint64_t> allSyncTimes; // Collect all unique sync times, ordered
-        for (const auto& inSpan : ins) {
-            std::vector<std::uint64_t> syncTimes;
-            for (const auto& tag : inSpan.rawTags) {
-                const std::size_t relativeTagIndex = getRelativeTagIndex(inSpan, tag);
-                if (isSyncTag(tag) && relativeTagIndex < inSpan.size() && relativeTagIndex != std::numeric_limits<std::size_t>::max()) {
-                    const std::uint64_t time = getTime(tag);
-                    syncTimes.push_back(time);
-                    allSyncTimes.insert(time);
-                }
+    [[nodiscard]] constexpr std::uint64_t findSyncTime(const std::span<TInput>& ins) const {
+        for (std::size_t i = 0UZ; i < ins.size(); i++) { // fast path: at least one input without sync tag -> cannot synchronise
+            if (syncTagsInSpan(i, ins[i]).empty()) {
+                return std::numeric_limits<std::uint64_t>::max();
             }
-            syncTimesPerInSpan.push_back(std::move(syncTimes));
         }
 
         // Find the earliest sync time present in all input spans within tolerance
-        auto findInAllIt = std::ranges::find_if(allSyncTimes, [&](const auto& curTime) { //
-            return std::ranges::all_of(syncTimesPerInSpan, [&](const auto& syncTimes) {  //
-                return std::ranges::any_of(syncTimes, [&](const auto& t) { return isTimeDifferenceWithinTolerance(curTime, t); });
-            });
-        });
+        std::uint64_t syncTime = std::numeric_limits<std::uint64_t>::max();
+        for (std::size_t i = 0UZ; i < ins.size(); i++) {
+            for (const SyncTag& candidate : syncTagsInSpan(i, ins[i])) {
+                if (candidate.time >= syncTime) {
+                    continue;
+                }
+                const bool presentInAll = std::ranges::all_of(std::views::iota(0UZ, ins.size()), [&](std::size_t j) { //
+                    return std::ranges::any_of(syncTagsInSpan(j, ins[j]), [&](const SyncTag& syncTag) { return isTimeDifferenceWithinTolerance(candidate.time, syncTag.time); });
+                });
+                if (presentInAll) {
+                    syncTime = candidate.time;
+                }
+            }
+        }
+        return syncTime;
+    }
 
-        return findInAllIt != allSyncTimes.end() ? *findInAllIt : std::numeric_limits<std::uint64_t>::max();
+    [[nodiscard]] constexpr auto syncTagsInSpan(std::size_t portIndex, const InputSpanLike auto& in) const {
+        // N.B. tags are ordered and the available span may be shorter than the scanned range
+        const auto& syncTags = _syncTags[portIndex];
+        const auto  end      = std::ranges::lower_bound(syncTags, in.streamIndex + in.size(), {}, &SyncTag::index);
+        return std::ranges::subrange(syncTags.begin(), end);
     }
 
-    [[nodiscard]] constexpr std::size_t getAvailablePreSamples(const InputSpanLike auto& in, std::size_t syncIndex) {
+    [[nodiscard]] constexpr std::size_t getAvailablePreSamples(std::size_t portIndex, const InputSpanLike auto& in, std::size_t syncIndex) const {
         // Check if there’s an earlier sync tag that cannot be synchronized; if so, calculate available samples only up to that tag.
-        const auto foundTag = std::ranges::find_if(in.rawTags, [&](const auto& tag) { return getRelativeTagIndex(in, tag) < syncIndex && isSyncTag(tag); });
-        if (foundTag != in.rawTags.end()) {
-            return syncIndex - getRelativeTagIndex(in, *foundTag) - 1;
+        const auto& syncTags = _syncTags[portIndex];
+        if (!syncTags.empty() && syncTags.front().index - in.streamIndex < syncIndex) {
+            return syncIndex - (syncTags.front().index - in.streamIndex) - 1;
         }
         return syncIndex;
     }
 
-    [[nodiscard]] constexpr std::size_t getAvailablePostSamples(const InputSpanLike auto& in, std::size_t syncIndex) {
+    [[nodiscard]] constexpr std::size_t getAvailablePostSamples(std::size_t portIndex, const InputSpanLike auto& in, std::size_t syncIndex) const {
         // Check if there’s a later sync tag; if so, calculate available samples only up to that tag.
-        auto foundTag = std::ranges::find_if(in.rawTags, [&](const auto& tag) {
-            const std::size_t relativeTagIndex = getRelativeTagIndex(in, tag);
-            return relativeTagIndex > syncIndex && relativeTagIndex < in.size() && isSyncTag(tag);
-        });
-        if (foundTag != in.rawTags.end()) {
-            return getRelativeTagIndex(in, *foundTag) - syncIndex - 1;
+        const auto syncTags = syncTagsInSpan(portIndex, in);
+        const auto foundTag = std::ranges::find_if(syncTags, [&](const SyncTag& syncTag) { return syncTag.index - in.streamIndex > syncIndex; });
+        if (foundTag != syncTags.end()) {
+            return foundTag->index - in.streamIndex - syncIndex - 1;
         }
         return in.size() - syncIndex - 1;
     }
 
-    [[nodiscard]] std::size_t getNSamplesBeforeSyncTag(const InputSpanLike auto& in) const {
-        for (const auto& tag : in.rawTags) {
-            const std::size_t relativeTagIndex = getRelativeTagIndex(in, tag);
-            if (isSyncTag(tag) && relativeTagIndex != std::numeric_limits<std::size_t>::max()) {
-                return std::min(relativeTagIndex, in.size()); // tags are ordered, return distance to the first sync tag
-            }
-        }
-        return in.size();
+    [[nodiscard]] std::size_t getNSamplesBeforeSyncTag(std::size_t portIndex, const InputSpanLike auto& in) const {
+        const auto& syncTags = _syncTags[portIndex];
+        return syncTags.empty() ? in.size() : std::min(syncTags.front().index - in.streamIndex, in.size()); // tags are ordered, return distance to the first sync tag
     }
 
-    [[nodiscard]] constexpr bool isTimeDifferenceWithinTolerance(std::uint64_t t1, std::uint64_t t2) { return ((t1 > t2) ? t1 - t2 : t2 - t1) < tolerance; }
+    [[nodiscard]] std::size_t getNSamplesBeforeLastSyncTag(std::size_t portIndex, const InputSpanLike auto& in) const {
+        const auto syncTags = syncTagsInSpan(portIndex, in);
+        return syncTags.empty() ? in.size() : syncTags.back().index - in.streamIndex;
+    }
+
+    [[nodiscard]] constexpr bool isTimeDifferenceWithinTolerance(std::uint64_t t1, std::uint64_t t2) const { return ((t1 > t2) ? t1 - t2 : t2 - t1) < tolerance; }
 
     [[nodiscard]] constexpr bool isSyncTag(const gr::Tag& tag) const {
         const std::string keyTriggerName = gr::tag::TRIGGER_NAME.shortKey();
@@ -353,9 +454,6 @@ struct SyncBlock : public gr::Block<SyncBlock<T>, NoDefaultTagForwarding, SyncBl
         return 0ULL;
     }
 
-    [[nodiscard]] constexpr std::size_t getRelativeTagIndex(const InputSpanLike auto& in, const Tag& tag) const { //
-        return tag.index >= in.streamIndex ? tag.index - in.streamIndex : std::numeric_limits<std::size_t>::max();
-    }
 };
 
 } // namespace gr::basic
@@ -1,6 +1,7 @@
 #include <boost/ut.hpp>
 
 #include <gnuradio-4.0/basic/DataSink.hpp>
+#include <gnuradio-4.0/basic/FrequencyShift.hpp>
 #include <gnuradio-4.0/basic/FunctionGenerator.hpp>
 #include <gnuradio-4.0/basic/Selector.hpp>
 #include <gnuradio-4.0/basic/SignalGenerator.hpp>
@@ -20,6 +21,7 @@ const boost::ut::suite KnownBlockTests = [] {
             "builtin_counter"s,              //
             "builtin_multiply"s,             //
             "gr::basic::DataSink"s,          //
+            "gr::basic::FrequencyShift"s,    //
             "gr::basic::FunctionGenerator"s, //
             "gr::basic::Selector"s,          //
             "gr::basic::SignalGenerator"s    //
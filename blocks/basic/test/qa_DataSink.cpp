@@ -838,6 +838,55 @@ const boost::ut::suite DataSinkTests = [] {
         expect(eq(std::vector(receivedData.begin(), receivedData.begin() + 5), expectedStart));
     };
 
+    "trigger history limit"_test = [] {
+        DataSink<float> sink({{"name", "test_sink"}, {"max_history_size", gr::Size_t(1000)}});
+        sink.init(sink.progress, sink.ioThreadPool);
+        expect(eq(sink.max_history_size.value, gr::Size_t(1000)));
+
+        auto isTrigger = [](std::string_view /* filterSpec */, const Tag&, const property_map& /* filter state */) { return trigger::MatchResult::Matching; };
+        auto callback  = [](auto&&) {};
+
+        expect(!sink.registerTriggerCallback(isTrigger, 1001, 10, callback)) << "pre-trigger window exceeding the limit is rejected";
+        expect(eq(sink.getTriggerPoller(isTrigger, 1001, 10), nullptr));
+        expect(sink.registerTriggerCallback(isTrigger, 1000, 10, callback));
+        auto poller = sink.getTriggerPoller(isTrigger, 500, 10);
+        expect(poller != nullptr);
+    };
+
+    "trigger history shrinks"_test = [] {
+        DataSink<float> sink({{"name", "test_sink"}, {"max_history_size", gr::Size_t(1000)}});
+        sink.init(sink.progress, sink.ioThreadPool);
+
+        auto                     isTrigger = [](std::string_view /* filterSpec */, const Tag&, const property_map& /* filter state */) { return trigger::MatchResult::Matching; };
+        const std::vector<float> samples(100UZ, 1.f);
+        const std::vector<Tag>   noTags;
+        auto                     processChunk = [&sink, &samples, &noTags] {
+            gr::detail::MergedInputSpan<float> inSpan(samples, noTags);
+            expect(sink.processBulk(inSpan) == work::Status::OK);
+        };
+
+        auto largePoller = sink.getTriggerPoller(isTrigger, 800, 10);
+        auto smallPoller = sink.getTriggerPoller(isTrigger, 300, 10);
+        processChunk();
+        expect(fatal(sink._history.has_value()));
+        expect(eq(sink._history->capacity(), 800UZ)) << "history sized for the largest pre-trigger window";
+
+        expect(sink.settings().set({{"max_history_size", gr::Size_t(500)}}).empty());
+        std::ignore = sink.settings().applyStagedParameters();
+        processChunk();
+        expect(eq(sink._history->capacity(), 500UZ)) << "lowered max_history_size shrinks the history";
+
+        largePoller.reset();
+        processChunk(); // listener of the released poller expires and is pruned
+        processChunk();
+        expect(eq(sink._history->capacity(), 300UZ)) << "history shrinks to the largest remaining pre-trigger window";
+
+        smallPoller.reset();
+        processChunk();
+        processChunk();
+        expect(!sink._history.has_value()) << "history released without trigger listeners";
+    };
+
     "non-blocking polling continuous mode"_test = [] {
         constexpr std::uint32_t kSamples = 200000;
 
@@ -880,6 +929,100 @@ const boost::ut::suite DataSinkTests = [] {
         expect(eq(samplesSeen + poller->drop_count, static_cast<std::size_t>(kSamples)));
     };
 
+    "blocking zero-copy polling continuous mode"_test = [] {
+        constexpr gr::Size_t kSamples = 200000;
+
+        gr::Graph  testGraph;
+        const auto tags = makeTestTags(0, 1000);
+        auto&      src  = testGraph.emplaceBlock<gr::testing::TagSource<float>>({{"n_samples_max", kSamples}, {"mark_tag", false}, {"signal_name", "test source"}, {"signal_unit", "test unit"}, {"signal_min", -42.f}, {"signal_max", 42.f}});
+        src._tags       = tags;
+        auto& delay     = testGraph.emplaceBlock<testing::Delay<float>>({{"delay_ms", kProcessingDelayMs}});
+        auto& sink      = testGraph.emplaceBlock<DataSink<float>>({{"name", "test_sink"}, {"signal_name", "test signal"}});
+
+        expect(eq(ConnectionResult::SUCCESS, testGraph.connect<"out">(src).to<"in">(delay)));
+        expect(eq(ConnectionResult::SUCCESS, testGraph.connect<"out">(delay).to<"in">(sink)));
+
+        auto runner = std::async([] {
+            std::shared_ptr<ZeroCopyStreamingPoller<float>> poller;
+            expect(spinUntil(4s, [&poller] {
+                poller = DataSinkRegistry::instance().getZeroCopyStreamingPoller<float>(DataSinkQuery::sinkName("test_sink"), BlockingMode::Blocking);
+                return poller != nullptr;
+            })) << boost::ut::fatal;
+            std::vector<float> received;
+            std::vector<Tag>   receivedTags;
+            bool               seenFinished = false;
+            while (!seenFinished) {
+                seenFinished = poller->finished;
+                while (poller->process([&received, &receivedTags](const auto& data, const auto& tags_) {
+                    auto absolute = tags_ | std::views::transform([&received](const auto& t) { return gr::Tag{t.index + received.size(), t.map}; });
+                    receivedTags.insert(receivedTags.end(), absolute.begin(), absolute.end());
+                    received.insert(received.end(), data.begin(), data.end());
+                })) {
+                }
+            }
+
+            return std::make_tuple(poller, received, receivedTags);
+        });
+
+        {
+            Scheduler sched{std::move(testGraph)};
+            expect(sched.runAndWait().has_value());
+        }
+
+        std::vector<float> expected(kSamples);
+        std::iota(expected.begin(), expected.end(), 0.0);
+
+        const auto& [poller, received, receivedTags] = runner.get();
+        const auto& [metadataTags, nonMetadataTags]  = extractMetadataTags(receivedTags);
+        expect(eq(received.size(), expected.size()));
+        expect(eq(received, expected));
+        expect(eq(nonMetadataTags.size(), tags.size()));
+        expect(eq(indexesMatch(nonMetadataTags, tags), true)) << fmt::format("{} != {}", formatList(nonMetadataTags), formatList(tags));
+        const auto metadata = latestMetadata(metadataTags);
+        expect(eq(metadata.signal_name.value_or("<unset>"), "test signal"s));
+        expect(eq(metadata.signal_unit.value_or("<unset>"), "test unit"s));
+        expect(eq(poller->drop_count.load(), 0UZ));
+    };
+
+    "non-blocking zero-copy polling continuous mode"_test = [] {
+        constexpr std::uint32_t kSamples = 200000;
+
+        gr::Graph testGraph;
+        auto&     src   = testGraph.emplaceBlock<gr::testing::TagSource<float>>({{"n_samples_max", kSamples}, {"mark_tag", false}});
+        auto&     delay = testGraph.emplaceBlock<testing::Delay<float>>({{"delay_ms", kProcessingDelayMs}});
+        auto&     sink  = testGraph.emplaceBlock<DataSink<float>>({{"name", "test_sink"}});
+
+        expect(eq(ConnectionResult::SUCCESS, testGraph.connect<"out">(src).to<"in">(delay)));
+        expect(eq(ConnectionResult::SUCCESS, testGraph.connect<"out">(delay).to<"in">(sink)));
+
+        auto polling = std::async([] {
+            std::shared_ptr<ZeroCopyStreamingPoller<float>> poller;
+            expect(spinUntil(4s, [&poller] {
+                poller = DataSinkRegistry::instance().getZeroCopyStreamingPoller<float>(DataSinkQuery::sinkName("test_sink"), BlockingMode::NonBlocking);
+                return poller != nullptr;
+            })) << boost::ut::fatal;
+
+            std::size_t samplesSeen  = 0;
+            bool        seenFinished = false;
+            while (!seenFinished) {
+                using namespace std::chrono_literals;
+                std::this_thread::sleep_for(20ms); // slow consumer -> must not block the graph
+
+                seenFinished = poller->finished.load();
+                while (poller->process([&samplesSeen](const auto& data) { samplesSeen += data.size(); })) {
+                }
+            }
+
+            return std::make_tuple(poller, samplesSeen);
+        });
+
+        Scheduler sched{std::move(testGraph)};
+        expect(sched.runAndWait().has_value());
+
+        const auto& [poller, samplesSeen] = polling.get();
+        expect(eq(samplesSeen + poller->drop_count, static_cast<std::size_t>(kSamples)));
+    };
+
     "data set poller"_test = [] {
         gr::Graph testGraph;
         auto&     source          = testGraph.emplaceBlock<testing::TagSource<float, testing::ProcessFunction::USE_PROCESS_BULK>>({{"n_samples_max", static_cast<gr::Size_t>(1024)}, {"signal_name", "test signal"}, {"signal_unit", "test unit"}, {"mark_tag", false}});
@@ -0,0 +1,81 @@
+#include <boost/ut.hpp>
+
+#include <complex>
+#include <numbers>
+#include <vector>
+
+#include <gnuradio-4.0/Block.hpp>
+#include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/Scheduler.hpp>
+
+#include <gnuradio-4.0/basic/FrequencyShift.hpp>
+#include <gnuradio-4.0/testing/NullSources.hpp>
+
+const boost::ut::suite<"FrequencyShift"> frequencyShiftTests = [] {
+    using namespace boost::ut;
+    using namespace boost::ut::reflection;
+    using namespace gr;
+    using namespace gr::basic;
+    using namespace gr::testing;
+
+    "tone shifted to DC"_test = []<typename T>() {
+        constexpr float  sampleRate = 1000.f;
+        constexpr double toneFreq   = 125.;
+        for (const std::string mode : {"Exact", "Table", "Polynomial"}) {
+            FrequencyShift<T> shifter({{"sample_rate", sampleRate}, {"frequency_shift", -toneFreq}, {"nco_mode", mode}});
+            shifter.init(shifter.progress, shifter.ioThreadPool);
+
+            std::vector<std::complex<T>> input(1000UZ);
+            for (std::size_t i = 0UZ; i < input.size(); i++) {
+                input[i] = std::polar(T(1), static_cast<T>(2. * std::numbers::pi * toneFreq * static_cast<double>(i) / static_cast<double>(sampleRate)));
+            }
+            std::vector<std::complex<T>> output(input.size());
+            expect(eq(shifter.processBulk(input, output), work::Status::OK));
+            for (std::size_t i = 0UZ; i < output.size(); i++) {
+                expect(approx(std::abs(output[i] - std::complex<T>(1, 0)), T(0), T(1e-4))) << fmt::format("<{}> mode {}: sample {}: {}", type_name<T>(), mode, i, output[i]);
+            }
+        }
+    } | std::tuple<float, double>{};
+
+    "phase continuity across calls and frequency changes"_test = [] {
+        FrequencyShift<float> shifter({{"sample_rate", 100.f}, {"frequency_shift", 10.}, {"phase", 0.5}});
+        shifter.init(shifter.progress, shifter.ioThreadPool);
+
+        std::vector<std::complex<float>> ones(10UZ, {1.f, 0.f});
+        std::vector<std::complex<float>> output(ones.size());
+        std::ignore = shifter.processBulk(ones, output);
+        expect(approx(std::arg(output[0]), 0.5f, 1e-5f));
+        // 10 samples at 0.1 cycles/sample -> one full turn -> next phase equals initial phase
+        expect(approx(shifter._nco.phase(), 0.5, 1e-5));
+
+        expect(shifter.settings().set({{"frequency_shift", 20.}}).empty());
+        std::ignore = shifter.settings().applyStagedParameters();
+        expect(approx(shifter._nco.phase(), 0.5, 1e-5)) << "frequency change keeps the phase";
+        expect(approx(shifter._nco.frequency(), 0.2, 1e-6));
+    };
+
+    "invalid settings"_test = [] {
+        FrequencyShift<float> shifter;
+        shifter.nco_mode = "Unknown";
+        expect(throws([&shifter] { shifter.settingsChanged({}, {}); })) << "unknown nco_mode";
+        shifter.nco_mode    = "Table";
+        shifter.sample_rate = 0.f;
+        expect(throws([&shifter] { shifter.settingsChanged({}, {}); })) << "invalid sample_rate";
+    };
+
+    "FrequencyShift in graph"_test = [] {
+        constexpr gr::Size_t nSamples = 10000U;
+        Graph                testGraph;
+        auto&                src     = testGraph.emplaceBlock<ConstantSource<std::complex<float>>>({{"n_samples_max", nSamples}});
+        auto&                shifter = testGraph.emplaceBlock<FrequencyShift<float>>({{"sample_rate", 1000.f}, {"frequency_shift", 100.}});
+        auto&                sink    = testGraph.emplaceBlock<CountingSink<std::complex<float>>>();
+        expect(eq(ConnectionResult::SUCCESS, testGraph.connect<"out">(src).to<"in">(shifter)));
+        expect(eq(ConnectionResult::SUCCESS, testGraph.connect<"out">(shifter).to<"in">(sink)));
+
+        scheduler::Simple sched{std::move(testGraph)};
+        expect(sched.runAndWait().has_value());
+        expect(eq(sink.count, nSamples));
+    };
+};
+
+int main() { /* not needed for UT */ }
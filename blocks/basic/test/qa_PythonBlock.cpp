@@ -1,3 +1,6 @@
+#include <cstdint>
+#include <set>
+
 #include <boost/ut.hpp>
 
 #include <gnuradio-4.0/Graph.hpp>
@@ -268,6 +271,141 @@ def process_bulk(ins, outs):
         expect(eq(sink._nSamplesProduced, 5U)) << "sinkOne did not consume enough input samples";
         expect(eq(sink._samples, std::vector<float>{0.f, 2.f, 4.f, 6.f, 8.f})) << fmt::format("mismatch of vector {}", sink._samples);
     };
+
+    "min_chunk_size batching and persistent argument lists"_test = [] {
+        std::string pythonScript = R"x(
+n_calls = 0
+n_small_chunks = 0
+list_ids = set()
+
+def process_bulk(ins, outs):
+    global n_calls, n_small_chunks
+    n_calls += 1
+    if len(ins[0]) < 100:
+        n_small_chunks += 1 # only the remainder before the end-of-stream is allowed to be smaller
+    list_ids.add(id(ins))
+    list_ids.add(id(outs))
+    outs[0][:] = ins[0] * 2
+    this_block.setSettings({"n_calls": str(n_calls), "n_small_chunks": str(n_small_chunks), "n_list_ids": str(len(list_ids))})
+)x";
+
+        using namespace gr::testing;
+        constexpr gr::Size_t nSamples = 1050U;
+        Graph                graph;
+        auto&                src   = graph.emplaceBlock<TagSource<float>>({{"n_samples_max", nSamples}, {"mark_tag", false}});
+        auto&                block = graph.emplaceBlock<PythonBlock<float>>({{"n_inputs", 1U}, {"n_outputs", 1U}, {"min_chunk_size", 100U}, {"pythonScript", pythonScript}});
+        auto&                sink  = graph.emplaceBlock<TagSink<float, ProcessFunction::USE_PROCESS_BULK>>({{"n_samples_expected", nSamples}});
+
+        expect(gr::ConnectionResult::SUCCESS == graph.connect(src, "out"s, block, "inputs#0"s));
+        expect(gr::ConnectionResult::SUCCESS == graph.connect(block, "outputs#0"s, sink, "in"s));
+        expect(eq(block.inputs[0].min_samples, 100UZ));
+
+        scheduler::Simple sched{std::move(graph)};
+        expect(sched.runAndWait().has_value());
+
+        expect(eq(sink._nSamplesProduced, nSamples)) << "sink did not consume enough input samples";
+        expect(eq(sink._samples.size(), static_cast<std::size_t>(nSamples)));
+        for (std::size_t i = 0UZ; i < sink._samples.size(); i++) {
+            expect(eq(sink._samples[i], 2.f * static_cast<float>(i))) << fmt::format("sample mismatch at index {}", i);
+        }
+
+        const auto& settings = block.getSettings();
+        expect(settings.contains("n_calls"));
+        expect(le(std::stoul(settings.at("n_calls")), static_cast<std::size_t>(nSamples) / 100UZ + 1UZ)) << "small chunks should be batched";
+        expect(le(std::stoul(settings.at("n_small_chunks")), 1UZ)) << "only the final chunk may be smaller than 'min_chunk_size'";
+        expect(eq(settings.at("n_list_ids"), "2"s)) << "argument lists should be re-used between calls";
+    };
+
+    "isolated execution (sub-interpreter with own GIL)"_test = [] {
+        // N.B. no NumPy within sub-interpreters -> 'ins' and 'outs' are typed memoryviews
+        std::string pythonScript = R"x(
+def process_bulk(ins, outs):
+    for i in range(len(ins)):
+        for j in range(len(ins[i])):
+            outs[i][j] = ins[i][j] * 2
+)x";
+
+        using namespace gr::testing;
+        constexpr gr::Size_t                                            nSamples = 100U;
+        constexpr std::size_t                                           nChains  = 2UZ; // each PythonBlock runs in its own sub-interpreter
+        Graph                                                           graph;
+        std::vector<TagSink<float, ProcessFunction::USE_PROCESS_BULK>*> sinks;
+        for (std::size_t i = 0UZ; i < nChains; i++) {
+            auto& src   = graph.emplaceBlock<TagSource<float>>({{"n_samples_max", nSamples}, {"mark_tag", false}});
+            auto& block = graph.emplaceBlock<PythonBlock<float>>({{"n_inputs", 1U}, {"n_outputs", 1U}, {"execution", "isolated"s}, {"pythonScript", pythonScript}});
+            auto& sink  = graph.emplaceBlock<TagSink<float, ProcessFunction::USE_PROCESS_BULK>>({{"n_samples_expected", nSamples}});
+            expect(block._interpreter.isIsolated());
+            expect(gr::ConnectionResult::SUCCESS == graph.connect(src, "out"s, block, "inputs#0"s));
+            expect(gr::ConnectionResult::SUCCESS == graph.connect(block, "outputs#0"s, sink, "in"s));
+            sinks.push_back(std::addressof(sink));
+        }
+
+        scheduler::Simple sched{std::move(graph)};
+        expect(sched.runAndWait().has_value());
+
+        for (const auto* sink : sinks) {
+            expect(eq(sink->_nSamplesProduced, nSamples)) << "sink did not consume enough input samples";
+            std::vector<float> expected(nSamples);
+            for (std::size_t i = 0UZ; i < expected.size(); i++) {
+                expected[i] = 2.f * static_cast<float>(i);
+            }
+            expect(eq(sink->_samples, expected));
+        }
+    };
+
+    "isolated execution on a multi-threaded scheduler"_test = [] {
+        std::string pythonScript = R"x(
+list_ids = set()
+
+def process_bulk(ins, outs):
+    list_ids.add(id(ins))
+    list_ids.add(id(outs))
+    src = ins[0]
+    dst = outs[0]
+    for j in range(len(src)):
+        dst[j] = src[j] * 2
+    this_block.setSettings({"n_list_ids": str(len(list_ids))})
+)x";
+
+        using namespace gr::testing;
+        constexpr gr::Size_t                                            nSamples = 100'000U;
+        constexpr std::size_t                                           nChains  = 4UZ; // N.B. concurrently executed on different worker threads, each using its own GIL
+        Graph                                                           graph;
+        std::vector<PythonBlock<float>*>                                blocks;
+        std::vector<TagSink<float, ProcessFunction::USE_PROCESS_BULK>*> sinks;
+        for (std::size_t i = 0UZ; i < nChains; i++) {
+            auto& src   = graph.emplaceBlock<TagSource<float>>({{"n_samples_max", nSamples}, {"mark_tag", false}});
+            auto& block = graph.emplaceBlock<PythonBlock<float>>({{"n_inputs", 1U}, {"n_outputs", 1U}, {"execution", "isolated"s}, {"pythonScript", pythonScript}});
+            auto& sink  = graph.emplaceBlock<TagSink<float, ProcessFunction::USE_PROCESS_BULK>>({{"n_samples_expected", nSamples}});
+            expect(block._interpreter.isIsolated());
+            expect(gr::ConnectionResult::SUCCESS == graph.connect(src, "out"s, block, "inputs#0"s));
+            expect(gr::ConnectionResult::SUCCESS == graph.connect(block, "outputs#0"s, sink, "in"s));
+            blocks.push_back(std::addressof(block));
+            sinks.push_back(std::addressof(sink));
+        }
+
+        scheduler::Simple<scheduler::ExecutionPolicy::multiThreaded> sched{std::move(graph)};
+        expect(sched.runAndWait().has_value());
+
+        std::vector<float> expected(nSamples);
+        for (std::size_t i = 0UZ; i < expected.size(); i++) {
+            expected[i] = 2.f * static_cast<float>(i);
+        }
+        for (const auto* sink : sinks) {
+            expect(eq(sink->_nSamplesProduced, nSamples)) << "sink did not consume enough input samples";
+            expect(sink->_samples == expected) << "sample mismatch";
+        }
+        std::set<std::int64_t> interpreterIds;
+        for (auto* block : blocks) {
+            const auto& settings = block->getSettings();
+            expect(fatal(settings.contains("n_list_ids")));
+            expect(eq(settings.at("n_list_ids"), "2"s)) << "memoryview argument lists should be re-used between calls";
+            interpreterIds.insert(block->_interpreter.id());
+        }
+        // N.B. distinct sub-interpreters, each owning its GIL -> the blocks' Python code does not serialise on a shared lock
+        expect(eq(interpreterIds.size(), nChains)) << "each block should execute in its own sub-interpreter";
+        expect(!interpreterIds.contains(std::int64_t{0})) << "no block should execute in the shared main interpreter";
+    };
 };
 
 int main() { /* tests are statically executed */ }
@@ -27,6 +27,7 @@ struct TestParams {
     std::vector<gr::Size_t>                        nSamplesSelectorInput; // check back pressure
     bool                                           syncCombinedPorts{true};
     bool                                           ignoreOrder{false};
+    bool                                           zeroCopy{false};
 };
 
 void execute_selector_test(TestParams params) {
@@ -65,6 +66,11 @@ void execute_selector_test(TestParams params) {
     expect(monitorSink->settings().applyStagedParameters().forwardParameters.empty());
     expect(gr::ConnectionResult::SUCCESS == graph.connect<"monitor">(*selector).to<"in">(*monitorSink));
 
+    if (params.zeroCopy) {
+        const std::size_t nPureRoutes = static_cast<std::size_t>(std::ranges::count_if(params.mapping, [&params](const auto& route) { return std::ranges::count(params.mapping, route.second, &std::pair<gr::Size_t, gr::Size_t>::second) == 1; }));
+        expect(eq(gr::basic::resolveZeroCopyRoutes(graph, *selector), nPureRoutes));
+    }
+
     gr::scheduler::Simple sched{std::move(graph)};
     expect(sched.runAndWait().has_value());
 
@@ -323,6 +329,40 @@ const boost::ut::suite SelectorTest = [] {
             .nSamplesSelectorInput       = {0, 0, 0},
             .ignoreOrder                 = false});
     };
+
+    // Tests with zero-copy (aliased) routes
+
+    "Selector<T> one for all, with back pressure, zero-copy"_test = [tag1, tag2, tag3] {
+        execute_selector_test({.nSamples = 5,                                                   //
+            .mapping                     = {{1, 0}, {1, 1}, {1, 2}},                            //
+            .inValues                    = {{1}, {2}, {3}},                                     //
+            .outValues                   = {{2, 2, 2, 2, 2}, {2, 2, 2, 2, 2}, {2, 2, 2, 2, 2}}, //
+            .inTags                      = {{tag1}, {tag2}, {tag3}},                            //
+            .outTags                     = {{tag2}, {tag2}, {tag2}},
+            .monitorSource               = -1U, //
+            .monitorValues               = {},  //
+            .backPressure                = true,
+            .nSamplesSelectorInput       = {5, 0, 5}, // aliased input is drained despite back pressure
+            .ignoreOrder                 = false,
+            .zeroCopy                    = true});
+    };
+
+    "Selector<T> mixed 1->N and N->1 routes, zero-copy"_test = [tag1, tag2, tag3] {
+        const Tag newTag1{2, tag1.map};
+        const Tag newTag3{7, tag3.map};
+        execute_selector_test({.nSamples = 5,                                                                     //
+            .mapping                     = {{0, 0}, {1, 1}, {0, 2}, {2, 2}},                                      // outputs#0/#1 are aliased, outputs#2 merges (copies) inputs #0 and #2
+            .inValues                    = {{1}, {2}, {3}},                                                       //
+            .outValues                   = {{1, 1, 1, 1, 1}, {2, 2, 2, 2, 2}, {1, 3, 1, 3, 1, 3, 1, 3, 1, 3}}, //
+            .inTags                      = {{tag1}, {tag2}, {tag3}},                                              //
+            .outTags                     = {{tag1}, {tag2}, {newTag1, newTag3}},
+            .monitorSource               = -1U, //
+            .monitorValues               = {},  //
+            .backPressure                = false,
+            .nSamplesSelectorInput       = {0, 0, 0},
+            .ignoreOrder                 = false,
+            .zeroCopy                    = true});
+    };
 };
 
 int main() { /* not needed for UT */ }
@@ -292,4 +292,65 @@ const boost::ut::suite<"StreamToDataSet test"> streamToDataSetTest = [] {
     "single trigger (+pre/post, n_max)"_test = [&runTestDataSet, &expectedValues, &nMaxSamples] { runTestDataSet(50U, "CMD_DIAG_TRIGGER1", 7, 7, expectedValues, {3UZ, 2UZ, 3UZ, 1UZ}, nMaxSamples); };
 };
 
+const boost::ut::suite<"MultiStreamToDataSet test"> multiStreamToDataSetTest = [] {
+    using namespace boost::ut;
+    using namespace gr;
+    using namespace gr::basic;
+    using namespace gr::testing;
+
+    "equivalence to individual StreamToDataSet blocks"_test = [](const std::pair<gr::Size_t, gr::Size_t>& prePostSamples) {
+        const auto [preSamples, postSamples] = prePostSamples;
+        constexpr float                sample_rate = 1'000.f;
+        const std::vector<std::string> filters     = {"[CMD_BP_START/FAIR.SELECTOR.C=1:S=1:P=1, CMD_BP_START/FAIR.SELECTOR.C=1:S=1:P=2]", //
+                "[CMD_BP_START/FAIR.SELECTOR.C=1:S=1:P=1, CMD_BP_START/^FAIR.SELECTOR.C=1:S=1:P=2]", "CMD_DIAG_TRIGGER1"};
+        Graph graph;
+
+        auto& tagSrc = graph.emplaceBlock<TagSource<float, ProcessFunction::USE_PROCESS_BULK>>({{"sample_rate", sample_rate}, //
+            {"n_samples_max", gr::Size_t(50U)}, {"name", "TagSource"}, {"verbose_console", false}, {"repeat_tags", false}, {"mark_tag", false}});
+        tagSrc._tags = {
+            genTrigger(5, "CMD_BP_START", "CMD_BP_START/FAIR.SELECTOR.C=1:S=1:P=1"),  // start
+            genTrigger(8, "CMD_DIAG_TRIGGER1", "CMD_DIAG_TRIGGER1"),                  // single trigger
+            genTrigger(10, "CMD_BP_START", "CMD_BP_START/FAIR.SELECTOR.C=1:S=1:P=2"), // stop
+            genTrigger(12, "CMD_DIAG_TRIGGER1", "CMD_DIAG_TRIGGER1"),                 // single trigger and end trigger for "including" mode
+            genTrigger(15, "CMD_BP_START", "CMD_BP_START/FAIR.SELECTOR.C=1:S=1:P=1"), // start
+            genTrigger(20, "CMD_BP_START", "CMD_BP_START/FAIR.SELECTOR.C=1:S=1:P=1"), // start
+            genTrigger(25, "CMD_BP_START", "CMD_BP_START/FAIR.SELECTOR.C=1:S=1:P=2"), // stop
+            genTrigger(27, "CMD_DIAG_TRIGGER1", "CMD_DIAG_TRIGGER1"),                 // single trigger and end trigger for "including" mode
+            genTrigger(30, "CMD_BP_START", "CMD_BP_START/FAIR.SELECTOR.C=1:S=1:P=2"), // stop
+            genTrigger(32, "CMD_DIAG_TRIGGER1", "CMD_DIAG_TRIGGER1")                  // single trigger and end trigger for "including" mode
+        };
+
+        auto& multiFilter = graph.emplaceBlock<MultiStreamToDataSet<float>>({{"filters", filters}, {"n_pre", preSamples}, {"n_post", postSamples}, {"n_max", gr::Size_t(100000U)}});
+        expect(eq(multiFilter.outputs.size(), filters.size()));
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(tagSrc).template to<"in">(multiFilter)));
+
+        std::vector<TagSink<DataSet<float>, ProcessFunction::USE_PROCESS_BULK>*> multiSinks;
+        std::vector<TagSink<DataSet<float>, ProcessFunction::USE_PROCESS_BULK>*> referenceSinks;
+        for (std::size_t i = 0UZ; i < filters.size(); i++) {
+            auto& reference = graph.emplaceBlock<StreamToDataSet<float>>({{"filter", filters[i]}, {"n_pre", preSamples}, {"n_post", postSamples}, {"n_max", gr::Size_t(100000U)}});
+            multiSinks.push_back(std::addressof(graph.emplaceBlock<TagSink<DataSet<float>, ProcessFunction::USE_PROCESS_BULK>>({{"name", fmt::format("multiSink#{}", i)}, {"log_samples", true}})));
+            referenceSinks.push_back(std::addressof(graph.emplaceBlock<TagSink<DataSet<float>, ProcessFunction::USE_PROCESS_BULK>>({{"name", fmt::format("referenceSink#{}", i)}, {"log_samples", true}})));
+            expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(tagSrc).template to<"in">(reference)));
+            expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(reference).template to<"in">(*referenceSinks.back())));
+            expect(eq(gr::ConnectionResult::SUCCESS, graph.connect(multiFilter, fmt::format("outputs#{}", i), *multiSinks.back(), "in")));
+        }
+
+        gr::scheduler::Simple sched{std::move(graph)};
+        expect(sched.runAndWait().has_value());
+
+        for (std::size_t i = 0UZ; i < filters.size(); i++) {
+            const auto& received = multiSinks[i]->_samples;
+            const auto& expected = referenceSinks[i]->_samples;
+            expect(gt(expected.size(), 0UZ)) << fmt::format("filter {} produced no reference DataSet", filters[i]);
+            expect(eq(received.size(), expected.size())) << fmt::format("filter {}", filters[i]);
+            for (std::size_t j = 0UZ; j < std::min(received.size(), expected.size()); j++) {
+                expect(std::ranges::equal(received[j].signal_values, expected[j].signal_values)) << fmt::format("filter {} DataSet#{}", filters[i], j);
+                expect(std::ranges::equal(received[j].axis_values, expected[j].axis_values)) << fmt::format("filter {} DataSet#{}", filters[i], j);
+                expect(fatal(eq(received[j].timing_events.size(), 1UZ)));
+                expect(eq(received[j].timing_events[0].size(), expected[j].timing_events[0].size())) << fmt::format("filter {} DataSet#{}", filters[i], j);
+            }
+        }
+    } | std::vector<std::pair<gr::Size_t, gr::Size_t>>{{0U, 0U}, {7U, 7U}};
+};
+
 int main() { /* not needed for UT */ }
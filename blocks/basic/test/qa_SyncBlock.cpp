@@ -2,10 +2,13 @@
 #include <gnuradio-4.0/Graph.hpp>
 #include <gnuradio-4.0/Scheduler.hpp>
 #include <gnuradio-4.0/basic/SyncBlock.hpp>
+#include <gnuradio-4.0/testing/Delay.hpp>
 #include <gnuradio-4.0/testing/TagMonitors.hpp>
 
 #include <fmt/format.h>
 
+#include <thread>
+
 struct TestParams {
     std::string   testName       = "";
     gr::Size_t    nSamples       = 0U;                                        // 0 -> take inValues[i].size()
@@ -200,6 +203,82 @@ const boost::ut::suite SyncBlockTests = [] {
             .expectedTags     = {{genDropTag(0, 68000), genSyncTag(32'000, 100)}, {genDropTag(0, 69000), genSyncTag(32'000, 100)}}, //
             .expectedNSamples = 231'000});
     };
+
+    "SyncBlock max_history_size exceeding buffer size"_test = [] {
+        // without limiting the history to the buffer size, the first input would stall the graph waiting for its sync partner
+        gr::Graph graph;
+        auto&     syncBlock = graph.emplaceBlock<SyncBlock<int>>({{"n_ports", gr::Size_t(2)}, {"max_history_size", gr::Size_t(10'000'000)}, {"tolerance", 2ULL}});
+
+        const std::vector<std::vector<gr::Tag>>                       inTags = {{genSyncTag(100'000, 100)}, {genSyncTag(101'000, 100)}};
+        std::vector<TagSink<int, ProcessFunction::USE_PROCESS_BULK>*> sinks;
+        for (std::size_t i = 0; i < inTags.size(); i++) {
+            auto& source = graph.emplaceBlock<TagSource<int, ProcessFunction::USE_PROCESS_BULK>>({{"n_samples_max", gr::Size_t(300'000)}, {"verbose_console", false}, {"disconnect_on_done", false}});
+            source._tags = inTags[i];
+            sinks.push_back(std::addressof(graph.emplaceBlock<TagSink<int, ProcessFunction::USE_PROCESS_BULK>>({{"verbose_console", false}, {"disconnect_on_done", false}, {"log_samples", false}})));
+            expect(gr::ConnectionResult::SUCCESS == graph.connect(source, "out"s, syncBlock, "inputs#"s + std::to_string(i)));
+            expect(gr::ConnectionResult::SUCCESS == graph.connect(syncBlock, "outputs#"s + std::to_string(i), *sinks[i], "in"s));
+        }
+
+        gr::scheduler::Simple sched{std::move(graph)};
+        expect(sched.runAndWait().has_value());
+
+        expect(gt(sinks[0]->_nSamplesProduced, 0U));
+        expect(eq(sinks[0]->_nSamplesProduced, sinks[1]->_nSamplesProduced));
+        for (const auto* sink : sinks) {
+            expect(std::ranges::any_of(sink->_tags, [](const gr::Tag& tag) { return tag.map.contains(gr::tag::N_DROPPED_SAMPLES.shortKey()); })) << "dropped samples are reported";
+            expect(std::ranges::any_of(sink->_tags, [](const gr::Tag& tag) { return tag.map.contains(gr::tag::TRIGGER_TIME.shortKey()); })) << "streams are re-synchronised";
+        }
+    };
+
+    "SyncBlock timeout"_test = [] {
+        constexpr gr::Size_t    nSamples  = 1000U;
+        constexpr std::uint64_t timeoutMs = 50ULL;
+        auto                    hasTag    = [](const std::vector<gr::Tag>& tags, std::string_view key) { return std::ranges::any_of(tags, [key](const gr::Tag& tag) { return tag.map.contains(std::string(key)); }); };
+
+        struct SinkResult {
+            gr::Size_t           nSamples;
+            std::vector<gr::Tag> tags;
+        };
+
+        auto runTimeoutTest = [nSamples, timeoutMs](std::uint32_t stallMs, std::chrono::milliseconds idleBeforeStart) {
+            gr::Graph graph;
+            auto&     syncBlock = graph.emplaceBlock<SyncBlock<int>>({{"n_ports", gr::Size_t(2)}, {"tolerance", 2ULL}, {"timeout", timeoutMs}});
+
+            const std::vector<std::vector<gr::Tag>>                       inTags = {{genSyncTag(100, 100), genSyncTag(600, 200)}, {genSyncTag(100, 100), genSyncTag(600, 200)}};
+            std::vector<TagSink<int, ProcessFunction::USE_PROCESS_BULK>*> sinks;
+            for (std::size_t i = 0; i < inTags.size(); i++) {
+                auto& source = graph.emplaceBlock<TagSource<int, ProcessFunction::USE_PROCESS_BULK>>({{"n_samples_max", nSamples}, {"verbose_console", false}, {"disconnect_on_done", false}});
+                source._tags = inTags[i];
+                auto& delay  = graph.emplaceBlock<gr::testing::Delay<int>>({{"delay_ms", i == 1UZ ? stallMs : 0U}}); // stalls the second input
+                sinks.push_back(std::addressof(graph.emplaceBlock<TagSink<int, ProcessFunction::USE_PROCESS_BULK>>({{"verbose_console", false}, {"disconnect_on_done", false}, {"log_samples", false}})));
+                expect(gr::ConnectionResult::SUCCESS == graph.connect(source, "out"s, delay, "in"s));
+                expect(gr::ConnectionResult::SUCCESS == graph.connect(delay, "out"s, syncBlock, "inputs#"s + std::to_string(i)));
+                expect(gr::ConnectionResult::SUCCESS == graph.connect(syncBlock, "outputs#"s + std::to_string(i), *sinks[i], "in"s));
+            }
+
+            std::this_thread::sleep_for(idleBeforeStart);
+            gr::scheduler::Simple sched{std::move(graph)};
+            expect(sched.runAndWait().has_value());
+            std::vector<SinkResult> results;
+            for (const auto* sink : sinks) {
+                results.push_back({sink->_nSamplesProduced, sink->_tags});
+            }
+            return results;
+        };
+
+        // second input stalls past 'timeout' -> the first input's samples before its last sync tag are dropped, re-sync on the second tag
+        for (const SinkResult& sink : runTimeoutTest(static_cast<std::uint32_t>(4ULL * timeoutMs), std::chrono::milliseconds(0))) {
+            expect(eq(sink.nSamples, nSamples - 600U)) << "samples after the re-synchronisation are forwarded";
+            expect(hasTag(sink.tags, gr::tag::N_DROPPED_SAMPLES.shortKey())) << "dropped samples are tagged";
+            expect(std::ranges::any_of(sink.tags, [](const gr::Tag& tag) { return tag.map.contains(gr::tag::TRIGGER_TIME.shortKey()) && std::get<std::uint64_t>(tag.map.at(gr::tag::TRIGGER_TIME.shortKey())) == 200ULL; })) << "re-synchronised on the second sync tag";
+        }
+
+        // no stall: an idle period between construction and start must not count towards the time-out
+        for (const SinkResult& sink : runTimeoutTest(0U, std::chrono::milliseconds(4ULL * timeoutMs))) {
+            expect(eq(sink.nSamples, nSamples)) << "all samples are forwarded";
+            expect(!hasTag(sink.tags, gr::tag::N_DROPPED_SAMPLES.shortKey())) << "no samples are dropped";
+        }
+    };
 };
 
 int main() {}
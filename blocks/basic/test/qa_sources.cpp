@@ -83,14 +83,47 @@ const boost::ut::suite TagTests = [] {
             // expected values corresponds to sample_rate = 1024., frequency = 128., amplitude = 1., offset = 0., phase = pi/4.
             std::map<std::string, std ::vector<double>> expResults = {{"Const", {1., 1., 1., 1., 1., 1., 1., 1., 1., 1., 1., 1., 1., 1., 1., 1.}}, {"Sin", {0.707106, 1., 0.707106, 0., -0.707106, -1., -0.707106, 0., 0.707106, 1., 0.707106, 0., -0.707106, -1., -0.707106, 0.}}, {"Cos", {0.707106, 0., -0.707106, -1., -0.7071067, 0., 0.707106, 1., 0.707106, 0., -0.707106, -1., -0.707106, 0., 0.707106, 1.}}, {"Square", {1., 1., 1., -1., -1., -1., -1., 1., 1., 1., 1., -1., -1., -1., -1., 1.}}, {"Saw", {0.25, 0.5, 0.75, -1., -0.75, -0.5, -0.25, 0., 0.25, 0.5, 0.75, -1., -0.75, -0.5, -0.25, 0.}}, {"Triangle", {0.5, 1., 0.5, 0., -0.5, -1., -0.5, 0., 0.5, 1., 0.5, 0., -0.5, -1., -0.5, 0.}}};
 
+            std::vector<double> dummyInput(N);
+            std::vector<double> values(N);
+            expect(eq(signalGen.processBulk(dummyInput, values), work::Status::OK));
             for (std::size_t i = 0; i < N; i++) {
-                const auto val = signalGen.processOne(0);
+                const auto val = values[i];
                 const auto exp = expResults[sig][i] + offset;
                 expect(approx(exp, val, 1e-5)) << fmt::format("SignalGenerator for signal: {} and i: {} does not match.", sig, i);
             }
         }
     };
 
+    "SignalGenerator NCO fast path test"_test = []<typename T>() {
+        constexpr std::size_t N          = 1000UZ;
+        constexpr double      sampleRate = 2048.;
+        constexpr double      frequency  = 100.;
+        constexpr double      phase      = 0.3;
+        for (const std::string sig : {"Sin", "Cos"}) {
+            for (const std::string mode : {"Table", "Polynomial"}) {
+                const property_map params{{"signal_type", sig}, {"sample_rate", static_cast<float>(sampleRate)}, {"frequency", T(frequency)}, {"amplitude", T(2.)}, {"offset", T(0.5)}, {"phase", T(phase)}, {"nco_mode", mode}};
+                SignalGenerator<T> fastOne(params); // one sample per processBulk(..) call
+                SignalGenerator<T> fastBulk(params);
+                fastOne.init(fastOne.progress, fastOne.ioThreadPool);
+                fastBulk.init(fastBulk.progress, fastBulk.ioThreadPool);
+                expect(fastOne._useNco) << fmt::format("{} {} uses NCO", sig, mode);
+
+                std::vector<T> bulk(N);
+                std::vector<T> dummyInput(N);
+                expect(eq(fastBulk.processBulk(std::span(dummyInput).first(N / 3), std::span(bulk).first(N / 3)), work::Status::OK));
+                expect(eq(fastBulk.processBulk(std::span(dummyInput).subspan(N / 3), std::span(bulk).subspan(N / 3)), work::Status::OK));
+                for (std::size_t i = 0; i < N; i++) {
+                    const double phi = 2. * std::numbers::pi * frequency * static_cast<double>(i) / sampleRate + phase;
+                    const auto   exp = static_cast<T>(2. * (sig == "Sin" ? std::sin(phi) : std::cos(phi)) + 0.5);
+                    T            one{};
+                    expect(eq(fastOne.processBulk(std::span(dummyInput).first(1UZ), std::span(&one, 1UZ)), work::Status::OK));
+                    expect(approx(one, exp, T(1e-4))) << fmt::format("<{}> {} {} single-sample sample {}", gr::meta::type_name<T>(), sig, mode, i);
+                    expect(approx(bulk[i], exp, T(1e-4))) << fmt::format("<{}> {} {} processBulk sample {}", gr::meta::type_name<T>(), sig, mode, i);
+                }
+            }
+        }
+    } | std::tuple<float, double>{};
+
     "SignalGenerator ImChart test"_test = [] {
         const std::size_t        N = 512; // test points
         std::vector<std::string> signals{"Const", "Sin", "Cos", "Square", "Saw", "Triangle"};
@@ -100,7 +133,8 @@ const boost::ut::suite TagTests = [] {
 
             std::vector<double> xValues(N), yValues(N);
             std::iota(xValues.begin(), xValues.end(), 0);
-            std::ranges::generate(yValues, [&signalGen]() { return signalGen.processOne(0); });
+            std::vector<double> dummyInput(N);
+            expect(eq(signalGen.processBulk(dummyInput, yValues), work::Status::OK));
 
             fmt::println("Chart {}\n\n", sig);
             auto chart = gr::graphs::ImChart<128, 16>({{0., static_cast<double>(N)}, {-2.6, 2.6}});
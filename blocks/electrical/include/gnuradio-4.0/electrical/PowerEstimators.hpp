@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <cmath>
 #include <numbers>
+#include <variant>
 #include <vector>
 
 #include <gnuradio-4.0/Block.hpp>
@@ -44,28 +45,39 @@ applies low-pass filters to calculate average values, and outputs decimated resu
 
     GR_MAKE_REFLECTABLE(PowerMetrics, U, I, P, Q, S, U_rms, I_rms, sample_rate, decim);
 
-    // private state for exponential moving average (EMA)
-    using FilterImpl = std::conditional_t<UncertainValueLike<T>, filter::ErrorPropagatingFilter<T>, filter::Filter<meta::fundamental_base_value_type_t<T>>>;
+    // private state for exponential moving average (EMA), N.B. only the state of the variant matching T is instantiated
+    using FilterImpl = filter::ErrorPropagatingFilter<T>;
+    template<typename TState, bool enabled>
+    using StateIf = std::conditional_t<enabled, TState, std::monostate>;
 
-    std::array<FilterImpl, nPhases> _lpVoltageSquared;
-    std::array<FilterImpl, nPhases> _lpCurrentSquared;
-    std::array<FilterImpl, nPhases> _lpActivePower;
+    // uncertain types: per-sample error-propagating filters per phase and quantity
+    [[no_unique_address]] StateIf<std::array<FilterImpl, nPhases>, UncertainValueLike<T>> _lpVoltageSquared;
+    [[no_unique_address]] StateIf<std::array<FilterImpl, nPhases>, UncertainValueLike<T>> _lpCurrentSquared;
+    [[no_unique_address]] StateIf<std::array<FilterImpl, nPhases>, UncertainValueLike<T>> _lpActivePower;
+
+    // other types: all (power, voltage², current²) x nPhases low-pass filters evaluated as one vectorised filter bank
+    constexpr static std::size_t                                                                                         kNChannels = 3UZ * nPhases;
+    [[no_unique_address]] StateIf<filter::MultiChannelFilter<meta::fundamental_base_value_type_t<T>, kNChannels>, !UncertainValueLike<T>> _lpAll;
+    [[no_unique_address]] StateIf<std::vector<meta::fundamental_base_value_type_t<T>>, !UncertainValueLike<T>>                            _lpFrames; // interleaved [p, u², i²] x nPhases per sample
 
     void initFilters() {
         using namespace gr::filter;
         using ValueType = meta::fundamental_base_value_type_t<T>;
 
         const double cutoff_frequency = 0.5 * static_cast<double>(sample_rate) / static_cast<double>(decim);
-        const auto   filter_init      = [&, cutoff_frequency](auto) {                                                    //
-            return FilterImpl(iir::designFilter<ValueType>(Type::LOWPASS,                                         //
-                       FilterParameters{.order = 2UZ, .fLow = cutoff_frequency, .fs = static_cast<double>(sample_rate)}, //
-                       iir::Design::BUTTERWORTH));
-        };
-
-        constexpr auto indices = std::views::iota(0UZ, nPhases);
-        std::ranges::transform(indices, _lpVoltageSquared.begin(), filter_init);
-        std::ranges::transform(indices, _lpCurrentSquared.begin(), filter_init);
-        std::ranges::transform(indices, _lpActivePower.begin(), filter_init);
+        const auto   filterDesign     = iir::designFilter<ValueType>(Type::LOWPASS,                             //
+                  FilterParameters{.order = 2UZ, .fLow = cutoff_frequency, .fs = static_cast<double>(sample_rate)}, //
+                  iir::Design::BUTTERWORTH);
+
+        if constexpr (UncertainValueLike<T>) {
+            const auto     filter_init = [&filterDesign](auto) { return FilterImpl(filterDesign); };
+            constexpr auto indices     = std::views::iota(0UZ, nPhases);
+            std::ranges::transform(indices, _lpVoltageSquared.begin(), filter_init);
+            std::ranges::transform(indices, _lpCurrentSquared.begin(), filter_init);
+            std::ranges::transform(indices, _lpActivePower.begin(), filter_init);
+        } else {
+            _lpAll = filter::MultiChannelFilter<ValueType, kNChannels>(filterDesign);
+        }
     }
 
     void settingsChanged(const property_map& /*oldSettings*/, const property_map& /*newSettings*/) { initFilters(); }
@@ -74,30 +86,64 @@ applies low-pass filters to calculate average values, and outputs decimated resu
     constexpr work::Status processBulk(std::span<TInputSpanType>& voltage, std::span<TInputSpanType>& current,                         // inputs
         std::span<TOutputSpanType>& activePower, std::span<TOutputSpanType>& reactivePower, std::span<TOutputSpanType>& apparentPower, // power outputs
         std::span<TOutputSpanType>& rmsVoltage, std::span<TOutputSpanType>& rmsCurrent) {
-        for (std::size_t phaseIdx = 0UZ; phaseIdx < nPhases; ++phaseIdx) { // process each phase
-            for (std::size_t i = 0UZ; i < voltage[phaseIdx].size(); ++i) { // iterate over samples
-                const T u_i = voltage[phaseIdx][i];
-                const T i_i = current[phaseIdx][i];
-
-                const T p_i    = u_i * i_i;                                         // instantaneous power
-                const T ema_p  = _lpActivePower[phaseIdx].processOne(p_i);          // update exponential moving average for power
-                const T ema_u2 = _lpVoltageSquared[phaseIdx].processOne(u_i * u_i); // update exponential moving average for voltage squared
-                const T ema_i2 = _lpCurrentSquared[phaseIdx].processOne(i_i * i_i); // update exponential moving average for current squared
-
-                if (i % static_cast<std::size_t>(decim) == 0UZ) {
-                    const std::size_t outIdx = i / static_cast<std::size_t>(decim);
-                    const T           u_rms  = math::sqrt(ema_u2);
-                    const T           i_rms  = math::sqrt(ema_i2);
-
-                    const T S_i = u_rms * i_rms;                                         // apparent power
-                    T       Q_i = math::sqrt(std::max(S_i * S_i - ema_p * ema_p, T(0))); // reactive power
+        if constexpr (!UncertainValueLike<T>) {
+            const std::size_t nSamples = voltage[0].size();
+            _lpFrames.resize(nSamples * kNChannels);
+            for (std::size_t i = 0UZ; i < nSamples; ++i) {
+                for (std::size_t phaseIdx = 0UZ; phaseIdx < nPhases; ++phaseIdx) {
+                    const T u_i   = voltage[phaseIdx][i];
+                    const T i_i   = current[phaseIdx][i];
+                    T*      frame = &_lpFrames[i * kNChannels + 3UZ * phaseIdx];
+                    frame[0]      = u_i * i_i; // instantaneous power
+                    frame[1]      = u_i * u_i;
+                    frame[2]      = i_i * i_i;
+                }
+            }
+            _lpAll.process(_lpFrames, _lpFrames); // exponential moving averages, in-place
+
+            for (std::size_t i = 0UZ; i < nSamples; i += static_cast<std::size_t>(decim)) {
+                const std::size_t outIdx = i / static_cast<std::size_t>(decim);
+                for (std::size_t phaseIdx = 0UZ; phaseIdx < nPhases; ++phaseIdx) {
+                    const T* frame = &_lpFrames[i * kNChannels + 3UZ * phaseIdx];
+                    const T  ema_p = frame[0];
+                    const T  u_rms = math::sqrt(frame[1]);
+                    const T  i_rms = math::sqrt(frame[2]);
+                    const T  S_i   = u_rms * i_rms;                                         // apparent power
+                    const T  Q_i   = math::sqrt(std::max(S_i * S_i - ema_p * ema_p, T(0))); // reactive power
 
                     activePower[phaseIdx][outIdx]   = ema_p;
                     reactivePower[phaseIdx][outIdx] = Q_i;
                     apparentPower[phaseIdx][outIdx] = S_i;
-
-                    rmsVoltage[phaseIdx][outIdx] = u_rms;
-                    rmsCurrent[phaseIdx][outIdx] = i_rms;
+                    rmsVoltage[phaseIdx][outIdx]    = u_rms;
+                    rmsCurrent[phaseIdx][outIdx]    = i_rms;
+                }
+            }
+        } else {
+            for (std::size_t phaseIdx = 0UZ; phaseIdx < nPhases; ++phaseIdx) { // process each phase
+                for (std::size_t i = 0UZ; i < voltage[phaseIdx].size(); ++i) { // iterate over samples
+                    const T u_i = voltage[phaseIdx][i];
+                    const T i_i = current[phaseIdx][i];
+
+                    const T p_i    = u_i * i_i;                                         // instantaneous power
+                    const T ema_p  = _lpActivePower[phaseIdx].processOne(p_i);          // update exponential moving average for power
+                    const T ema_u2 = _lpVoltageSquared[phaseIdx].processOne(u_i * u_i); // update exponential moving average for voltage squared
+                    const T ema_i2 = _lpCurrentSquared[phaseIdx].processOne(i_i * i_i); // update exponential moving average for current squared
+
+                    if (i % static_cast<std::size_t>(decim) == 0UZ) {
+                        const std::size_t outIdx = i / static_cast<std::size_t>(decim);
+                        const T           u_rms  = math::sqrt(ema_u2);
+                        const T           i_rms  = math::sqrt(ema_i2);
+
+                        const T S_i = u_rms * i_rms;                                         // apparent power
+                        T       Q_i = math::sqrt(std::max(S_i * S_i - ema_p * ema_p, T(0))); // reactive power
+
+                        activePower[phaseIdx][outIdx]   = ema_p;
+                        reactivePower[phaseIdx][outIdx] = Q_i;
+                        apparentPower[phaseIdx][outIdx] = S_i;
+
+                        rmsVoltage[phaseIdx][outIdx] = u_rms;
+                        rmsCurrent[phaseIdx][outIdx] = i_rms;
+                    }
                 }
             }
         }
@@ -0,0 +1,287 @@
+#ifndef GNURADIO_ASYNCFILEIO_HPP
+#define GNURADIO_ASYNCFILEIO_HPP
+
+#include <gnuradio-4.0/Message.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stop_token>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace gr::blocks::fileio::detail {
+
+inline constexpr std::size_t kDirectIoAlignment = 4096UZ; // covers the logical block size of common devices and file-systems
+
+[[nodiscard]] inline std::string errnoMessage(int error) { return std::error_code(error, std::generic_category()).message(); }
+
+[[nodiscard]] constexpr std::size_t roundUpToAlignment(std::size_t value, std::size_t alignment = kDirectIoAlignment) noexcept { return ((value + alignment - 1UZ) / alignment) * alignment; }
+
+/**
+ * @brief double-buffered file writer that hands full buffers off to a dedicated I/O thread ('pwrite(2)').
+ *
+ * 'write(..)' only copies into the active buffer and blocks only while the I/O thread is still busy with the previous
+ * buffer, i.e. a slow disk flush no longer stalls the calling (scheduler) thread for each chunk.
+ * With 'directIo' the file is opened with 'O_DIRECT' (if supported by the platform and file-system, otherwise the writer
+ * silently falls back to buffered I/O) using aligned buffers and block-sized writes that bypass the page-cache. The
+ * zero-padding of the last partial block is truncated on 'close()'.
+ * I/O errors of the background thread are reported (as gr::exception) by the next 'write(..)' or by 'close()'.
+ */
+class AsyncFileWriter {
+    struct AlignedFree {
+        void operator()(std::byte* ptr) const noexcept { std::free(ptr); }
+    };
+    using Buffer = std::unique_ptr<std::byte[], AlignedFree>;
+
+    int                         _fd = -1;
+    std::string                 _fileName;
+    bool                        _directIo     = false;
+    std::size_t                 _bufferSize   = 0UZ;
+    std::array<Buffer, 2>       _buffers{};
+    std::size_t                 _active       = 0UZ; // index of the buffer filled by 'write(..)'
+    std::size_t                 _activeSize   = 0UZ;
+    std::size_t                 _fileOffset   = 0UZ; // position of the next 'pwrite(..)' -- owned by the I/O thread while it is running
+    std::mutex                  _mutex;
+    std::condition_variable_any _cv;
+    std::size_t                 _pendingIndex = 0UZ;
+    std::size_t                 _pendingSize  = 0UZ; // > 0: '_buffers[_pendingIndex]' is handed to the I/O thread
+    int                         _error        = 0;   // first 'errno' reported by the I/O thread
+    std::jthread                _ioThread;
+
+    [[nodiscard]] int writeAll(const std::byte* data, std::size_t size) noexcept {
+        while (size > 0UZ) {
+            const ssize_t ret = ::pwrite(_fd, data, size, static_cast<off_t>(_fileOffset));
+            if (ret < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return errno;
+            }
+            data += ret;
+            size -= static_cast<std::size_t>(ret);
+            _fileOffset += static_cast<std::size_t>(ret);
+        }
+        return 0;
+    }
+
+    void ioLoop(std::stop_token stopToken) {
+        std::unique_lock lock(_mutex);
+        while (_cv.wait(lock, stopToken, [this] { return _pendingSize > 0UZ; })) {
+            const std::size_t index = _pendingIndex;
+            const std::size_t size  = _pendingSize;
+            lock.unlock();
+            const int error = writeAll(_buffers[index].get(), size);
+            lock.lock();
+            if (error != 0 && _error == 0) {
+                _error = error;
+            }
+            _pendingSize = 0UZ;
+            _cv.notify_all();
+        }
+    }
+
+    void handOffActiveBuffer() {
+        std::unique_lock lock(_mutex);
+        _cv.wait(lock, [this] { return _pendingSize == 0UZ; }); // back-pressure: at most one buffer in flight
+        _pendingIndex = _active;
+        _pendingSize  = _activeSize;
+        _active ^= 1UZ;
+        _activeSize = 0UZ;
+        _cv.notify_all();
+    }
+
+    void throwIfError() {
+        std::lock_guard lock(_mutex);
+        if (_error != 0) {
+            throw gr::exception(fmt::format("failed to write to file '{}': {}", _fileName, errnoMessage(std::exchange(_error, 0))));
+        }
+    }
+
+public:
+    AsyncFileWriter() = default;
+    ~AsyncFileWriter() {
+        try {
+            close();
+        } catch (...) { // NOSONAR -- errors can no longer be reported at this point
+        }
+    }
+
+    AsyncFileWriter(const AsyncFileWriter&)            = delete;
+    AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+
+    [[nodiscard]] bool isOpen() const noexcept { return _fd >= 0; }
+    [[nodiscard]] bool isDirectIo() const noexcept { return _directIo; } // N.B. of the last opened file, also after 'close()'
+
+    void open(const std::filesystem::path& filePath, bool append, bool directIo = false, std::size_t bufferSize = 1UZ << 20UZ) {
+        close();
+        _fileName       = filePath.string();
+        const int flags = O_WRONLY | O_CREAT | O_CLOEXEC | (append ? 0 : O_TRUNC);
+        _directIo       = false;
+#ifdef O_DIRECT
+        if (directIo) {
+            _fd       = ::open(_fileName.c_str(), flags | O_DIRECT, 0644);
+            _directIo = _fd >= 0; // N.B. some file-systems (e.g. tmpfs) do not support O_DIRECT -> retry with buffered I/O
+        }
+#endif
+        if (_fd < 0) {
+            _fd = ::open(_fileName.c_str(), flags, 0644);
+        }
+        if (_fd < 0) {
+            throw gr::exception(fmt::format("failed to open file '{}': {}", _fileName, errnoMessage(errno)));
+        }
+
+        struct stat fileStat{};
+        if (::fstat(_fd, &fileStat) != 0) {
+            const int error = errno;
+            ::close(std::exchange(_fd, -1));
+            throw gr::exception(fmt::format("failed to stat file '{}': {}", _fileName, errnoMessage(error)));
+        }
+        _fileOffset = append ? static_cast<std::size_t>(fileStat.st_size) : 0UZ;
+#ifdef O_DIRECT
+        if (_directIo && _fileOffset % kDirectIoAlignment != 0UZ) { // unaligned end of the file to append to
+            ::fcntl(_fd, F_SETFL, ::fcntl(_fd, F_GETFL) & ~O_DIRECT);
+            _directIo = false;
+        }
+#endif
+
+        const std::size_t newBufferSize = roundUpToAlignment(std::max(bufferSize, 1UZ));
+        if (newBufferSize != _bufferSize || !_buffers[0]) {
+            for (auto& buffer : _buffers) {
+                buffer.reset(static_cast<std::byte*>(std::aligned_alloc(kDirectIoAlignment, newBufferSize)));
+                if (!buffer) {
+                    ::close(std::exchange(_fd, -1));
+                    throw gr::exception(fmt::format("failed to allocate {} bytes I/O buffer for file '{}'", newBufferSize, _fileName));
+                }
+            }
+            _bufferSize = newBufferSize;
+        }
+        _active      = 0UZ;
+        _activeSize  = 0UZ;
+        _pendingSize = 0UZ;
+        _error       = 0;
+        _ioThread    = std::jthread([this](std::stop_token stopToken) { ioLoop(stopToken); });
+    }
+
+    void write(std::span<const std::byte> data) {
+        throwIfError();
+        while (!data.empty()) {
+            const std::size_t nBytes = std::min(data.size(), _bufferSize - _activeSize);
+            std::memcpy(_buffers[_active].get() + _activeSize, data.data(), nBytes);
+            _activeSize += nBytes;
+            data = data.subspan(nBytes);
+            if (_activeSize == _bufferSize) {
+                handOffActiveBuffer();
+            }
+        }
+    }
+
+    void close() {
+        if (_fd < 0) {
+            return;
+        }
+        std::size_t padding = 0UZ;
+        if (_activeSize > 0UZ) {
+            if (_directIo) { // O_DIRECT requires block-sized writes
+                padding = roundUpToAlignment(_activeSize) - _activeSize;
+                std::memset(_buffers[_active].get() + _activeSize, 0, padding);
+                _activeSize += padding;
+            }
+            handOffActiveBuffer();
+        }
+        {
+            std::unique_lock lock(_mutex);
+            _cv.wait(lock, [this] { return _pendingSize == 0UZ; });
+        }
+        _ioThread.request_stop();
+        _ioThread.join();
+
+        if (padding > 0UZ && ::ftruncate(_fd, static_cast<off_t>(_fileOffset - padding)) != 0 && _error == 0) {
+            _error = errno;
+        }
+        if (::close(std::exchange(_fd, -1)) != 0 && _error == 0) {
+            _error = errno;
+        }
+        throwIfError();
+    }
+};
+
+/**
+ * @brief read-only memory-mapped file for replay: samples are copied straight from the page-cache into the output
+ * buffer (no intermediate stream buffers), sequential read-ahead is requested via 'madvise(2)'.
+ */
+class MappedFile {
+    int              _fd   = -1;
+    const std::byte* _data = nullptr;
+    std::size_t      _size = 0UZ;
+
+public:
+    MappedFile() = default;
+    ~MappedFile() { close(); }
+
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    [[nodiscard]] bool                       isOpen() const noexcept { return _fd >= 0; }
+    [[nodiscard]] std::span<const std::byte> data() const noexcept { return {_data, _size}; }
+
+    void open(const std::filesystem::path& filePath) {
+        close();
+        _fd = ::open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+        if (_fd < 0) {
+            throw gr::exception(fmt::format("failed to open file '{}': {}", filePath.string(), errnoMessage(errno)));
+        }
+        struct stat fileStat{};
+        if (::fstat(_fd, &fileStat) != 0) {
+            const int error = errno;
+            close();
+            throw gr::exception(fmt::format("failed to stat file '{}': {}", filePath.string(), errnoMessage(error)));
+        }
+        if (fileStat.st_size == 0) { // N.B. zero-sized mappings are not allowed
+            return;
+        }
+        void* mapped = ::mmap(nullptr, static_cast<std::size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, _fd, 0);
+        if (mapped == MAP_FAILED) {
+            const int error = errno;
+            close();
+            throw gr::exception(fmt::format("failed to map file '{}': {}", filePath.string(), errnoMessage(error)));
+        }
+        _data = static_cast<const std::byte*>(mapped);
+        _size = static_cast<std::size_t>(fileStat.st_size);
+#ifdef MADV_SEQUENTIAL
+        ::madvise(mapped, _size, MADV_SEQUENTIAL);
+#endif
+    }
+
+    void close() noexcept {
+        if (_data != nullptr) {
+            ::munmap(const_cast<std::byte*>(_data), _size);
+            _data = nullptr;
+            _size = 0UZ;
+        }
+        if (_fd >= 0) {
+            ::close(std::exchange(_fd, -1));
+        }
+    }
+};
+
+} // namespace gr::blocks::fileio::detail
+
+#endif // GNURADIO_ASYNCFILEIO_HPP
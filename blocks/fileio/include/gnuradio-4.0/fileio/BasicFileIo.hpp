@@ -6,10 +6,12 @@
 #include <gnuradio-4.0/meta/formatter.hpp>
 #include <magic_enum.hpp>
 
+#include "AsyncFileIo.hpp"
+
 #include <chrono>
 #include <complex>
+#include <cstring>
 #include <filesystem>
-#include <fstream>
 #include <span>
 #include <string_view>
 
@@ -66,24 +68,29 @@ struct BasicFileSink : public gr::Block<BasicFileSink<T>> {
     using Description = Doc<R""(A sink block for writing a stream to a binary file.
 The file can be played back using a 'BasicFileSource' or read by any program that supports binary files (e.g. Python, C, C++, MATLAB).
 For complex types, the binary file contains [float, double]s in IQIQIQ order. No metadata is included with the binary data.)
+The samples are written asynchronously: 'processBulk' only copies into one of two buffers that are written by a dedicated
+I/O thread, so that slow disk flushes do not stall the scheduler. 'direct_io' bypasses the page-cache (O_DIRECT, if
+supported by the file-system) for sustained high-rate recording.
 Important: this implementation assumes a host-order, CPU architecture specific byte order!)"">;
     template<typename U, gr::meta::fixed_string description = "", typename... Arguments>
     using A = gr::Annotated<U, description, Arguments...>; // optional shortening
 
     PortIn<T> in;
 
-    A<std::string, "file name", Doc<"base filename, prefixed if ">, Visible>              file_name;
-    Mode                                                                                  _mode              = Mode::overwrite;
-    A<std::string, "mode", Doc<"mode: \"overwrite\", \"append\", \"multi\"">, Visible>    mode               = std::string(magic_enum::enum_name(_mode));
-    A<gr::Size_t, "max bytes per file", Doc<"max bytes per file, 0: infinite ">, Visible> max_bytes_per_file = 0U;
+    A<std::string, "file name", Doc<"base filename, prefixed if ">, Visible>                                   file_name;
+    Mode                                                                                                       _mode              = Mode::overwrite;
+    A<std::string, "mode", Doc<"mode: \"overwrite\", \"append\", \"multi\"">, Visible>                         mode               = std::string(magic_enum::enum_name(_mode));
+    A<gr::Size_t, "max bytes per file", Doc<"max bytes per file, 0: infinite ">, Visible>                      max_bytes_per_file = 0U;
+    A<gr::Size_t, "buffer size", Doc<"size of each of the two I/O buffers">, Unit<"B">>                        buffer_size        = 1U << 20U;
+    A<bool, "direct I/O", Doc<"true: bypass the page-cache (O_DIRECT) for sustained high-rate recording">> direct_io          = false;
 
-    GR_MAKE_REFLECTABLE(BasicFileSink, in, file_name, mode, max_bytes_per_file);
+    GR_MAKE_REFLECTABLE(BasicFileSink, in, file_name, mode, max_bytes_per_file, buffer_size, direct_io);
 
-    std::size_t   _totalBytesWritten{0UZ};
-    std::size_t   _totalBytesWrittenFile{0UZ};
-    std::ofstream _file;
-    std::size_t   _fileCounter{0UZ};
-    std::string   _actualFileName;
+    std::size_t             _totalBytesWritten{0UZ};
+    std::size_t             _totalBytesWrittenFile{0UZ};
+    detail::AsyncFileWriter _file;
+    std::size_t             _fileCounter{0UZ};
+    std::string             _actualFileName;
 
     void settingsChanged(const property_map& /*oldSettings*/, const property_map& /*newSettings*/) {
         _mode = magic_enum::enum_cast<Mode>(mode, magic_enum::case_insensitive).value_or(_mode);
@@ -110,15 +117,11 @@ Important: this implementation assumes a host-order, CPU architecture specific b
         if (max_bytes_per_file.value != 0U) {
             nBytesMax = std::min(nBytesMax, static_cast<std::size_t>(max_bytes_per_file.value) - _totalBytesWrittenFile);
         }
-        _file.write(reinterpret_cast<const char*>(dataIn.data()), static_cast<std::streamsize>(nBytesMax));
+        _file.write(std::span(reinterpret_cast<const std::byte*>(dataIn.data()), nBytesMax)); // N.B. throws on previous I/O errors
         if (!dataIn.consume(nBytesMax / sizeof(T))) {
             throw gr::exception("could not consume input samples");
         }
 
-        if (!_file) {
-            throw gr::exception(fmt::format("failed to write to file '{}'.", _actualFileName));
-        }
-
         _totalBytesWritten += nBytesMax;
         _totalBytesWrittenFile += nBytesMax;
 
@@ -126,11 +129,7 @@ Important: this implementation assumes a host-order, CPU architecture specific b
     }
 
 private:
-    void closeFile() {
-        if (_file.is_open()) {
-            _file.close();
-        }
-    }
+    void closeFile() { _file.close(); }
     void openNextFile() {
         closeFile();
         _totalBytesWrittenFile = 0UZ;
@@ -146,31 +145,27 @@ private:
         switch (_mode) {
         case Mode::overwrite: {
             _actualFileName = file_name.value;
-            _file.open(_actualFileName, std::ios::binary | std::ios::trunc);
+            _file.open(_actualFileName, false, direct_io, buffer_size);
         } break;
         case Mode::append: {
             _actualFileName = file_name.value;
-            _file.open(_actualFileName, std::ios::binary | std::ios::app);
+            _file.open(_actualFileName, true, direct_io, buffer_size);
         } break;
         case Mode::multi: {
             // _fileCounter ensures that the filenames are unique and still sortable by date-time, with an additional counter to handle rapid successive file creation.
             _actualFileName = filePath.parent_path() / (gr::time::getIsoTime() + "_" + std::to_string(_fileCounter++) + "_" + filePath.filename().string());
-            _file.open(_actualFileName, std::ios::binary);
+            _file.open(_actualFileName, false, direct_io, buffer_size);
             break;
         }
         default: throw gr::exception("unsupported file mode.");
         }
-
-        if (!_file) {
-            throw gr::exception(fmt::format("failed to open file '{}'.", _actualFileName));
-        }
     }
 };
 
 template<typename T>
 struct BasicFileSource : public gr::Block<BasicFileSource<T>> {
     using Description = Doc<R""(A source block for reading a binary file and outputting the data.
-This source is the counterpart to 'BasicFileSink'.
+This source is the counterpart to 'BasicFileSink'. The files are memory-mapped and copied directly into the output buffer.
 For complex types, the binary file contains [float, double]s in IQIQIQ order. No metadata is expected in the binary data.
 Important: this implementation assumes a host-order, CPU architecture specific byte order!)"">;
 
@@ -189,11 +184,12 @@ Important: this implementation assumes a host-order, CPU architecture specific b
 
     GR_MAKE_REFLECTABLE(BasicFileSource, out, file_name, mode, repeat, offset, length, trigger_name);
 
-    std::ifstream                      _file;
+    detail::MappedFile                 _file;
     std::vector<std::filesystem::path> _filesToRead;
     bool                               _emittedStartTrigger = false;
     std::size_t                        _totalBytesRead      = 0UZ;
     std::size_t                        _totalBytesReadFile  = 0UZ;
+    std::size_t                        _filePosition        = 0UZ; // read position within the mapped file
     std::size_t                        _currentFileIndex    = 0UZ;
     std::string                        _currentFileName;
 
@@ -228,7 +224,7 @@ Important: this implementation assumes a host-order, CPU architecture specific b
     void stop() { closeFile(); }
 
     [[nodiscard]] constexpr work::Status processBulk(OutputSpanLike auto& dataOut) noexcept {
-        if (!_file.is_open()) {
+        if (!_file.isOpen()) {
             return work::Status::DONE;
         }
         std::size_t nOutAvailable = dataOut.size() * sizeof(T);
@@ -236,7 +232,12 @@ Important: this implementation assumes a host-order, CPU architecture specific b
             nOutAvailable = std::min(nOutAvailable, (length.value * sizeof(T) - _totalBytesReadFile));
         }
 
-        std::size_t bytesRead = static_cast<std::size_t>(_file.read(reinterpret_cast<char*>(dataOut.data()), static_cast<std::streamsize>(nOutAvailable)).gcount());
+        const std::span<const std::byte> fileData  = _file.data();
+        const std::size_t                bytesRead = std::min(nOutAvailable, fileData.size() - _filePosition);
+        if (bytesRead > 0UZ) {
+            std::memcpy(dataOut.data(), fileData.data() + _filePosition, bytesRead);
+            _filePosition += bytesRead;
+        }
         if (!_emittedStartTrigger && !trigger_name.value.empty()) {
             dataOut.publishTag(
                 property_map{
@@ -270,11 +271,7 @@ Important: this implementation assumes a host-order, CPU architecture specific b
     }
 
 private:
-    void closeFile() {
-        if (_file.is_open()) {
-            _file.close();
-        }
-    }
+    void closeFile() { _file.close(); }
     void openNextFile() {
         if (_currentFileIndex >= _filesToRead.size()) {
             return;
@@ -283,13 +280,8 @@ private:
         _emittedStartTrigger = false;
 
         _currentFileName = _filesToRead[_currentFileIndex].string();
-        _file.open(_currentFileName, std::ios::binary);
-        if (!_file) {
-            throw gr::exception(fmt::format("failed to open file '{}'.", _currentFileName));
-        }
-        if (offset.value != 0U) {
-            _file.seekg(offset.value * sizeof(T), std::ios::beg);
-        }
+        _file.open(_currentFileName);
+        _filePosition = std::min(static_cast<std::size_t>(offset.value) * sizeof(T), _file.data().size());
         _currentFileIndex++;
     }
 };
@@ -4,9 +4,15 @@
 
 #include <gnuradio-4.0/Scheduler.hpp>
 #include <gnuradio-4.0/testing/NullSources.hpp>
+#include <gnuradio-4.0/testing/TagMonitors.hpp>
 
 #include <fmt/format.h>
 
+#include <numeric>
+
+#include <fcntl.h>
+#include <unistd.h>
+
 namespace {
 using namespace std::chrono_literals;
 template<typename Scheduler>
@@ -129,6 +135,81 @@ void runTest(const gr::blocks::fileio::Mode mode, const std::shared_ptr<gr::thre
     expect(!gr::blocks::fileio::detail::deleteFilesContaining(fileName).empty());
 }
 
+[[nodiscard]] bool supportsDirectIo(const std::filesystem::path& directory) { // N.B. e.g. tmpfs rejects O_DIRECT
+#ifdef O_DIRECT
+    std::filesystem::create_directories(directory);
+    const std::filesystem::path probe = directory / "direct_io_probe.bin";
+    const int                   fd    = ::open(probe.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC | O_DIRECT, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    ::close(fd);
+    std::filesystem::remove(probe);
+    return true;
+#else
+    std::ignore = directory;
+    return false;
+#endif
+}
+
+void runDirectIoRoundTripTest(const std::shared_ptr<gr::thread_pool::BasicThreadPool>& threadPool) {
+    using namespace boost::ut;
+    using namespace gr::blocks::fileio;
+    using namespace gr::testing;
+    using scheduler = gr::scheduler::Simple<>;
+
+    constexpr gr::Size_t        nSamples   = 5000U; // N.B. deliberately not a multiple of the I/O buffer and direct I/O block size
+    constexpr gr::Size_t        bufferSize = 4096U;
+    const std::filesystem::path directory  = std::filesystem::path(TEST_BINARY_PATH) / "gr4_file_sink_test"; // N.B. not '/tmp' which is commonly a tmpfs without O_DIRECT support
+    const std::string           fileName   = (directory / "TestFileName_direct_io.bin").string();
+    const bool                  directIo   = supportsDirectIo(directory);
+    gr::blocks::fileio::detail::deleteFilesContaining(fileName);
+    if (!directIo) {
+        fmt::println("'{}' does not support O_DIRECT -> only testing the buffered I/O fall-back", directory.string());
+    }
+
+    "BasicFileSink with direct_io and small buffer_size"_test = [&] { // NOSONAR capture all
+        gr::Graph flow;
+        auto&     source   = flow.emplaceBlock<TagSource<float>>({{"n_samples_max", nSamples}, {"mark_tag", false}});
+        auto&     fileSink = flow.emplaceBlock<BasicFileSink<float>>({{"file_name", fileName}, {"mode", std::string("overwrite")}, {"direct_io", true}, {"buffer_size", bufferSize}});
+        expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"out">(source).to<"in">(fileSink)));
+
+        auto sched                                        = scheduler{std::move(flow), threadPool};
+        auto [watchdogThread, externalInterventionNeeded] = createWatchdog(sched, 2s);
+        expect(sched.runAndWait().has_value());
+        if (watchdogThread.joinable()) {
+            watchdogThread.join();
+        }
+        expect(!externalInterventionNeeded->load(std::memory_order_relaxed));
+        expect(eq(fileSink._file.isDirectIo(), directIo)) << "O_DIRECT path taken if supported by the file-system";
+        expect(eq(fileSink._totalBytesWritten, nSamples * sizeof(float)));
+        expect(eq(gr::blocks::fileio::detail::getFileSize(fileName), nSamples * sizeof(float))) << "zero-padding of the last direct I/O block is truncated";
+    };
+
+    "BasicFileSource replays the direct_io file"_test = [&] { // NOSONAR capture all
+        gr::Graph flow;
+        auto&     fileSource = flow.emplaceBlock<BasicFileSource<float>>({{"file_name", fileName}, {"mode", std::string("overwrite")}});
+        auto&     sink       = flow.emplaceBlock<TagSink<float, ProcessFunction::USE_PROCESS_BULK>>({{"log_samples", true}});
+        expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"out">(fileSource).to<"in">(sink)));
+
+        auto sched                                        = scheduler{std::move(flow), threadPool};
+        auto [watchdogThread, externalInterventionNeeded] = createWatchdog(sched, 2s);
+        expect(sched.runAndWait().has_value());
+        if (watchdogThread.joinable()) {
+            watchdogThread.join();
+        }
+        expect(!externalInterventionNeeded->load(std::memory_order_relaxed));
+        expect(eq(fileSource._totalBytesRead, nSamples * sizeof(float)));
+
+        std::vector<float> expected(nSamples);
+        std::iota(expected.begin(), expected.end(), 0.f);
+        expect(eq(sink._samples.size(), expected.size()));
+        expect(std::ranges::equal(sink._samples, expected)) << "replayed samples match the written ones";
+    };
+
+    expect(!gr::blocks::fileio::detail::deleteFilesContaining(fileName).empty());
+}
+
 } // anonymous namespace
 
 const boost::ut::suite<"basic file IO tests"> basicFileIOTests = [] {
@@ -146,6 +227,8 @@ const boost::ut::suite<"basic file IO tests"> basicFileIOTests = [] {
     "append mode"_test = [&threadPool]<typename T>(const T&) { runTest<T>(append, threadPool); } | kArithmeticTypes;
 
     "create new mode"_test = [&threadPool]<typename T>(const T&) { runTest<T>(multi, threadPool); } | kArithmeticTypes;
+
+    "direct I/O round-trip"_test = [&threadPool] { runDirectIoRoundTripTest(threadPool); };
 };
 
 int main() { /* not needed for UT */ }
@@ -0,0 +1,68 @@
+#ifndef GNURADIO_FAST_FIR_FILTER_HPP
+#define GNURADIO_FAST_FIR_FILTER_HPP
+
+#include <vector>
+
+#include <gnuradio-4.0/Block.hpp>
+#include <gnuradio-4.0/BlockRegistry.hpp>
+
+#include <gnuradio-4.0/algorithm/fourier/fast_convolution.hpp>
+#include <gnuradio-4.0/algorithm/fourier/fft.hpp>
+
+#include <magic_enum.hpp>
+
+namespace gr::filter {
+
+template<typename T, template<typename, typename> typename FourierAlgorithm = gr::algorithm::FFT>
+requires std::floating_point<T>
+struct FastFirFilter : Block<FastFirFilter<T, FourierAlgorithm>> {
+    using Description = Doc<R""(
+@brief Finite Impulse Response (FIR) filter using FFT-based (overlap-save) fast convolution for long filters
+
+Drop-in replacement for `fir_filter` that accepts the same `b` coefficients, i.e.
+H(z) = b[0] + b[1]*z^-1 + b[2]*z^-2 + ... + b[N]*z^-N
+The input is accumulated across work calls into blocks of L = fft_size - N samples that are convolved in the frequency
+domain with O(log(fft_size)) operations per sample instead of O(N), independent of the scheduler's chunk sizes.
+N.B. the FFT-based convolution delays the output by a fixed latency of L samples (`_convolution.latency()`), the
+direct convolution ('Direct' mode or chosen by 'Auto') is sample-aligned.
+
+'Auto' mode measures both implementations for the given coefficients and picks the faster one, which typically
+is the FFT-based convolution for filters with more than ~64 taps.
+)"">;
+    PortIn<T>      in;
+    PortOut<T>     out;
+    std::vector<T> b{T{1}}; // feedforward coefficients
+
+    Annotated<std::string, "convolution mode", Doc<"'Auto', 'Direct' or 'FFT'">, Visible>      mode = std::string(magic_enum::enum_name(algorithm::ConvolutionMode::Auto));
+    Annotated<gr::Size_t, "FFT size", Doc<"power-of-two FFT size (0: chosen from number of taps)">> fft_size{0U};
+
+    GR_MAKE_REFLECTABLE(FastFirFilter, in, out, b, mode, fft_size);
+
+    algorithm::FastConvolution<T, FourierAlgorithm> _convolution;
+
+    void settingsChanged(const property_map& /*old_settings*/, const property_map& new_settings) {
+        if (!new_settings.contains("b") && !new_settings.contains("mode") && !new_settings.contains("fft_size")) {
+            return;
+        }
+        const auto convolutionMode = magic_enum::enum_cast<algorithm::ConvolutionMode>(mode.value, magic_enum::case_insensitive);
+        if (!convolutionMode) {
+            throw gr::exception(fmt::format("invalid convolution mode: {}", mode.value));
+        }
+        _convolution.mode = *convolutionMode;
+        _convolution.setTaps(b, fft_size);
+    }
+
+    [[nodiscard]] work::Status processBulk(std::span<const T> input, std::span<T> output) {
+        _convolution.process(input, output.first(input.size()));
+        return work::Status::OK;
+    }
+};
+
+template<typename T>
+using DefaultFastFirFilter = FastFirFilter<T, gr::algorithm::FFT>;
+
+} // namespace gr::filter
+
+inline static auto registerFastFirFilter = gr::registerBlock<gr::filter::DefaultFastFirFilter, double, float>(gr::globalBlockRegistry());
+
+#endif // GNURADIO_FAST_FIR_FILTER_HPP
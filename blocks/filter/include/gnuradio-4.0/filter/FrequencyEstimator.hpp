@@ -50,9 +50,9 @@ This block estimates the frequency of a signal using the time-domain algorithm d
     T          _prevFrequency{50.0};   // previous frequency value for continuity
     gr::Size_t _n_period_estimate{60}; // number of samples for estimation period according to [0]
 
-    FilterCoefficients<T> _singleFilterSection;
-    HistoryBuffer<T>      _inputHistory{32UZ};
-    HistoryBuffer<T>      _outputHistory{32UZ};
+    Filter<T>        _filter;
+    HistoryBuffer<T> _outputHistory{32UZ};
+    std::vector<T>   _filtered; // scratch buffer for bulk filtering
 
     void settingsChanged(const property_map& /*oldSettings*/, const property_map& newSettings) {
         if (newSettings.contains("n_periods") || newSettings.contains("sample_rate") || newSettings.contains("f_expected") || newSettings.contains("f_min") || newSettings.contains("f_max")) {
@@ -69,9 +69,9 @@ This block estimates the frequency of a signal using the time-domain algorithm d
         // * BESSEL: optimizes phase linearity in the pass-band and in turn frequency accuracy
         _n_period_estimate = n_periods * static_cast<gr::Size_t>(f_min > 0 ? sample_rate / std::min(f_min.value, f_expected.value) : sample_rate / f_expected.value);
         using namespace gr::filter::iir;
-        _singleFilterSection = iir::designFilter<T, 0UZ>(Type::LOWPASS, FilterParameters{.order = 2UZ, .fLow = static_cast<double>(f_max), .fs = static_cast<double>(sample_rate)}, Design::BESSEL);
-        _inputHistory        = HistoryBuffer<T>(std::bit_ceil(_singleFilterSection.b.size()));
-        _outputHistory       = HistoryBuffer<T>(std::bit_ceil(std::max(_singleFilterSection.a.size(), std::size_t(_n_period_estimate))));
+        const auto singleFilterSection = iir::designFilter<T, 0UZ>(Type::LOWPASS, FilterParameters{.order = 2UZ, .fLow = static_cast<double>(f_max), .fs = static_cast<double>(sample_rate)}, Design::BESSEL);
+        _filter                        = Filter<T>(singleFilterSection);
+        _outputHistory                 = HistoryBuffer<T>(std::bit_ceil(std::max(singleFilterSection.a.size(), std::size_t(_n_period_estimate))));
     }
 
     void reset() {
@@ -83,10 +83,7 @@ This block estimates the frequency of a signal using the time-domain algorithm d
     requires(TParent::ResamplingControl::kIsConst)
     {
         // process input sample through the IIR filter
-        _inputHistory.push_back(input);
-        const T output = std::inner_product(_singleFilterSection.b.cbegin(), _singleFilterSection.b.cend(), _inputHistory.cbegin(), static_cast<T>(0))         // feed-forward
-                         - std::inner_product(_singleFilterSection.a.cbegin() + 1, _singleFilterSection.a.cend(), _outputHistory.cbegin(), static_cast<T>(0)); // feed-back
-        _outputHistory.push_back(output);
+        _outputHistory.push_back(_filter.processOne(input));
         _prevFrequency = estimateFrequency();
         return _prevFrequency;
     }
@@ -99,20 +96,15 @@ This block estimates the frequency of a signal using the time-domain algorithm d
             return work::Status::INSUFFICIENT_OUTPUT_ITEMS;
         }
 
+        _filtered.resize(this->input_chunk_size);
         auto output_it = output.begin();
         for (std::size_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
             const std::size_t  offset = chunk_idx * this->input_chunk_size;
             std::span<const T> chunk  = input.subspan(offset, this->input_chunk_size);
 
-            for (const T& sample : chunk) {
-                // process input sample through the IIR filter
-                _inputHistory.push_back(sample);
-
-                const T output_sample = std::inner_product(_singleFilterSection.b.cbegin(), _singleFilterSection.b.cend(), _inputHistory.cbegin(), static_cast<T>(0))         // feed-forward
-                                        - std::inner_product(_singleFilterSection.a.cbegin() + 1, _singleFilterSection.a.cend(), _outputHistory.cbegin(), static_cast<T>(0)); // feed-back
-
-                _outputHistory.push_back(output_sample);
-            }
+            // process input chunk through the IIR filter
+            _filter.process(chunk, _filtered);
+            _outputHistory.push_back_bulk(_filtered);
 
             _prevFrequency = estimateFrequency();
             *output_it++   = _prevFrequency;
@@ -62,6 +62,9 @@ struct iir_filter : Block<iir_filter<T, form>> {
 
 b are the feed-forward coefficients (N.B. b[0] denoting the newest and b[-1] the previous sample)
 a are the feedback coefficients
+
+Samples are processed in bulk (see `filter::Filter<T>::process(...)`): filters up to 4th order are evaluated in
+transposed direct-form II with the recursion state kept in registers, `form` defines the per-sample reference structure.
 )"">;
     PortIn<T>      in;
     PortOut<T>     out;
@@ -70,49 +73,28 @@ a are the feedback coefficients
 
     GR_MAKE_REFLECTABLE(iir_filter, in, out, b, a);
 
-    HistoryBuffer<T> inputHistory{32};
-    HistoryBuffer<T> outputHistory{32};
+    constexpr static Form kForm = form == IIRForm::DF_I ? Form::DF_I : form == IIRForm::DF_II ? Form::DF_II : form == IIRForm::DF_I_TRANSPOSED ? Form::DF_I_TRANSPOSED : Form::DF_II_TRANSPOSED;
 
-    void settingsChanged(const property_map& /*old_settings*/, const property_map& new_settings) noexcept {
-        const auto new_size = std::max(a.size(), b.size());
-        if ((new_settings.contains("b") || new_settings.contains("a")) && (new_size >= inputHistory.capacity() || new_size >= inputHistory.capacity())) {
-            inputHistory  = HistoryBuffer<T>(std::bit_ceil(new_size));
-            outputHistory = HistoryBuffer<T>(std::bit_ceil(new_size));
+    filter::Filter<T, std::dynamic_extent, kForm> _filter;
+    FilterCoefficients<T>                         _designed{.b = {T{1}}, .a = {T{1}}}; // coefficients '_filter' was built with
+
+    void settingsChanged(const property_map& /*old_settings*/, const property_map& new_settings) {
+        if (new_settings.contains("b") || new_settings.contains("a")) {
+            updateFilter();
         }
     }
 
-    [[nodiscard]] T processOne(T input) noexcept {
-        if constexpr (form == IIRForm::DF_I) {
-            // y[n] = b[0] * x[n]   + b[1] * x[n-1] + ... + b[N] * x[n-N]
-            //      - a[1] * y[n-1] - a[2] * y[n-2] - ... - a[M] * y[n-M]
-            inputHistory.push_back(input);
-            const T feedforward = std::transform_reduce(std::execution::unseq, b.cbegin(), b.cend(), inputHistory.cbegin(), T{0}, std::plus<>{}, std::multiplies<>{});
-            const T feedback    = std::transform_reduce(std::execution::unseq, a.cbegin() + 1, a.cend(), outputHistory.cbegin(), T{0}, std::plus<>{}, std::multiplies<>{});
-            const T output      = feedforward - feedback;
-            outputHistory.push_back(output);
-            return output;
-        } else if constexpr (form == IIRForm::DF_II) {
-            // w[n] = x[n] - a[1] * w[n-1] - a[2] * w[n-2] - ... - a[M] * w[n-M]
-            // y[n] =        b[0] * w[n]   + b[1] * w[n-1] + ... + b[N] * w[n-N]
-            const T w = input - std::transform_reduce(std::execution::unseq, a.cbegin() + 1, a.cend(), inputHistory.cbegin(), T{0}, std::plus<>{}, std::multiplies<>{});
-            inputHistory.push_back(w);
-
-            return std::transform_reduce(std::execution::unseq, b.cbegin(), b.cend(), inputHistory.cbegin(), T{0}, std::plus<>{}, std::multiplies<>{});
-        } else if constexpr (form == IIRForm::DF_I_TRANSPOSED) {
-            // w_1[n] = x[n] - a[1] * w_2[n-1] - a[2] * w_2[n-2] - ... - a[M] * w_2[n-M]
-            // y[n]   = b[0] * w_2[n] + b[1] * w_2[n-1] + ... + b[N] * w_2[n-N]
-            const T v0 = input - std::transform_reduce(std::execution::unseq, a.cbegin() + 1, a.cend(), outputHistory.cbegin(), T{0}, std::plus<>{}, std::multiplies<>{});
-            outputHistory.push_back(v0);
-
-            return std::transform_reduce(std::execution::unseq, b.cbegin(), b.cend(), outputHistory.cbegin(), T{0}, std::plus<>{}, std::multiplies<>{});
-        } else if constexpr (form == IIRForm::DF_II_TRANSPOSED) {
-            // y[n] = b_0 * f[n] + Σ (b_k * f[n−k] − a_k * y[n−k]) for k = 1 to N
-            const T output = b[0] * input + std::transform_reduce(std::execution::unseq, b.cbegin() + 1, b.cend(), inputHistory.cbegin(), T{0}, std::plus<>{}, std::multiplies<>{}) - std::transform_reduce(std::execution::unseq, a.cbegin() + 1, a.cend(), outputHistory.cbegin(), T{0}, std::plus<>{}, std::multiplies<>{});
-
-            inputHistory.push_back(input);
-            outputHistory.push_back(output);
-            return output;
+    [[nodiscard]] work::Status processBulk(std::span<const T> input, std::span<T> output) {
+        if (b != _designed.b || a != _designed.a) [[unlikely]] { // N.B. 'b' or 'a' assigned directly, i.e. not via the settings (e.g. merged blocks)
+            updateFilter();
         }
+        _filter.process(input, output);
+        return work::Status::OK;
+    }
+
+    void updateFilter() {
+        _designed = FilterCoefficients<T>{.b = b, .a = a};
+        _filter   = filter::Filter<T, std::dynamic_extent, kForm>(_designed);
     }
 };
 
@@ -140,7 +122,8 @@ with selectable filter type (low-pass, high-pass, band-pass, band-stop), and sup
 
     using FilterImpl = std::conditional_t<UncertainValueLike<T>, filter::ErrorPropagatingFilter<T>, filter::Filter<T>>;
 
-    FilterImpl _filter;
+    FilterImpl     _filter;
+    std::vector<T> _filtered; // scratch buffer for bulk filtering prior to decimation
 
     // Public settings
     Annotated<std::string, "filter_type", Doc<"Filter type ('FIR' or 'IIR')">, Visible>                                                filter_type     = std::string(magic_enum::enum_name(_filter_type));
@@ -204,11 +187,19 @@ with selectable filter type (low-pass, high-pass, band-pass, band-stop), and sup
         assert(output.size() >= input.size() / decimate);
 
         std::size_t out_sample_idx = 0;
-        for (std::size_t i = 0; i < input.size(); ++i) {
-            T output_sample = _filter.processOne(input[i]);
+        if constexpr (requires(std::span<T> data) { _filter.process(input, data); }) {
+            _filtered.resize(input.size());
+            _filter.process(input, _filtered);
+            for (std::size_t i = 0; i < input.size(); i += decimate) {
+                output[out_sample_idx++] = _filtered[i];
+            }
+        } else {
+            for (std::size_t i = 0; i < input.size(); ++i) {
+                T output_sample = _filter.processOne(input[i]);
 
-            if (i % decimate == 0) {
-                output[out_sample_idx++] = output_sample;
+                if (i % decimate == 0) {
+                    output[out_sample_idx++] = output_sample;
+                }
             }
         }
         return work::Status::OK;
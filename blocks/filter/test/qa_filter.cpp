@@ -7,6 +7,7 @@
 #include <gnuradio-4.0/Scheduler.hpp>
 #include <gnuradio-4.0/meta/UncertainValue.hpp>
 
+#include <gnuradio-4.0/filter/FastFirFilter.hpp>
 #include <gnuradio-4.0/filter/time_domain_filter.hpp>
 #include <gnuradio-4.0/testing/NullSources.hpp>
 
@@ -43,6 +44,19 @@ constexpr size_t estimate_settling_time(const Range& step_response, std::size_t
     return static_cast<std::size_t>(std::distance(begin, it));
 }
 
+template<typename TFilter>
+std::vector<double> iirStepResponse(TFilter& filter, const std::vector<double>& b, const std::vector<double>& a, std::size_t nSamples) {
+    filter.b = b;
+    filter.a = a;
+    filter.settingsChanged({}, {{"b", b}, {"a", a}});
+
+    std::vector<double> input(nSamples, 1.0); // step function
+    input[0] = 0.0;
+    std::vector<double> output(nSamples);
+    std::ignore = filter.processBulk(input, output);
+    return output;
+}
+
 const boost::ut::suite SequenceTests = [] {
     using namespace boost::ut;
     using namespace gr::filter;
@@ -56,23 +70,16 @@ const boost::ut::suite SequenceTests = [] {
         fir_filter<double> fir_filter;
         fir_filter.b = fir_coeffs;
 
-        iir_filter<double, IIRForm::DF_I> iir_filter1;
-        iir_filter1.b = iir_coeffs_b;
-        iir_filter1.a = iir_coeffs_a;
+        iir_filter<double, IIRForm::DF_I>  iir_filter1;
         iir_filter<double, IIRForm::DF_II> iir_filter2;
-        iir_filter2.b = iir_coeffs_b;
-        iir_filter2.a = iir_coeffs_a;
 
         std::vector<double> fir_response;
-        std::vector<double> iir_response1;
-        std::vector<double> iir_response2;
         for (std::size_t i = 0UL; i < 20; ++i) {
             const double input = (i == 0) ? 0.0 : 1.0; // Step function
-
             fir_response.push_back(fir_filter.processOne(input));
-            iir_response1.push_back(iir_filter1.processOne(input));
-            iir_response2.push_back(iir_filter1.processOne(input));
         }
+        const std::vector<double> iir_response1 = iirStepResponse(iir_filter1, iir_coeffs_b, iir_coeffs_a, 20UZ);
+        const std::vector<double> iir_response2 = iirStepResponse(iir_filter2, iir_coeffs_b, iir_coeffs_a, 20UZ);
         expect(eq(fir_response[0], 0.0));
         expect(eq(iir_response1[0], 0.0));
         expect(eq(iir_response2[0], 0.0));
@@ -81,45 +88,59 @@ const boost::ut::suite SequenceTests = [] {
         const std::size_t iir_settling_time1 = estimate_settling_time<double>(iir_response1);
         const std::size_t iir_settling_time2 = estimate_settling_time<double>(iir_response2);
         expect(eq(fir_settling_time, 10u)) << "FIR settling time";
-        expect(eq(iir_settling_time1, 5u)) << "IIR (I) settling time";
-        expect(eq(iir_settling_time2, 5u)) << "IIR (II) settling time";
+        expect(eq(iir_settling_time1, 9u)) << "IIR (I) settling time: 1 - 0.45^n within 0.001";
+        expect(eq(iir_settling_time2, 9u)) << "IIR (II) settling time: 1 - 0.45^n within 0.001";
 
         fmt::println("FIR      filter settling time: {} ms", fir_settling_time);
         fmt::println("IIR (I)  filter settling time: {} ms", iir_settling_time1);
         fmt::println("IIR (II) filter settling time: {} ms", iir_settling_time2);
     };
 
+    "IIR coefficients assigned without settings update"_test = [] { // e.g. blocks used inside 'merge<..>(..)'
+        const std::vector<double> iir_coeffs_b{0.55, 0};
+        const std::vector<double> iir_coeffs_a{1, -0.45};
+
+        iir_filter<double, IIRForm::DF_II> reference;
+        const std::vector<double>          expected = iirStepResponse(reference, iir_coeffs_b, iir_coeffs_a, 20UZ);
+
+        iir_filter<double, IIRForm::DF_II> filter;
+        filter.b = iir_coeffs_b;
+        filter.a = iir_coeffs_a;
+        std::vector<double> input(20UZ, 1.0);
+        input[0] = 0.0;
+        std::vector<double> output(input.size());
+        expect(filter.processBulk(input, output) == gr::work::Status::OK);
+        for (std::size_t i = 0UZ; i < output.size(); ++i) {
+            expect(approx(output[i], expected[i], 1e-12)) << fmt::format("sample {}", i);
+        }
+    };
+
     "IIR equality tests"_test = [] {
         std::vector<double> iir_coeffs_b{0.020083365564211, 0.040166731128423, 0.020083365564211};
         std::vector<double> iir_coeffs_a{1.0, -1.561018075800718, 0.641351538057563};
 
-        iir_filter<double, IIRForm::DF_I> iir_filter_I;
-        iir_filter_I.b = iir_coeffs_b;
-        iir_filter_I.a = iir_coeffs_a;
-        iir_filter<double, IIRForm::DF_II> iir_filter_II;
-        iir_filter_II.b = iir_coeffs_b;
-        iir_filter_II.a = iir_coeffs_a;
-        iir_filter<double, IIRForm::DF_I_TRANSPOSED> iir_filter_IT;
-        iir_filter_IT.b = iir_coeffs_b;
-        iir_filter_IT.a = iir_coeffs_a;
+        iir_filter<double, IIRForm::DF_I>             iir_filter_I;
+        iir_filter<double, IIRForm::DF_II>            iir_filter_II;
+        iir_filter<double, IIRForm::DF_I_TRANSPOSED>  iir_filter_IT;
         iir_filter<double, IIRForm::DF_II_TRANSPOSED> iir_filter_IIT;
-        iir_filter_IIT.b = iir_coeffs_b;
-        iir_filter_IIT.a = iir_coeffs_a;
+        const std::vector<double>                     response_I    = iirStepResponse(iir_filter_I, iir_coeffs_b, iir_coeffs_a, 20UZ);
+        const std::vector<double>                     response_II   = iirStepResponse(iir_filter_II, iir_coeffs_b, iir_coeffs_a, 20UZ);
+        const std::vector<double>                     response_I_T  = iirStepResponse(iir_filter_IT, iir_coeffs_b, iir_coeffs_a, 20UZ);
+        const std::vector<double>                     response_II_T = iirStepResponse(iir_filter_IIT, iir_coeffs_b, iir_coeffs_a, 20UZ);
 
         constexpr double tolerance = 0.00001;
         for (std::size_t i = 0UL; i < 20; ++i) {
-            const double input     = (i == 0) ? 0.0 : 1.0; // Step function
-            const auto   form_I    = iir_filter_I.processOne(input);
-            const auto   form_II   = iir_filter_II.processOne(input);
-            const auto   form_I_T  = iir_filter_IT.processOne(input);
-            const auto   form_II_T = iir_filter_IIT.processOne(input);
+            const auto form_I    = response_I[i];
+            const auto form_II   = response_II[i];
+            const auto form_I_T  = response_I_T[i];
+            const auto form_II_T = response_II_T[i];
             expect(approx(form_II, form_I, tolerance)) << "direct form II";
             expect(approx(form_I_T, form_I, tolerance)) << "direct form I - transposed";
             expect(approx(form_II_T, form_I, tolerance)) << "direct form II - transposed";
 
 #if defined(__GNUC__) && !defined(__OPTIMIZE__)
             fmt::print("input[{:2}]={}-> IIR= {:4.2f} (I) {:4.2f} (II) {:4.2f} (I-T) {:4.2f} (II-T)\n", //
-                i, input, form_I, form_II, form_I_T, form_II_T);
+                i, (i == 0) ? 0.0 : 1.0, form_I, form_II, form_I_T, form_II_T);
 #endif
         }
     };
@@ -288,4 +309,63 @@ const boost::ut::suite<"Basic[Decimating]Filter"> BasicFilterTests = [] {
     };
 };
 
+const boost::ut::suite<"FastFirFilter"> FastFirFilterTests = [] {
+    using namespace boost::ut;
+    using namespace gr::filter;
+
+    "FastFirFilter equivalence with fir_filter"_test = [](const std::string& mode) {
+        using T = double;
+        std::vector<T> taps(200UZ);
+        for (std::size_t i = 0UZ; i < taps.size(); ++i) { // arbitrary, asymmetric impulse response
+            taps[i] = std::sin(0.1 * static_cast<T>(i)) / static_cast<T>(i + 1UZ);
+        }
+        std::vector<T> input(10'000UZ);
+        for (std::size_t i = 0UZ; i < input.size(); ++i) {
+            input[i] = std::cos(0.013 * static_cast<T>(i * i % 1000UZ)) + ((i % 7UZ == 0UZ) ? 1. : 0.);
+        }
+
+        fir_filter<T> reference;
+        reference.b = taps;
+        reference.settingsChanged({}, {{"b", taps}});
+
+        FastFirFilter<T> filter;
+        filter.b    = taps;
+        filter.mode = mode;
+        filter.settingsChanged({}, {{"b", taps}, {"mode", mode}});
+        expect(eq(filter._convolution.nTaps(), taps.size()));
+        expect(gt(filter._convolution.fftSize(), taps.size()));
+        if (mode == "FFT") {
+            expect(filter._convolution.usesFft());
+        }
+
+        std::vector<T> output(input.size());
+        std::size_t    chunkSize = 1UZ;
+        for (std::size_t pos = 0UZ; pos < input.size();) { // irregular chunks, shorter and longer than the FFT block size
+            const std::size_t n = std::min(chunkSize, input.size() - pos);
+            expect(filter.processBulk(std::span(input).subspan(pos, n), std::span(output).subspan(pos, n)) == gr::work::Status::OK);
+            pos += n;
+            chunkSize = (chunkSize * 7UZ) % 3001UZ + 1UZ;
+        }
+
+        const std::size_t latency = filter._convolution.latency();
+        expect(eq(latency, filter._convolution.usesFft() ? filter._convolution.blockSize() : 0UZ));
+        for (std::size_t i = 0UZ; i < latency; ++i) {
+            expect(approx(output[i], T{0}, 1e-9)) << fmt::format("mode {} sample {} before the first complete block", mode, i);
+        }
+        for (std::size_t i = latency; i < input.size(); ++i) {
+            expect(approx(output[i], reference.processOne(input[i - latency]), 1e-9)) << fmt::format("mode {} sample {}", mode, i);
+        }
+    } | std::vector<std::string>({"Direct", "FFT", "Auto"});
+
+    "FastFirFilter invalid settings"_test = [] {
+        FastFirFilter<float> filter;
+        expect(nothrow([&filter] { filter.settingsChanged({}, {{"fft_size", 0U}}); })) << "automatic FFT size";
+        filter.fft_size = 100U; // not a power of two
+        expect(throws([&filter] { filter.settingsChanged({}, {{"fft_size", 100U}}); }));
+        filter.fft_size = 0U;
+        filter.mode     = "unknown";
+        expect(throws([&filter] { filter.settingsChanged({}, {{"mode", std::string("unknown")}}); }));
+    };
+};
+
 int main() { /* not needed for UT */ }
@@ -117,12 +117,16 @@ On the choice of window (mathematically aka. apodisation) functions
 
     // semi-private caching vectors (need to be public for unit-test) -> TODO: move to FFT implementations, casting from T -> U::value_type should be done there
     std::vector<InDataType>  _inData             = std::vector<InDataType>(fftSize, 0);
-    std::vector<OutDataType> _outData            = std::vector<OutDataType>(gr::meta::complex_like<T> ? fftSize.value : (1U + fftSize.value / 2U), 0);
-    std::vector<value_type>  _magnitudeSpectrum  = std::vector<value_type>(gr::meta::complex_like<T> ? fftSize.value : (1U + fftSize.value / 2U), 0);
-    std::vector<value_type>  _phaseSpectrum      = std::vector<value_type>(gr::meta::complex_like<T> ? fftSize.value : (1U + fftSize.value / 2U), 0);
+    std::vector<OutDataType> _outData            = std::vector<OutDataType>(fftSize, 0);
     constexpr static bool    computeFullSpectrum = gr::meta::complex_like<T>;
 
+    // cached signal and axis labels -> avoids re-formatting (and allocating) them for every output DataSet
+    std::vector<std::string> _signalNames{};
+    std::vector<std::string> _signalUnits{};
+
     void settingsChanged(const property_map& /*old_settings*/, const property_map& newSettings) noexcept {
+        _signalNames.clear(); // lazily re-generated by the next updateDataset(..)
+
         if (!newSettings.contains("fftSize") && !newSettings.contains("window")) {
             // do need to only handle interdependent settings -> can early return
             return;
@@ -139,75 +143,86 @@ On the choice of window (mathematically aka. apodisation) functions
 
         // N.B. this should become part of the Fourier transform implementation
         _inData.resize(fftSize, 0);
-        _outData.resize(computeFullSpectrum ? newSize : (1U + newSize / 2), 0);
-        _magnitudeSpectrum.resize(computeFullSpectrum ? newSize : (newSize / 2), 0);
-        _phaseSpectrum.resize(computeFullSpectrum ? newSize : (newSize / 2), 0);
+        _outData.resize(fftSize, 0);
     }
 
     [[nodiscard]] constexpr work::Status processBulk(std::span<const T> input, std::span<U> output) {
-        if constexpr (std::is_same_v<T, InDataType>) {
-            std::copy_n(input.begin(), fftSize, _inData.begin());
-        } else {
-            std::ranges::transform(input.begin(), input.end(), _inData.begin(), [](const T c) { return static_cast<InDataType>(c); });
-        }
+        // convert (if needed) and apply window function in a single pass
+        gr::algorithm::fft::applyWindow(input.first(_inData.size()), std::span<const value_type>(_window), std::span(_inData));
 
-        // apply window function
-        for (std::size_t i = 0U; i < fftSize; i++) {
-            if constexpr (gr::meta::complex_like<T>) {
-                _inData[i].real(_inData[i].real() * _window[i]);
-                _inData[i].imag(_inData[i].imag() * _window[i]);
-            } else {
-                _inData[i] *= _window[i];
-            }
-        }
-
-        _outData           = _fftImpl.compute(_inData);
-        _magnitudeSpectrum = gr::algorithm::fft::computeMagnitudeSpectrum(_outData, _magnitudeSpectrum, algorithm::fft::ConfigMagnitude{.computeHalfSpectrum = !computeFullSpectrum, .outputInDb = outputInDb});
-        _phaseSpectrum     = gr::algorithm::fft::computePhaseSpectrum(_outData, _phaseSpectrum, algorithm::fft::ConfigPhase{.computeHalfSpectrum = !computeFullSpectrum, .outputInDeg = outputInDeg, .unwrapPhase = unwrapPhase});
+        std::ignore = _fftImpl.compute(_inData, _outData);
 
-        output[0] = createDataset();
+        updateDataset(output[0]); // N.B. re-uses the storage of the (already consumed) DataSet previously held by the output buffer slot
 
         return work::Status::OK;
     }
 
     constexpr U createDataset() {
         U ds{};
+        updateDataset(ds);
+        return ds;
+    }
+
+    /**
+     * @brief (re-)assigns all fields of 'ds' in-place, i.e. without reallocating if 'ds' held a DataSet of the same dimensions before.
+     */
+    constexpr void updateDataset(U& ds) {
+        if (_signalNames.empty()) {
+            _signalNames = {signal_name, fmt::format("Re(FFT({}))", signal_name), fmt::format("Im(FFT({}))", signal_name), fmt::format("Magnitude({})", signal_name), fmt::format("Phase({})", signal_name)};
+            _signalUnits = {"Hz", signal_unit, fmt::format("i{}", signal_unit), fmt::format("{}/√Hz", signal_unit), "rad"};
+        }
         ds.timestamp = 0;
-        const std::size_t N{_magnitudeSpectrum.size()};
+        const std::size_t N{computeFullSpectrum ? _outData.size() : (_outData.size() / 2UZ)};
         const std::size_t dim = 5;
 
-        ds.axis_names   = {"Frequency", "Re(FFT)", "Im(FFT)", "Magnitude", "Phase"};
-        ds.axis_units   = {"Hz", signal_unit, fmt::format("i{}", signal_unit), fmt::format("{}/√Hz", signal_unit), "rad"};
-        ds.extents      = {dim, static_cast<int32_t>(N)};
+        constexpr std::array<std::string_view, dim> axisNames{"Frequency", "Re(FFT)", "Im(FFT)", "Magnitude", "Phase"};
+        ds.axis_names.assign(axisNames.begin(), axisNames.end());
+        ds.axis_units   = _signalUnits;
+        ds.extents.assign({dim, static_cast<int32_t>(N)});
         ds.layout       = gr::LayoutRight{};
-        ds.signal_names = {signal_name, fmt::format("Re(FFT({}))", signal_name), fmt::format("Im(FFT({}))", signal_name), fmt::format("Magnitude({})", signal_name), fmt::format("Phase({})", signal_name)};
-        ds.signal_units = {"Hz", signal_unit, fmt::format("i{}", signal_unit), fmt::format("{}/√Hz", signal_unit), "rad"};
+        ds.signal_names = _signalNames;
+        ds.signal_units = _signalUnits;
 
         ds.signal_values.resize(dim * N);
-        auto const freqWidth = static_cast<value_type>(sample_rate) / static_cast<value_type>(fftSize);
-        if constexpr (gr::meta::complex_like<T>) {
-            auto const freqOffset = static_cast<value_type>(N / 2) * freqWidth;
-            std::ranges::transform(std::views::iota(0UL, N), std::ranges::begin(ds.signal_values), [freqWidth, freqOffset](const auto i) { return static_cast<value_type>(i) * freqWidth - freqOffset; });
-        } else {
-            std::ranges::transform(std::views::iota(0UL, N), std::ranges::begin(ds.signal_values), [freqWidth](const auto i) { return static_cast<value_type>(i) * freqWidth; });
-        }
-        std::ranges::transform(_outData.begin(), _outData.end(), std::next(ds.signal_values.begin(), static_cast<std::ptrdiff_t>(N)), [](const auto& c) { return c.real(); });
-        std::ranges::transform(_outData.begin(), _outData.end(), std::next(ds.signal_values.begin(), static_cast<std::ptrdiff_t>(2U * N)), [](const auto& c) { return c.imag(); });
-        std::copy_n(_magnitudeSpectrum.begin(), N, std::next(ds.signal_values.begin(), static_cast<std::ptrdiff_t>(3U * N)));
-        std::copy_n(_phaseSpectrum.begin(), N, std::next(ds.signal_values.begin(), static_cast<std::ptrdiff_t>(4U * N)));
+        auto signal = [&ds, N](std::size_t i) { return std::span(ds.signal_values).subspan(i * N, N); };
+
+        auto const freqWidth  = static_cast<value_type>(sample_rate) / static_cast<value_type>(fftSize);
+        auto const freqOffset = computeFullSpectrum ? static_cast<value_type>(N / 2) * freqWidth : value_type(0);
+        std::ranges::transform(std::views::iota(0UL, N), signal(0UZ).begin(), [freqWidth, freqOffset](const auto i) { return static_cast<value_type>(i) * freqWidth - freqOffset; });
+
+        // single (SIMD) pass for real, imaginary, magnitude, phase spectra and their min/max ranges
+        const auto ranges = gr::algorithm::fft::computeSpectrum(std::span<const OutDataType>(_outData), signal(1UZ), signal(2UZ), signal(3UZ), signal(4UZ), //
+            algorithm::fft::ConfigSpectrum{.outputInDb = outputInDb, .outputInDeg = outputInDeg, .unwrapPhase = unwrapPhase});
 
+        const std::array<std::array<value_type, 2UZ>, dim> signalRanges{{{signal(0UZ).front(), signal(0UZ).back()}, {ranges.real.min, ranges.real.max}, {ranges.imag.min, ranges.imag.max}, {ranges.magnitude.min, ranges.magnitude.max}, {ranges.phase.min, ranges.phase.max}}};
         ds.signal_ranges.resize(dim);
-        for (std::size_t i = 0; i < dim; i++) {
-            const auto mm       = std::minmax_element(std::next(ds.signal_values.begin(), static_cast<std::ptrdiff_t>(i * N)), std::next(ds.signal_values.begin(), static_cast<std::ptrdiff_t>((i + 1U) * N)));
-            ds.signal_ranges[i] = {*mm.first, *mm.second};
+        for (std::size_t i = 0UZ; i < dim; i++) {
+            ds.signal_ranges[i].assign(signalRanges[i].begin(), signalRanges[i].end());
         }
 
-        ds.signal_errors    = {};
-        ds.meta_information = {{{"sample_rate", sample_rate}, {"signal_name", signal_name}, {"signal_unit", signal_unit}, {"signal_min", signal_min}, {"signal_max", signal_max}, //
-            {"fft_size", fftSize}, {"window", window}, {"output_in_db", outputInDb}, {"output_in_deg", outputInDeg}, {"unwrap_phase", unwrapPhase},                               //
-            {"input_chunk_size", this->input_chunk_size}, {"output_chunk_size", this->output_chunk_size}, {"stride", this->stride}}};
-
-        return ds;
+        ds.signal_errors.clear();
+        ds.meta_information.resize(1UZ); // keys are always the same -> existing entries are overwritten
+        auto&      meta = ds.meta_information[0];
+        const auto set  = [&meta](std::string_view key, const auto& value) { // N.B. heterogeneous lookup -> no (non-SSO) key allocation for existing entries
+            if (auto it = meta.find(key); it != meta.end()) {
+                it->second = value;
+            } else {
+                meta.emplace(std::string(key), value);
+            }
+        };
+        set("sample_rate", sample_rate.value);
+        set("signal_name", signal_name.value);
+        set("signal_unit", signal_unit.value);
+        set("signal_min", signal_min.value);
+        set("signal_max", signal_max.value);
+        set("fft_size", fftSize.value);
+        set("window", window.value);
+        set("output_in_db", outputInDb.value);
+        set("output_in_deg", outputInDeg.value);
+        set("unwrap_phase", unwrapPhase.value);
+        set("input_chunk_size", this->input_chunk_size.value);
+        set("output_chunk_size", this->output_chunk_size.value);
+        set("stride", this->stride.value);
     }
 };
 
@@ -0,0 +1,122 @@
+#ifndef GNURADIO_ALLOCATIONCOUNTER_HPP
+#define GNURADIO_ALLOCATIONCOUNTER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <new>
+#include <string>
+#include <tuple>
+#include <utility>
+
+namespace gr::testing::allocation {
+
+/**
+ * Opt-in heap allocation counting for tests and benchmarks.
+ *
+ * Linking the 'gr-testing-allocation-hooks' (object) library into an executable replaces the global 'operator new/delete'
+ * by counting versions (N.B. malloc/free-based, no other behavioural change). Without the hooks all counts remain zero,
+ * which tests can detect via 'hooksInstalled()'. Counts are kept per thread (for attributing allocations to a scope or a
+ * block's 'work(..)' call) and globally (all threads).
+ *
+ * @code
+ * allocation::Scope scope;
+ * block.work(1024UZ);
+ * expect(eq(scope.counts().nAllocations, 0UZ));
+ * @endcode
+ */
+struct Counts {
+    std::size_t nAllocations   = 0UZ;
+    std::size_t nDeallocations = 0UZ;
+    std::size_t nBytes         = 0UZ; // allocated bytes
+
+    [[nodiscard]] constexpr Counts operator-(const Counts& other) const noexcept { return {nAllocations - other.nAllocations, nDeallocations - other.nDeallocations, nBytes - other.nBytes}; }
+
+    constexpr Counts& operator+=(const Counts& other) noexcept {
+        nAllocations += other.nAllocations;
+        nDeallocations += other.nDeallocations;
+        nBytes += other.nBytes;
+        return *this;
+    }
+
+    [[nodiscard]] constexpr bool operator==(const Counts&) const noexcept = default;
+};
+
+namespace detail {
+// N.B. constant-initialised and trivially destructible -> safe to be used from within 'operator new/delete'
+inline thread_local constinit Counts      threadCounts{};
+inline constinit std::atomic<std::size_t> globalAllocations{0UZ};
+inline constinit std::atomic<std::size_t> globalDeallocations{0UZ};
+inline constinit std::atomic<std::size_t> globalBytes{0UZ};
+} // namespace detail
+
+/// called by the replaceable 'operator new' of 'gr-testing-allocation-hooks'
+inline void recordAllocation(std::size_t nBytes) noexcept {
+    detail::threadCounts.nAllocations++;
+    detail::threadCounts.nBytes += nBytes;
+    detail::globalAllocations.fetch_add(1UZ, std::memory_order_relaxed);
+    detail::globalBytes.fetch_add(nBytes, std::memory_order_relaxed);
+}
+
+/// called by the replaceable 'operator delete' of 'gr-testing-allocation-hooks'
+inline void recordDeallocation() noexcept {
+    detail::threadCounts.nDeallocations++;
+    detail::globalDeallocations.fetch_add(1UZ, std::memory_order_relaxed);
+}
+
+/// allocations performed by the calling thread since its start
+[[nodiscard]] inline Counts thisThread() noexcept { return detail::threadCounts; }
+
+/// allocations performed by all threads since the program start
+[[nodiscard]] inline Counts global() noexcept { return {detail::globalAllocations.load(std::memory_order_relaxed), detail::globalDeallocations.load(std::memory_order_relaxed), detail::globalBytes.load(std::memory_order_relaxed)}; }
+
+/// true if the counting 'operator new/delete' are linked into the executable
+[[nodiscard]] inline bool hooksInstalled() noexcept {
+    const Counts before = thisThread();
+    ::operator delete(::operator new(1UZ)); // N.B. unlike new-expressions, direct operator calls must not be elided
+    return thisThread().nAllocations != before.nAllocations;
+}
+
+/**
+ * @brief RAII scope counting the allocations of the calling thread between its construction and 'counts()'.
+ */
+class Scope {
+    Counts _start = thisThread();
+
+public:
+    [[nodiscard]] Counts counts() const noexcept { return thisThread() - _start; }
+    void                 reset() noexcept { _start = thisThread(); }
+};
+
+template<typename Fn>
+[[nodiscard]] Counts count(Fn&& fn) {
+    Scope scope;
+    std::forward<Fn>(fn)();
+    return scope.counts();
+}
+
+/**
+ * @brief per-block attribution: executes 'nPasses' passes of 'work(requestedWork)' over all blocks of the (initialised, i.e.
+ * connected and RUNNING) graph and returns the allocations of each block's 'work(..)' calls, indexed by its unique name.
+ */
+template<typename TGraph>
+[[nodiscard]] std::map<std::string, Counts, std::less<>> countWorkPerBlock(TGraph& graph, std::size_t nPasses, std::size_t requestedWork = std::numeric_limits<std::size_t>::max()) {
+    std::map<std::string, Counts, std::less<>> result;
+    for (const auto& block : graph.blocks()) {
+        result.try_emplace(std::string(block->uniqueName()));
+    }
+    for (std::size_t pass = 0UZ; pass < nPasses; pass++) {
+        for (const auto& block : graph.blocks()) {
+            Scope scope;
+            std::ignore         = block->work(requestedWork);
+            const Counts counts = scope.counts();
+            result.find(block->uniqueName())->second += counts;
+        }
+    }
+    return result;
+}
+
+} // namespace gr::testing::allocation
+
+#endif // GNURADIO_ALLOCATIONCOUNTER_HPP
@@ -0,0 +1,162 @@
+#ifndef GNURADIO_LATENCYMONITOR_HPP
+#define GNURADIO_LATENCYMONITOR_HPP
+
+#include <chrono>
+#include <map>
+#include <string>
+
+#include <fmt/format.h>
+
+#include <gnuradio-4.0/Block.hpp>
+#include <gnuradio-4.0/BlockRegistry.hpp>
+#include <gnuradio-4.0/LatencyProbe.hpp>
+#include <gnuradio-4.0/Tag.hpp>
+#include <gnuradio-4.0/meta/reflection.hpp>
+#include <gnuradio-4.0/testing/PerformanceMonitor.hpp>
+
+namespace gr::testing {
+
+template<typename T>
+struct LatencyProbeInjector : public Block<LatencyProbeInjector<T>> {
+    using Description = Doc<R""(Passes samples through and periodically attaches a `gr::tag::LATENCY_PROBE` tag carrying the current monotonic time.
+Place it directly after a source: the probe travels with the regular tag forwarding and downstream blocks (e.g. `LatencyMonitor`) measure its age.
+The probe 'source' (i.e. path name) is this block's unique name unless `path_name` is set.)"">;
+
+    PortIn<T>  in;
+    PortOut<T> out;
+
+    Annotated<float, "probe period", Unit<"s">, Doc<"inject a probe approx. every `N` seconds (0: with every work call)">, Visible> probe_period = 0.1f;
+    Annotated<std::string, "path name", Doc<"name identifying the path in the latency statistics, `` -> unique_name">>                 path_name;
+
+    GR_MAKE_REFLECTABLE(LatencyProbeInjector, in, out, probe_period, path_name);
+
+    gr::Size_t    n_probes{0U};
+    std::uint64_t _lastProbeNs{0U};
+
+    void start() {
+        n_probes     = 0U;
+        _lastProbeNs = 0U;
+    }
+
+    work::Status processBulk(std::span<const T> input, std::span<T> output) {
+        std::copy_n(input.begin(), std::min(input.size(), output.size()), output.begin());
+        const std::uint64_t nowNs = latency::nowNs();
+        if (!input.empty() && static_cast<double>(nowNs - _lastProbeNs) >= static_cast<double>(probe_period.value) * 1e9) {
+            this->publishTag(property_map{latency::makeProbe(path_name.value.empty() ? std::string_view(this->unique_name) : std::string_view(path_name.value), nowNs)}, 0UZ);
+            _lastProbeNs = nowNs;
+            n_probes++;
+        }
+        return work::Status::OK;
+    }
+};
+
+template<typename T>
+struct LatencyMonitor : public Block<LatencyMonitor<T>> {
+    using Description = Doc<R""(The `LatencyMonitor` sink tracks the end-to-end latency of `gr::tag::LATENCY_PROBE` tags (e.g. injected by `LatencyProbeInjector`).
+It keeps one latency histogram (count, mean, p50/p90/p99, max) per probe path and publishes them via the `LatencyStats` property:
+`Get` returns, `Set` returns and resets the statistics, and subscribers are notified approximately every `publish_rate` seconds.
+)"">;
+
+    static inline const char* kLatencyStats = "LatencyStats";
+
+    PortIn<T> in;
+
+    gr::Annotated<float, "in sec", Doc<"notify subscribers approx. every `N` seconds">, Visible> publish_rate{1.f};
+    gr::Annotated<bool, "verbose console", Doc<"print the latency statistics when publishing">> verbose_console = false;
+
+    GR_MAKE_REFLECTABLE(LatencyMonitor, in, publish_rate, verbose_console);
+
+    gr::Size_t n_publishes{0U};
+
+    std::map<std::string, latency::Histogram, std::less<>> _histograms; // per probe path, N.B. node-based: histograms are not movable
+    std::chrono::steady_clock::time_point                  _lastPublish = std::chrono::steady_clock::now();
+
+    LatencyMonitor(property_map initParameters = {}) : Block<LatencyMonitor<T>>(std::move(initParameters)) {
+        this->propertyCallbacks[kLatencyStats] = &LatencyMonitor::propertyCallbackLatencyStats;
+    }
+
+    void start() {
+        _lastPublish = std::chrono::steady_clock::now();
+        n_publishes  = 0U;
+    }
+
+    void stop() { publish(); }
+
+    work::Status processBulk(std::span<const T> /*input*/) {
+        if (this->inputTagsPresent()) {
+            const property_map& tagMap = this->mergedInputTag().map;
+            if (const auto ageNs = latency::probeAgeNs(tagMap); ageNs.has_value()) {
+                const std::string_view path = latency::probeSource(tagMap).value_or("");
+                auto                   it   = _histograms.find(path);
+                if (it == _histograms.end()) {
+                    it = _histograms.try_emplace(std::string(path)).first;
+                }
+                it->second.record(*ageNs);
+            }
+        }
+
+        if (std::chrono::duration<float>(std::chrono::steady_clock::now() - _lastPublish).count() >= publish_rate.value) {
+            publish();
+        }
+        return work::Status::OK;
+    }
+
+    /// latency statistics per probe path, @see latency::Histogram::toPropertyMap()
+    [[nodiscard]] property_map latencyStats() const {
+        property_map result;
+        for (const auto& [path, histogram] : _histograms) {
+            result[path] = histogram.toPropertyMap();
+        }
+        return result;
+    }
+
+    [[nodiscard]] const latency::Histogram* histogram(std::string_view path) const {
+        const auto it = _histograms.find(path);
+        return it != _histograms.end() ? &it->second : nullptr;
+    }
+
+    std::optional<Message> propertyCallbackLatencyStats(std::string_view propertyName, Message message) {
+        using enum gr::message::Command;
+        assert(propertyName == kLatencyStats);
+
+        switch (message.cmd) {
+        case Get:
+        case Set: // N.B. returns and resets the statistics
+            message.data = latencyStats();
+            if (message.cmd == Set) {
+                std::ranges::for_each(_histograms, [](auto& entry) { entry.second.reset(); });
+            }
+            return message;
+        case Subscribe:
+            if (!message.clientRequestID.empty()) {
+                this->propertySubscriptions[std::string(propertyName)].insert(message.clientRequestID);
+            }
+            return std::nullopt;
+        case Unsubscribe: this->propertySubscriptions[std::string(propertyName)].erase(message.clientRequestID); return std::nullopt;
+        default: throw gr::exception(fmt::format("block {} property {} does not implement command {}, msg: {}", this->unique_name, propertyName, message.cmd, message));
+        }
+    }
+
+private:
+    void publish() {
+        _lastPublish = std::chrono::steady_clock::now();
+        if (_histograms.empty()) {
+            return;
+        }
+        this->notifyListeners(kLatencyStats, latencyStats());
+        if (verbose_console) {
+            for (const auto& [path, histogram] : _histograms) {
+                fmt::println("Latency at {}, #{} path:'{}' probes:{} p50:{} p99:{} max:{}", gr::time::getIsoTime(), n_publishes, path, histogram.count(), //
+                    details::to_si_prefix(static_cast<double>(histogram.quantile(0.5)) * 1e-9), details::to_si_prefix(static_cast<double>(histogram.quantile(0.99)) * 1e-9), details::to_si_prefix(static_cast<double>(histogram.max()) * 1e-9));
+            }
+        }
+        n_publishes++;
+    }
+};
+
+} // namespace gr::testing
+
+auto registerLatencyProbeInjector = gr::registerBlock<gr::testing::LatencyProbeInjector, float, double>(gr::globalBlockRegistry());
+auto registerLatencyMonitor       = gr::registerBlock<gr::testing::LatencyMonitor, float, double>(gr::globalBlockRegistry());
+
+#endif // GNURADIO_LATENCYMONITOR_HPP
@@ -0,0 +1,70 @@
+// replaceable global allocation functions counting all heap allocations, @see gnuradio-4.0/testing/AllocationCounter.hpp
+// N.B. link (only) into test/benchmark executables via the 'gr-testing-allocation-hooks' object library
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+#include <gnuradio-4.0/testing/AllocationCounter.hpp>
+
+namespace {
+void* allocate(std::size_t size) noexcept {
+    void* ptr = std::malloc(size == 0UZ ? 1UZ : size);
+    if (ptr != nullptr) {
+        gr::testing::allocation::recordAllocation(size);
+    }
+    return ptr;
+}
+
+void* allocate(std::size_t size, std::align_val_t alignment) noexcept {
+    const auto  align = static_cast<std::size_t>(alignment);
+    void*       ptr   = std::aligned_alloc(align, (std::max(size, 1UZ) + align - 1UZ) / align * align); // N.B. size must be a multiple of the alignment
+    if (ptr != nullptr) {
+        gr::testing::allocation::recordAllocation(size);
+    }
+    return ptr;
+}
+
+void* allocateOrThrow(std::size_t size) {
+    if (void* ptr = allocate(size); ptr != nullptr) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* allocateOrThrow(std::size_t size, std::align_val_t alignment) {
+    if (void* ptr = allocate(size, alignment); ptr != nullptr) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void deallocate(void* ptr) noexcept {
+    if (ptr != nullptr) {
+        gr::testing::allocation::recordDeallocation();
+        std::free(ptr);
+    }
+}
+} // namespace
+
+void* operator new(std::size_t size) { return allocateOrThrow(size); }
+void* operator new[](std::size_t size) { return allocateOrThrow(size); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return allocateOrThrow(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return allocateOrThrow(size, alignment); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return allocate(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return allocate(size, alignment); }
+
+void operator delete(void* ptr) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { deallocate(ptr); }
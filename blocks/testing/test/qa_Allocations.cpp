@@ -0,0 +1,163 @@
+#include <boost/ut.hpp>
+
+#include <new>
+#include <thread>
+#include <vector>
+
+#include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/basic/ConverterBlocks.hpp>
+#include <gnuradio-4.0/basic/DataSink.hpp>
+#include <gnuradio-4.0/filter/FastFirFilter.hpp>
+#include <gnuradio-4.0/filter/time_domain_filter.hpp>
+#include <gnuradio-4.0/fourier/fft.hpp>
+#include <gnuradio-4.0/math/Math.hpp>
+#include <gnuradio-4.0/testing/AllocationCounter.hpp>
+#include <gnuradio-4.0/testing/NullSources.hpp>
+
+/*
+ * Steady-state allocation tests: after a warm-up phase (settings applied, buffers and internal state sized, all buffer slots
+ * written at least once) a block's 'work(..)' must not allocate. Executables link 'gr-testing-allocation-hooks' for counting.
+ * N.B. blocks with port collections (e.g. 'math::Add' with 'std::vector<PortIn<T>>') are not covered: 'work(..)' allocates
+ * the span vector of the collection with every call.
+ */
+
+template<typename T>
+struct DiscardSink : public gr::Block<DiscardSink<T>> { // N.B. unlike 'NullSink<T>::processOne(T)' does not copy (e.g. DataSet<T>) samples
+    gr::PortIn<T> in;
+
+    GR_MAKE_REFLECTABLE(DiscardSink, in);
+
+    [[nodiscard]] constexpr gr::work::Status processBulk(std::span<const T> /*input*/) const noexcept { return gr::work::Status::OK; }
+};
+
+constexpr std::size_t kBufferSize    = 4096UZ;
+constexpr std::size_t kWarmUpPasses  = 1024UZ; // N.B. exceeds the number of buffer slots, i.e. all output (e.g. DataSet) slots have been written once
+constexpr std::size_t kPasses        = 256UZ;
+constexpr std::size_t kRequestedWork = 4096UZ;
+
+void expectNoSteadyStateAllocations(gr::Graph& graph, std::string_view blockName, const std::source_location location = std::source_location::current()) {
+    using namespace boost::ut;
+    namespace allocation = gr::testing::allocation;
+    expect(graph.reconnectAllEdges(), location);
+    graph.forEachBlockMutable([&location](gr::BlockModel& block) { expect(block.changeState(gr::lifecycle::State::RUNNING).has_value(), location); });
+
+    std::ignore               = allocation::countWorkPerBlock(graph, kWarmUpPasses, kRequestedWork);
+    const auto countsPerBlock = allocation::countWorkPerBlock(graph, kPasses, kRequestedWork);
+
+    const auto it = countsPerBlock.find(blockName);
+    expect(fatal(it != countsPerBlock.end()), location) << fmt::format("block '{}' not found", blockName);
+    expect(eq(it->second.nAllocations, 0UZ), location) << fmt::format("'{}' allocated {} bytes in {} steady-state work calls", blockName, it->second.nBytes, kPasses);
+}
+
+template<typename TBlock, typename TIn, typename TOut = TIn>
+void testProcessingBlock(gr::property_map initParameters = {}, std::size_t outputBufferSize = kBufferSize, const std::source_location location = std::source_location::current()) {
+    using namespace boost::ut;
+    using namespace std::string_literals;
+    gr::Graph graph;
+    auto&     src   = graph.emplaceBlock<gr::testing::ConstantSource<TIn>>();
+    auto&     block = graph.emplaceBlock<TBlock>(std::move(initParameters));
+    auto&     sink  = graph.emplaceBlock<DiscardSink<TOut>>();
+    expect(eq(gr::ConnectionResult::SUCCESS, graph.connect(src, "out"s, block, "in"s, kBufferSize)), location);
+    expect(eq(gr::ConnectionResult::SUCCESS, graph.connect(block, "out"s, sink, "in"s, outputBufferSize)), location);
+    expectNoSteadyStateAllocations(graph, block.unique_name, location);
+}
+
+template<typename T, typename TBlock>
+void testSinkBlock(TBlock& sink, gr::Graph& graph, const std::source_location location = std::source_location::current()) {
+    using namespace boost::ut;
+    using namespace std::string_literals;
+    auto& src = graph.emplaceBlock<gr::testing::ConstantSource<T>>();
+    expect(eq(gr::ConnectionResult::SUCCESS, graph.connect(src, "out"s, sink, "in"s, kBufferSize)), location);
+    expectNoSteadyStateAllocations(graph, sink.unique_name, location);
+}
+
+const boost::ut::suite<"allocation counter"> _allocationCounterTests = [] {
+    using namespace boost::ut;
+    namespace allocation = gr::testing::allocation;
+
+    "hooks installed"_test = [] { expect(fatal(allocation::hooksInstalled())) << "executable needs to link 'gr-testing-allocation-hooks'"; };
+
+    "scope"_test = [] { // N.B. direct 'operator new/delete' calls, unlike new-expressions, must not be elided by the compiler
+        allocation::Scope        scope;
+        const allocation::Counts initial  = scope.counts();
+        void*                    ptr      = ::operator new(100UZ);
+        const allocation::Counts afterNew = scope.counts();
+        ::operator delete(ptr);
+        const allocation::Counts afterDelete = scope.counts();
+        scope.reset();
+        const allocation::Counts afterReset = scope.counts();
+
+        expect(initial == allocation::Counts{});
+        expect(afterNew == allocation::Counts{.nAllocations = 1UZ, .nDeallocations = 0UZ, .nBytes = 100UZ});
+        expect(afterDelete == allocation::Counts{.nAllocations = 1UZ, .nDeallocations = 1UZ, .nBytes = 100UZ});
+        expect(afterReset == allocation::Counts{});
+    };
+
+    "count"_test = [] {
+        expect(allocation::count([] {}) == allocation::Counts{});
+        expect(allocation::count([] { ::operator delete(::operator new(42UZ)); }) == allocation::Counts{.nAllocations = 1UZ, .nDeallocations = 1UZ, .nBytes = 42UZ});
+        expect(allocation::count([] { ::operator delete(::operator new(64UZ, std::align_val_t{64UZ}), std::align_val_t{64UZ}); }) == allocation::Counts{.nAllocations = 1UZ, .nDeallocations = 1UZ, .nBytes = 64UZ});
+    };
+
+    "thread attribution"_test = [] {
+        const allocation::Counts globalBefore = allocation::global();
+        allocation::Scope        scope;
+        allocation::Counts       threadCounts;
+        std::thread([&threadCounts] { threadCounts = allocation::count([] { ::operator delete(::operator new(1000UZ)); }); }).join();
+        expect(eq(threadCounts.nAllocations, 1UZ));
+        const std::size_t nOwnAllocations = scope.counts().nAllocations; // N.B. includes the thread creation, excludes the thread's allocations
+        expect(ge((allocation::global() - globalBefore).nAllocations, nOwnAllocations + threadCounts.nAllocations)) << "global counts include all threads";
+    };
+};
+
+const boost::ut::suite<"steady-state allocations"> _steadyStateTests = [] {
+    using namespace boost::ut;
+    using namespace std::string_literals;
+
+    "math"_test = [] {
+        testProcessingBlock<gr::blocks::math::MultiplyConst<float>, float>({{"value", 2.f}});
+        testProcessingBlock<gr::blocks::math::AddConst<double>, double>({{"value", 1.0}});
+        testProcessingBlock<gr::blocks::math::SubtractConst<std::int32_t>, std::int32_t>({{"value", 1}});
+    };
+
+    "converters"_test = [] {
+        testProcessingBlock<gr::blocks::type::converter::Convert<float, double>, float, double>();
+        testProcessingBlock<gr::blocks::type::converter::ScalingConvert<float, std::int16_t>, float, std::int16_t>({{"scale", 100.f}});
+    };
+
+    "filters"_test = [] {
+        testProcessingBlock<gr::filter::fir_filter<float>, float>({{"b", std::vector<float>(16UZ, 1.f / 16.f)}});
+        testProcessingBlock<gr::filter::iir_filter<float>, float>({{"b", std::vector<float>{0.5f, 0.5f}}, {"a", std::vector<float>{1.f, -0.1f}}});
+        testProcessingBlock<gr::filter::DefaultFastFirFilter<float>, float>({{"b", std::vector<float>(128UZ, 1.f / 128.f)}, {"mode", "FFT"s}});
+    };
+
+    "FFT"_test = [] {
+        using TFFT = gr::blocks::fft::DefaultFFT<float>;
+        testProcessingBlock<TFFT, float, gr::DataSet<float>>({{"fftSize", gr::Size_t(1024U)}}, 16UZ);
+    };
+
+    "sinks"_test = [] {
+        {
+            gr::Graph graph;
+            testSinkBlock<float>(graph.emplaceBlock<gr::testing::NullSink<float>>(), graph);
+        }
+        {
+            gr::Graph graph;
+            testSinkBlock<float>(graph.emplaceBlock<gr::testing::CountingSink<float>>(), graph);
+        }
+        {
+            gr::Graph graph;
+            testSinkBlock<float>(graph.emplaceBlock<gr::basic::DataSink<float>>({{"signal_name", "no listeners"s}}), graph);
+        }
+        {
+            gr::Graph   graph;
+            std::size_t nSamples = 0UZ;
+            auto&       sink     = graph.emplaceBlock<gr::basic::DataSink<float>>({{"signal_name", "streaming callback"s}});
+            sink.registerStreamingCallback(1024UZ, [&nSamples](std::span<const float> data) { nSamples += data.size(); });
+            testSinkBlock<float>(sink, graph);
+            expect(gt(nSamples, 0UZ));
+        }
+    };
+};
+
+int main() { /* not needed for UT */ }
@@ -72,6 +72,42 @@ using add_bulk = math_bulk_op<T, '+'>;
 template<typename T>
 using sub_bulk = math_bulk_op<T, '-'>;
 
+template<typename T>
+struct decimate_bulk : public gr::Block<decimate_bulk<T>, gr::Resampling<>> { // block average over 'input_chunk_size' samples
+    gr::PortIn<T>  in;
+    gr::PortOut<T> out;
+
+    GR_MAKE_REFLECTABLE(decimate_bulk, in, out);
+
+    [[nodiscard]] constexpr gr::work::Status processBulk(std::span<const T> input, std::span<T> output) const noexcept {
+        const std::size_t factor = this->input_chunk_size.value;
+        for (std::size_t i = 0; i < output.size(); i++) {
+            T sum{};
+            for (std::size_t j = 0; j < factor; j++) {
+                sum += input[i * factor + j];
+            }
+            output[i] = sum / static_cast<T>(factor);
+        }
+        return gr::work::Status::OK;
+    }
+};
+
+template<typename T>
+struct interpolate_bulk : public gr::Block<interpolate_bulk<T>, gr::Resampling<>> { // repeats each sample 'output_chunk_size' times
+    gr::PortIn<T>  in;
+    gr::PortOut<T> out;
+
+    GR_MAKE_REFLECTABLE(interpolate_bulk, in, out);
+
+    [[nodiscard]] constexpr gr::work::Status processBulk(std::span<const T> input, std::span<T> output) const noexcept {
+        const std::size_t factor = this->output_chunk_size.value;
+        for (std::size_t i = 0; i < input.size(); i++) {
+            std::fill_n(output.begin() + static_cast<std::ptrdiff_t>(i * factor), factor, input[i]);
+        }
+        return gr::work::Status::OK;
+    }
+};
+
 // Clang 15 and 16 crash on the following static_assert
 #ifndef __clang__
 static_assert(gr::traits::block::processBulk_requires_ith_output_as_span<multiply_bulk<float>, 0>);
@@ -390,6 +426,17 @@ inline const boost::ut::suite _constexpr_bm = [] {
         "merged src(N=1024)->b1(N≤128)->b2(N=1024)->b3(N=32...128)->sink"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&mergedBlock]() { loop_over_processOne(mergedBlock); };
     }
 
+    {
+        multiply_bulk<float> mult;
+        mult.value = 2.0f; // N.B. member blocks are configured via their fields before merging
+        decimate_bulk<float> decimate;
+        decimate.input_chunk_size = 4U;
+        interpolate_bulk<float> interpolate;
+        interpolate.output_chunk_size = 4U;
+        auto mergedBlock                                                                    = merge<"out", "in">(merge<"out", "in">(merge<"out", "in">(merge<"out", "in">(bm::test::source<float>({{"n_samples_max", N_SAMPLES}}), std::move(mult)), std::move(decimate)), std::move(interpolate)), bm::test::sink<float>());
+        "merged src->mult(2.0)->decim(4)->interp(4)->sink work (bulk)"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&mergedBlock]() { loop_over_work(mergedBlock); };
+    }
+
     constexpr auto templated_cascaded_test = []<typename T>(T factor, const char* test_name) {
         auto gen_mult_block                                              = [&factor] { return merge<"out", "in">(MultiplyConst<T>({{{"value", factor}}}), merge<"out", "in">(DivideConst<T>({{{"factor", factor}}}), add<T, -1>())); };
         auto mergedBlock                                                 = merge<"out", "in">(merge<"out", "in">(bm::test::source<T>({{"n_samples_max", N_SAMPLES}}), gen_mult_block()), bm::test::sink<T>());
@@ -490,6 +537,24 @@ inline const boost::ut::suite _runtime_tests = [] {
         "runtime   src(N=1024)->b1(N≤128)->b2(N=1024)->b3(N=32...128)->sink"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&sched]() { invoke_work(sched); };
     }
 
+    {
+        gr::Graph testGraph;
+        auto&     src    = testGraph.emplaceBlock<bm::test::source<float>>({{"n_samples_max", N_SAMPLES}});
+        auto&     mult   = testGraph.emplaceBlock<multiply_bulk<float>>({{"value", 2.0f}});
+        auto&     decim  = testGraph.emplaceBlock<decimate_bulk<float>>({{"input_chunk_size", gr::Size_t(4)}});
+        auto&     interp = testGraph.emplaceBlock<interpolate_bulk<float>>({{"output_chunk_size", gr::Size_t(4)}});
+        auto&     sink   = testGraph.emplaceBlock<bm::test::sink<float>>();
+
+        expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(src).to<"in">(mult)));
+        expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(mult).to<"in">(decim)));
+        expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(decim).to<"in">(interp)));
+        expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(interp).to<"in">(sink)));
+
+        gr::scheduler::Simple sched{std::move(testGraph)};
+
+        "runtime   src->mult(2.0)->decim(4)->interp(4)->sink (bulk)"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&sched]() { invoke_work(sched); };
+    }
+
     constexpr auto templated_cascaded_test = []<typename T>(T factor, const char* test_name) {
         gr::Graph testGraph;
         auto&     src  = testGraph.emplaceBlock<bm::test::source<T>>({{"n_samples_max", N_SAMPLES}});
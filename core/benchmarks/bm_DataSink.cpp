@@ -0,0 +1,64 @@
+#include <benchmark.hpp>
+
+#include <atomic>
+#include <thread>
+
+#include <fmt/format.h>
+
+#include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/Scheduler.hpp>
+
+#include <gnuradio-4.0/basic/DataSink.hpp>
+#include <gnuradio-4.0/testing/NullSources.hpp>
+
+inline constexpr std::size_t N_ITER    = 10;
+inline constexpr gr::Size_t  N_SAMPLES = gr::util::round_up(10'000'000, 1024);
+
+template<typename T>
+void testListenerFanOut(std::size_t nListeners, bool concurrentRegistration) {
+    using namespace boost::ut;
+    using namespace benchmark;
+    using namespace gr::basic;
+
+    gr::Graph testGraph;
+    auto&     src  = testGraph.emplaceBlock<gr::testing::ConstantSource<T>>({{"n_samples_max", N_SAMPLES}});
+    auto&     sink = testGraph.emplaceBlock<DataSink<T>>({{"name", "sink"}, {"signal_name", "test signal"}});
+    expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(src).template to<"in">(sink)));
+
+    std::atomic<std::size_t> nReceived{0UZ};
+    for (std::size_t i = 0UZ; i < nListeners; i++) {
+        sink.registerStreamingCallback(1024UZ, [&nReceived](std::span<const T> data) { nReceived.fetch_add(data.size(), std::memory_order_relaxed); });
+    }
+
+    gr::scheduler::Simple sched{std::move(testGraph)};
+    const auto            name = fmt::format("{:2} listener(s){}", nListeners, concurrentRegistration ? " + concurrent poller (de-)registration" : "");
+    ::benchmark::benchmark<N_ITER>(name, N_SAMPLES) = [&]() {
+        src.reset();
+        nReceived = 0UZ;
+
+        std::atomic<bool> running{true};
+        std::jthread      uiThread;
+        if (concurrentRegistration) { // emulates UI threads frequently acquiring and releasing pollers while the data is streamed
+            uiThread = std::jthread([&sink, &running] {
+                while (running.load(std::memory_order_relaxed)) {
+                    auto poller = sink.getStreamingPoller(BlockingMode::NonBlocking);
+                    std::this_thread::yield();
+                }
+            });
+        }
+        expect(sched.runAndWait().has_value());
+        running = false;
+        expect(eq(nReceived.load(), nListeners * static_cast<std::size_t>(N_SAMPLES)));
+    };
+}
+
+[[maybe_unused]] inline const boost::ut::suite data_sink_tests = [] {
+    for (const bool concurrentRegistration : {false, true}) {
+        for (const std::size_t nListeners : {1UZ, 2UZ, 4UZ, 8UZ, 16UZ, 32UZ}) {
+            testListenerFanOut<float>(nListeners, concurrentRegistration);
+        }
+        ::benchmark::results::add_separator();
+    }
+};
+
+int main() { /* not needed by the UT framework */ }
@@ -0,0 +1,51 @@
+#include <benchmark.hpp>
+
+#include <filesystem>
+
+#include <fmt/format.h>
+
+#include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/Scheduler.hpp>
+
+#include <gnuradio-4.0/fileio/BasicFileIo.hpp>
+#include <gnuradio-4.0/testing/NullSources.hpp>
+
+inline constexpr std::size_t N_ITER    = 10;
+inline constexpr gr::Size_t  N_SAMPLES = gr::util::round_up(50'000'000, 1024); // 200 MB per iteration for 'float'
+
+template<typename T>
+void testWriteThroughput(const std::filesystem::path& fileName, bool directIo, gr::Size_t bufferSize) {
+    using namespace boost::ut;
+    using namespace benchmark;
+    using namespace gr::blocks::fileio;
+
+    gr::Graph testGraph;
+    auto&     src  = testGraph.emplaceBlock<gr::testing::ConstantSource<T>>({{"n_samples_max", N_SAMPLES}});
+    auto&     sink = testGraph.emplaceBlock<BasicFileSink<T>>({{"file_name", fileName.string()}, {"mode", std::string("overwrite")}, {"direct_io", directIo}, {"buffer_size", bufferSize}});
+    expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(src).template to<"in">(sink)));
+
+    gr::scheduler::Simple sched{std::move(testGraph)};
+    const auto            name = fmt::format("BasicFileSink<{}> {:8} I/O, {:4} kiB buffers", gr::meta::type_name<T>(), directIo ? "O_DIRECT" : "buffered", bufferSize / 1024U);
+    ::benchmark::benchmark<N_ITER>(name, N_SAMPLES) = [&]() {
+        src.reset();
+        expect(sched.runAndWait().has_value());
+        expect(eq(sink._totalBytesWritten, static_cast<std::size_t>(N_SAMPLES) * sizeof(T)));
+    };
+    if (directIo && !sink._file.isDirectIo()) {
+        fmt::println("N.B. '{}' does not support O_DIRECT -> fell back to buffered I/O", fileName.parent_path().string());
+    }
+}
+
+[[maybe_unused]] inline const boost::ut::suite file_sink_tests = [] {
+    // N.B. written to the working (build) directory since '/tmp' is commonly a tmpfs, i.e. neither a disk nor O_DIRECT-capable
+    const std::filesystem::path fileName = std::filesystem::current_path() / "bm_FileIo_throughput.bin";
+    for (const bool directIo : {false, true}) {
+        for (const gr::Size_t bufferSize : {64U << 10U, 1U << 20U, 4U << 20U}) {
+            testWriteThroughput<float>(fileName, directIo, bufferSize);
+        }
+        ::benchmark::results::add_separator();
+    }
+    std::filesystem::remove(fileName);
+};
+
+int main() { /* not needed by the UT framework */ }
@@ -0,0 +1,197 @@
+#include <benchmark.hpp>
+
+#include <functional>
+#include <numeric>
+
+#include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/Scheduler.hpp>
+
+#include <gnuradio-4.0/math/Math.hpp>
+#include <gnuradio-4.0/testing/NullSources.hpp>
+
+/*
+ * Graph-level throughput of representative topologies for the available scheduler policies and buffer sizes.
+ * The benchmark names are stable identifiers for regression checks against a stored baseline, e.g.
+ *   BM_OUTPUT_FILE=baseline.json ./bm_GraphThroughput   # reference version
+ *   BM_BASELINE=baseline.json ./bm_GraphThroughput      # candidate version, fails if 'mean' or 'ops/s' regressed by > BM_REGRESSION_THRESHOLD (default: 10%)
+ * 'ops/s' refers to the samples produced by the source(s) per second.
+ */
+
+inline constexpr std::size_t N_ITER    = 5;
+inline constexpr gr::Size_t  N_SAMPLES = gr::util::round_up(4'000'000, 1024);
+
+template<typename T>
+struct Decimate : public gr::Block<Decimate<T>, gr::Resampling<>> { // averages 'input_chunk_size' samples
+    gr::PortIn<T>  in;
+    gr::PortOut<T> out;
+
+    GR_MAKE_REFLECTABLE(Decimate, in, out);
+
+    [[nodiscard]] constexpr gr::work::Status processBulk(std::span<const T> input, std::span<T> output) const noexcept {
+        const std::size_t chunkSize = this->input_chunk_size.value;
+        for (std::size_t i = 0UZ; i < output.size(); i++) {
+            const auto chunk = input.subspan(i * chunkSize, chunkSize);
+            output[i]        = std::accumulate(chunk.begin(), chunk.end(), T{}) / static_cast<T>(chunkSize);
+        }
+        return gr::work::Status::OK;
+    }
+};
+
+template<typename T>
+struct TagEmitter : public gr::Block<TagEmitter<T>> { // passes samples through and publishes a tag every 'tag_interval' samples
+    gr::PortIn<T>  in;
+    gr::PortOut<T> out;
+
+    gr::Size_t tag_interval = 1024U;
+
+    GR_MAKE_REFLECTABLE(TagEmitter, in, out, tag_interval);
+
+    gr::Size_t  _nTags{0U};
+    std::size_t _samplesSinceTag{0UZ};
+
+    void reset() {
+        _nTags           = 0U;
+        _samplesSinceTag = 0UZ;
+    }
+
+    gr::work::Status processBulk(gr::InputSpanLike auto& input, gr::OutputSpanLike auto& output) {
+        const std::size_t nSamples = std::min({input.size(), output.size(), static_cast<std::size_t>(tag_interval) - _samplesSinceTag}); // at most one tag per work call
+        if (nSamples > 0UZ && _samplesSinceTag == 0UZ) { // N.B. no tag without a sample to attach it to
+            output.publishTag(gr::property_map{{"tag_index", _nTags++}}, 0UZ);
+        }
+        std::copy_n(input.begin(), nSamples, output.begin());
+        std::ignore = input.consume(nSamples);
+        output.publish(nSamples);
+        _samplesSinceTag = (_samplesSinceTag + nSamples) % tag_interval;
+        return gr::work::Status::OK;
+    }
+};
+
+namespace topology {
+using namespace std::string_literals;
+using gr::blocks::math::DivideConst;
+using gr::blocks::math::MultiplyConst;
+
+template<typename T>
+gr::BlockModel& cascade(gr::Graph& graph, gr::BlockModel& source, std::size_t depth, std::size_t bufferSize) { // source -> (multiply -> divide)^depth, returns the last block
+    using namespace boost::ut;
+    gr::BlockModel* last = &source;
+    for (std::size_t i = 0UZ; i < depth; i++) {
+        auto& mult = graph.emplaceBlock<MultiplyConst<T>>({{"value", T(2)}});
+        auto& div  = graph.emplaceBlock<DivideConst<T>>({{"value", T(2)}});
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect(*last, "out"s, mult, "in"s, bufferSize)));
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect(mult, "out"s, div, "in"s, bufferSize)));
+        last = graph.findBlock(div).get();
+    }
+    return *last;
+}
+
+template<typename T>
+gr::BlockModel& source(gr::Graph& graph) {
+    return *graph.findBlock(graph.emplaceBlock<gr::testing::ConstantSource<T>>({{"n_samples_max", N_SAMPLES}})).get();
+}
+
+template<typename T>
+void sink(gr::Graph& graph, gr::BlockModel& last, std::size_t bufferSize) {
+    using namespace boost::ut;
+    auto& nullSink = graph.emplaceBlock<gr::testing::NullSink<T>>();
+    expect(eq(gr::ConnectionResult::SUCCESS, graph.connect(last, "out"s, nullSink, "in"s, bufferSize)));
+}
+
+template<typename T>
+gr::Graph linearChain(std::size_t bufferSize) { // src -> 10 stages -> sink
+    gr::Graph graph;
+    sink<T>(graph, cascade<T>(graph, source<T>(graph), 5UZ, bufferSize), bufferSize);
+    return graph;
+}
+
+template<typename T>
+gr::Graph fanOutFanIn(std::size_t bufferSize) { // src -> 4 x (4 stages) -> add -> sink
+    using namespace boost::ut;
+    constexpr gr::Size_t kBranches = 4U;
+    gr::Graph            graph;
+    auto&                src = source<T>(graph);
+    auto&                add = graph.emplaceBlock<gr::blocks::math::Add<T>>({{"n_inputs", kBranches}});
+    for (gr::Size_t i = 0U; i < kBranches; i++) {
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect(cascade<T>(graph, src, 2UZ, bufferSize), "out"s, add, "in#"s + std::to_string(i), bufferSize)));
+    }
+    sink<T>(graph, *graph.findBlock(add).get(), bufferSize);
+    return graph;
+}
+
+template<typename T>
+void decimatingTree(gr::Graph& graph, gr::BlockModel& parent, std::size_t depth, std::size_t bufferSize) {
+    using namespace boost::ut;
+    if (depth == 0UZ) {
+        sink<T>(graph, parent, bufferSize);
+        return;
+    }
+    for (std::size_t child = 0UZ; child < 2UZ; child++) {
+        auto& decimate = graph.emplaceBlock<Decimate<T>>({{"input_chunk_size", gr::Size_t(2)}});
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect(parent, "out"s, decimate, "in"s, bufferSize)));
+        decimatingTree<T>(graph, *graph.findBlock(decimate).get(), depth - 1UZ, bufferSize);
+    }
+}
+
+template<typename T>
+gr::Graph decimatingTree(std::size_t bufferSize) { // src -> binary tree of 3 levels of decimate-by-2 blocks -> 8 sinks
+    gr::Graph graph;
+    decimatingTree<T>(graph, source<T>(graph), 3UZ, bufferSize);
+    return graph;
+}
+
+template<typename T, gr::Size_t tagInterval>
+gr::Graph tagHeavy(std::size_t bufferSize) { // src -> tag emitter -> 4 x copy -> sink, with tags forwarded by all blocks
+    using namespace boost::ut;
+    gr::Graph       graph;
+    auto&           emitter = graph.emplaceBlock<TagEmitter<T>>({{"tag_interval", tagInterval}});
+    gr::BlockModel* last    = graph.findBlock(emitter).get();
+    expect(eq(gr::ConnectionResult::SUCCESS, graph.connect(source<T>(graph), "out"s, emitter, "in"s, bufferSize)));
+    for (std::size_t i = 0UZ; i < 4UZ; i++) {
+        auto& copy = graph.emplaceBlock<gr::testing::Copy<T>>();
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect(*last, "out"s, copy, "in"s, bufferSize)));
+        last = graph.findBlock(copy).get();
+    }
+    sink<T>(graph, *last, bufferSize);
+    return graph;
+}
+} // namespace topology
+
+template<typename TScheduler>
+void exec_bm(const std::string& name, gr::Graph&& graph, std::shared_ptr<gr::thread_pool::BasicThreadPool> pool) {
+    using namespace boost::ut;
+    auto sched = std::make_shared<TScheduler>(std::move(graph), std::move(pool));
+    ::benchmark::benchmark<1LU>{name}.repeat<N_ITER>(N_SAMPLES) = [sched, name]() { //
+        expect(sched->runAndWait().has_value()) << fmt::format("scheduler failure for test-case: {}", name);
+    };
+}
+
+[[maybe_unused]] inline const boost::ut::suite graph_throughput_tests = [] {
+    using namespace boost::ut;
+    using namespace benchmark;
+    using thread_pool = gr::thread_pool::BasicThreadPool;
+    using gr::scheduler::ExecutionPolicy::multiThreaded;
+    using TGraphFactory = std::function<gr::Graph(std::size_t)>;
+
+    const std::array<std::pair<std::string_view, TGraphFactory>, 5UZ> topologies{{
+        {"linear chain (10 stages)", topology::linearChain<float>},
+        {"fan-out/fan-in (4 x 4 stages)", topology::fanOutFanIn<float>},
+        {"decimating tree (3 levels)", topology::decimatingTree<float>},
+        {"tag-heavy (1 tag/1024 samples)", topology::tagHeavy<float, 1024U>},
+        {"tag-heavy (1 tag/64 samples)", topology::tagHeavy<float, 64U>},
+    }};
+
+    auto pool = std::make_shared<thread_pool>("custom-pool", gr::thread_pool::CPU_BOUND, 2, 2);
+    for (const auto& [topologyName, createGraph] : topologies) {
+        for (const std::size_t bufferSize : {4096UZ, 65536UZ, 1UZ << 20}) {
+            const auto name = [&](std::string_view policy) { return fmt::format("{} - {} - buffer {:>4} kS", topologyName, policy, bufferSize / 1024UZ); };
+            exec_bm<gr::scheduler::Simple<>>(name("simple"), createGraph(bufferSize), pool);
+            exec_bm<gr::scheduler::BreadthFirst<>>(name("BFS"), createGraph(bufferSize), pool);
+            exec_bm<gr::scheduler::Simple<multiThreaded>>(name("simple (multi-threaded)"), createGraph(bufferSize), pool);
+            exec_bm<gr::scheduler::BreadthFirst<multiThreaded>>(name("BFS (multi-threaded)"), createGraph(bufferSize), pool);
+        }
+        ::benchmark::results::add_separator();
+    }
+};
+
+int main() { /* not needed by the UT framework */ }
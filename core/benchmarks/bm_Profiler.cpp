@@ -49,7 +49,10 @@ inline void run_with_profiler(TProfiler& p) {
     using namespace benchmark;
 
     Profiler prof;
-    "default profiler"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&p = prof] { run_with_profiler(p); };
+    "default profiler (binary)"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&p = prof] { run_with_profiler(p); };
+
+    Profiler json_prof({.output_format = OutputFormat::Json});
+    "default profiler (JSON)"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&p = json_prof] { run_with_profiler(p); };
 
     null::Profiler null_prof;
     "null profiler"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&p = null_prof] { run_with_profiler(p); };
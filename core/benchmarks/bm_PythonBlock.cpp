@@ -0,0 +1,112 @@
+#include <benchmark.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/Scheduler.hpp>
+
+#include <gnuradio-4.0/basic/PythonBlock.hpp>
+#include <gnuradio-4.0/testing/AllocationCounter.hpp>
+#include <gnuradio-4.0/testing/NullSources.hpp>
+
+inline constexpr std::size_t N_ITER    = 5;
+inline constexpr gr::Size_t  N_SAMPLES = 262'144;
+
+template<typename T>
+void testChunkSize(gr::Size_t chunkSize) {
+    using namespace boost::ut;
+    using namespace benchmark;
+    using namespace gr::basic;
+    using namespace std::string_literals;
+    namespace allocation = gr::testing::allocation;
+
+    const std::string pythonScript = R"(
+def process_bulk(ins, outs):
+    outs[0][:] = ins[0]
+)";
+
+    gr::Graph testGraph;
+    auto&     src   = testGraph.emplaceBlock<gr::testing::ConstantSource<T>>({{"n_samples_max", N_SAMPLES}});
+    auto&     block = testGraph.emplaceBlock<PythonBlock<T>>({{"n_inputs", 1U}, {"n_outputs", 1U}, {"min_chunk_size", chunkSize}, {"pythonScript", pythonScript}});
+    auto&     sink  = testGraph.emplaceBlock<gr::testing::NullSink<T>>();
+    block.inputs[0].max_samples = chunkSize; // fixed chunk size -> one 'process_bulk(..)' call per 'chunkSize' samples
+    expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect(src, "out"s, block, "inputs#0"s)));
+    expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect(block, "outputs#0"s, sink, "in"s)));
+
+    gr::scheduler::Simple sched{std::move(testGraph)};
+    ::benchmark::benchmark<N_ITER>(fmt::format("{} - chunk size {:6}", gr::meta::type_name<T>(), chunkSize), N_SAMPLES) = [&]() {
+        src.reset();
+        expect(sched.runAndWait().has_value());
+    };
+
+    // per 'process_bulk(..)' call: (re-)created NumPy views (each a Python object allocation) and C++ heap allocations
+    // N.B. the latter include those of the scheduler, allocations by CPython's own allocator are not counted
+    expect(allocation::hooksInstalled());
+    const std::size_t nCalls    = block._pyArguments.nUpdates();
+    const std::size_t nViews    = block._pyArguments.nCreatedViews();
+    const auto        heapStart = allocation::global();
+    src.reset();
+    expect(sched.runAndWait().has_value());
+    const std::size_t nRunCalls = block._pyArguments.nUpdates() - nCalls;
+    const auto        perCall   = [nRunCalls](std::size_t count) { return static_cast<long double>(count) / static_cast<long double>(std::max(nRunCalls, 1UZ)); };
+
+    auto& result = ::benchmark::results::add_result(fmt::format("{} - chunk size {:6} - per call", gr::meta::type_name<T>(), chunkSize));
+    result.try_emplace("#calls", static_cast<std::uint64_t>(nRunCalls), "", 0UZ);
+    result.try_emplace("views/call", perCall(block._pyArguments.nCreatedViews() - nViews), "", 2UZ);
+    result.try_emplace("allocs/call", perCall((allocation::global() - heapStart).nAllocations), "", 2UZ);
+}
+
+template<typename T>
+void testExecution(std::string_view execution, std::size_t nChains) {
+    using namespace boost::ut;
+    using namespace benchmark;
+    using namespace gr::basic;
+    using namespace std::string_literals;
+
+    // N.B. pure-Python sample loop (GIL-bound), works with both NumPy arrays ('shared') and memoryviews ('isolated')
+    const std::string pythonScript = R"(
+def process_bulk(ins, outs):
+    src = ins[0]
+    dst = outs[0]
+    for j in range(len(src)):
+        dst[j] = src[j] * 2
+)";
+    constexpr gr::Size_t nSamples = 100'000U; // per chain
+
+    gr::Graph                                    testGraph;
+    std::vector<gr::testing::ConstantSource<T>*> sources;
+    for (std::size_t i = 0UZ; i < nChains; i++) {
+        auto& src   = testGraph.emplaceBlock<gr::testing::ConstantSource<T>>({{"n_samples_max", nSamples}});
+        auto& block = testGraph.emplaceBlock<PythonBlock<T>>({{"n_inputs", 1U}, {"n_outputs", 1U}, {"execution", std::string(execution)}, {"pythonScript", pythonScript}});
+        auto& sink  = testGraph.emplaceBlock<gr::testing::NullSink<T>>();
+        expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect(src, "out"s, block, "inputs#0"s)));
+        expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect(block, "outputs#0"s, sink, "in"s)));
+        sources.push_back(std::addressof(src));
+    }
+
+    gr::scheduler::Simple<gr::scheduler::ExecutionPolicy::multiThreaded> sched{std::move(testGraph)};
+    ::benchmark::benchmark<N_ITER>(fmt::format("{} - {} x '{}' execution, multi-threaded (aggregate)", gr::meta::type_name<T>(), nChains, execution), nChains * nSamples) = [&]() {
+        for (auto* src : sources) {
+            src->reset();
+        }
+        expect(sched.runAndWait().has_value());
+    };
+}
+
+[[maybe_unused]] inline const boost::ut::suite python_block_tests = [] {
+    for (const gr::Size_t chunkSize : {1U, 4U, 16U, 64U, 256U, 1024U, 4096U}) {
+        testChunkSize<float>(chunkSize);
+    }
+    ::benchmark::results::add_separator();
+    for (const std::string_view execution : {gr::basic::PythonBlock<float>::kSharedExecution, gr::basic::PythonBlock<float>::kIsolatedExecution}) {
+        testExecution<float>(execution, 4UZ);
+    }
+    ::benchmark::results::add_separator();
+};
+
+int main() { /* not needed by the UT framework */ }
@@ -4,6 +4,7 @@
 #include <gnuradio-4.0/Graph.hpp>
 #include <gnuradio-4.0/Profiler.hpp>
 #include <gnuradio-4.0/Scheduler.hpp>
+#include <gnuradio-4.0/StaticGraph.hpp>
 
 #include <gnuradio-4.0/math/Math.hpp>
 #include <gnuradio-4.0/testing/NullSources.hpp>
@@ -91,6 +92,14 @@ void exec_bm(auto& scheduler, const std::string& test_case) {
     gr::scheduler::BreadthFirst sched4(test_graph_bifurcated<float>(N_NODES), pool);
     "bifurcated graph - BFS scheduler"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&sched4]() { exec_bm(sched4, "bifurcated-graph BFS-sched"); };
 
+    // 10-stage linear chain: per-block scheduling through 64k-sample buffers vs. fused cache-blocked execution
+    gr::scheduler::Simple sched5(test_graph_linear<float>(N_NODES), pool);
+    "10-stage chain - simple scheduler"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&sched5]() { exec_bm(sched5, "10-stage chain simple-sched"); };
+
+    gr::scheduler::Simple sched5_fused(test_graph_linear<float>(N_NODES), pool);
+    sched5_fused.fuse_linear_chains                                                        = true;
+    "10-stage chain - simple scheduler (fused chains)"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&sched5_fused]() { exec_bm(sched5_fused, "10-stage chain simple-sched (fused chains)"); };
+
     gr::scheduler::Simple<multiThreaded> sched1_mt(test_graph_linear<float>(2 * N_NODES), pool);
     "linear graph - simple scheduler (multi-threaded)"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&sched1_mt]() { exec_bm(sched1_mt, "linear-graph simple-sched (multi-threaded)"); };
 
@@ -107,4 +116,122 @@ void exec_bm(auto& scheduler, const std::string& test_case) {
     "bifurcated graph - BFS scheduler (multi-threaded) with profiling"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&sched4_mt_prof]() { exec_bm(sched4_mt_prof, "bifurcated-graph BFS-sched (multi-threaded) with profiling"); };
 };
 
+[[maybe_unused]] inline const boost::ut::suite static_graph_tests = [] {
+    using namespace boost::ut;
+    using namespace benchmark;
+    using namespace gr::testing;
+
+    // per-call overhead at small chunk sizes: type-erased BlockModel::work(..) calls vs. the devirtualised StaticGraph::work(..) pass
+    // N.B. both variants evaluate the same per-block limits in Block<..>::work(..), i.e. the difference is the devirtualisation only
+    constexpr gr::Size_t N_SAMPLES_SMALL_CHUNKS = gr::util::round_up(1'000'000, 1024);
+    for (const std::size_t chunkSize : {16UZ, 64UZ, 256UZ, 4096UZ}) { // N.B. 4096: the fixed per-call saving becomes negligible
+        const std::size_t nPasses = N_SAMPLES_SMALL_CHUNKS / chunkSize;
+
+        gr::Graph testGraph;
+        auto&     src   = testGraph.emplaceBlock<CountingSource<float>>();
+        auto&     copy1 = testGraph.emplaceBlock<Copy<float>>();
+        auto&     copy2 = testGraph.emplaceBlock<Copy<float>>();
+        auto&     copy3 = testGraph.emplaceBlock<Copy<float>>();
+        auto&     sink  = testGraph.emplaceBlock<CountingSink<float>>();
+        expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(src).to<"in">(copy1)));
+        expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(copy1).to<"in">(copy2)));
+        expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(copy2).to<"in">(copy3)));
+        expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(copy3).to<"in">(sink)));
+        expect(testGraph.reconnectAllEdges());
+        testGraph.forEachBlockMutable([](gr::BlockModel& block) { expect(block.changeState(gr::lifecycle::State::RUNNING).has_value()); });
+
+        ::benchmark::benchmark<1LU>{fmt::format("dynamic graph src->copy^3->sink - chunk size {:4} (virtual work calls)", chunkSize)}.repeat<N_ITER>(N_SAMPLES_SMALL_CHUNKS) = [&testGraph, &sink, nPasses, chunkSize]() {
+            const gr::Size_t countBefore = sink.count.value;
+            for (std::size_t pass = 0UZ; pass < nPasses; pass++) {
+                for (const auto& block : testGraph.blocks()) {
+                    std::ignore = block->work(chunkSize);
+                }
+            }
+            expect(eq(static_cast<std::size_t>(sink.count.value - countBefore), nPasses * chunkSize));
+        };
+
+        gr::StaticGraph<gr::StaticBlocks<CountingSource<float>, Copy<float>, Copy<float>, Copy<float>, CountingSink<float>>, //
+            gr::StaticEdges<gr::StaticEdge<0, "out", 1, "in">, gr::StaticEdge<1, "out", 2, "in">, gr::StaticEdge<2, "out", 3, "in">, gr::StaticEdge<3, "out", 4, "in">>>
+            staticGraph;
+        expect(staticGraph.start().has_value());
+
+        ::benchmark::benchmark<1LU>{fmt::format("static graph  src->copy^3->sink - chunk size {:4} (devirtualised)", chunkSize)}.repeat<N_ITER>(N_SAMPLES_SMALL_CHUNKS) = [&staticGraph, nPasses, chunkSize]() {
+            const gr::Size_t countBefore = staticGraph.block<4>().count.value;
+            for (std::size_t pass = 0UZ; pass < nPasses; pass++) {
+                std::ignore = staticGraph.work(chunkSize);
+            }
+            expect(eq(static_cast<std::size_t>(staticGraph.block<4>().count.value - countBefore), nPasses * chunkSize));
+        };
+    }
+};
+
+template<typename T>
+struct TrickleSource : public gr::Block<TrickleSource<T>> { // produces at most 64 samples per work(..) call, i.e. emulates a low-latency/low-rate producer
+    gr::PortOut<T, gr::RequiredSamples<1UZ, 64UZ>> out;
+    gr::Size_t                                     n_samples_max = 0U;
+    gr::Size_t                                     count         = 0U;
+
+    GR_MAKE_REFLECTABLE(TrickleSource, out, n_samples_max);
+
+    void reset() { count = 0U; }
+
+    [[nodiscard]] constexpr T processOne() noexcept {
+        count++;
+        if (n_samples_max > 0U && count >= n_samples_max) {
+            this->requestStop();
+        }
+        return T(1);
+    }
+};
+
+[[maybe_unused]] inline const boost::ut::suite batch_policy_tests = [] {
+    using namespace boost::ut;
+    using namespace benchmark;
+    using thread_pool = gr::thread_pool::BasicThreadPool;
+
+    // throughput vs. latency: a trickling source feeding a 10-stage chain -- larger 'min_batch_size' values amortise the
+    // per-call overhead of the downstream blocks at the cost of up to 'max_batch_latency' additional delay per stage
+    constexpr gr::Size_t N_SAMPLES_TRICKLE = gr::util::round_up(1'000'000, 1024);
+    auto                 pool              = std::make_shared<thread_pool>("custom-pool", gr::thread_pool::CPU_BOUND, 2, 2);
+    for (const gr::Size_t minBatchSize : {0U, 256U, 1024U, 4096U, 16384U}) {
+        gr::Graph testGraph;
+        auto&     src  = testGraph.emplaceBlock<TrickleSource<float>>({{"n_samples_max", N_SAMPLES_TRICKLE}});
+        auto&     sink = testGraph.emplaceBlock<gr::testing::NullSink<float>>();
+        create_cascade<float>(testGraph, src, sink, N_NODES);
+
+        auto sched                  = std::make_shared<gr::scheduler::Simple<>>(std::move(testGraph), pool);
+        sched->min_batch_size       = minBatchSize;
+        sched->max_batch_latency_us = 1000U;
+        sched->batch_alignment      = minBatchSize > 0U ? 64U : 0U;
+
+        ::benchmark::benchmark<1LU>{fmt::format("trickle src->10 stages->sink - min_batch_size {:5} (max latency 1 ms)", minBatchSize)}.repeat<N_ITER>(N_SAMPLES_TRICKLE) = [sched, minBatchSize]() { //
+            exec_bm(*sched, fmt::format("min_batch_size {}", minBatchSize));
+        };
+    }
+};
+
+[[maybe_unused]] inline const boost::ut::suite perf_counter_tests = [] {
+    using namespace boost::ut;
+    using namespace benchmark;
+    using thread_pool = gr::thread_pool::BasicThreadPool;
+
+    // overhead of the sampled hardware counters: 'perf_counter_interval' 0 (disabled) is the reference for the sampled
+    // variants, the trickling source keeps the per-call share (counter reads, trace event) at its worst case
+    constexpr gr::Size_t N_SAMPLES_TRICKLE = gr::util::round_up(1'000'000, 1024);
+    auto                 pool              = std::make_shared<thread_pool>("custom-pool", gr::thread_pool::CPU_BOUND, 2, 2);
+    for (const gr::Size_t interval : {0U, 1024U, 64U, 1U}) {
+        gr::Graph testGraph;
+        auto&     src  = testGraph.emplaceBlock<TrickleSource<float>>({{"n_samples_max", N_SAMPLES_TRICKLE}});
+        auto&     sink = testGraph.emplaceBlock<gr::testing::NullSink<float>>();
+        create_cascade<float>(testGraph, src, sink, N_NODES);
+
+        auto sched                   = std::make_shared<gr::scheduler::Simple<>>(std::move(testGraph), pool);
+        sched->perf_counter_interval = interval;
+
+        ::benchmark::benchmark<1LU>{fmt::format("trickle src->10 stages->sink - perf_counter_interval {:4}", interval)}.repeat<N_ITER>(N_SAMPLES_TRICKLE) = [sched, interval]() { //
+            exec_bm(*sched, fmt::format("perf_counter_interval {}", interval));
+        };
+    }
+};
+
 int main() { /* not needed by the UT framework */ }
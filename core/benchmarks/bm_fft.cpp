@@ -1,5 +1,6 @@
 #include <benchmark.hpp>
 
+#include <cassert>
 #include <numbers>
 
 #include <fmt/format.h>
@@ -7,6 +8,7 @@
 #include <gnuradio-4.0/DataSet.hpp>
 
 #include <gnuradio-4.0/algorithm/fourier/fft.hpp>
+#include <gnuradio-4.0/algorithm/fourier/fft_common.hpp>
 #include <gnuradio-4.0/algorithm/fourier/fftw.hpp>
 
 #include <gnuradio-4.0/fourier/fft.hpp>
@@ -67,22 +69,21 @@ struct FFTAlgoPrecision<T> {
 };
 
 template<typename T>
-void testFFT() {
+void testFFT(gr::Size_t N) {
     using namespace benchmark;
     using namespace boost::ut;
     using namespace boost::ut::reflection;
     using namespace gr;
     using namespace gr::algorithm;
 
-    constexpr gr::Size_t N{1024U}; // must be power of 2
-    constexpr double     sampleRate{256.};
-    constexpr double     frequency{100.};
-    constexpr double     amplitude{1.};
-    constexpr int        nRepetitions{100};
+    constexpr double sampleRate{256.};
+    constexpr double frequency{100.};
+    constexpr double amplitude{1.};
+    constexpr int    nRepetitions{100};
 
     using PrecisionType = FFTAlgoPrecision<T>::type;
 
-    static_assert(std::has_single_bit(N));
+    assert(std::has_single_bit(N)); // must be power of 2
 
     std::vector<T> signal = generateSinSample<T>(N, sampleRate, frequency, amplitude);
 
@@ -91,32 +92,126 @@ void testFFT() {
         std::ignore = fft1.settings().applyStagedParameters();
 
         std::vector<DataSet<PrecisionType>> resultingDataSets(1);
-        ::benchmark::benchmark<nRepetitions>(fmt::format("{} - fftw", type_name<T>())) = [&fft1, &signal, &resultingDataSets] { expect(gr::work::Status::OK == fft1.processBulk(signal, resultingDataSets)); };
+        ::benchmark::benchmark<nRepetitions>(fmt::format("{} - fftw N={}", type_name<T>(), N), N) = [&fft1, &signal, &resultingDataSets] { expect(gr::work::Status::OK == fft1.processBulk(signal, resultingDataSets)); };
     }
     {
         gr::blocks::fft::FFT<T, DataSet<PrecisionType>, FFT> fft1({{"fftSize", N}});
         std::ignore = fft1.settings().applyStagedParameters();
 
         std::vector<DataSet<PrecisionType>> resultingDataSets(1);
-        ::benchmark::benchmark<nRepetitions>(fmt::format("{} - fft", type_name<T>())) = [&fft1, &signal, &resultingDataSets] { expect(gr::work::Status::OK == fft1.processBulk(signal, resultingDataSets)); };
+        ::benchmark::benchmark<nRepetitions>(fmt::format("{} - fft N={}", type_name<T>(), N), N) = [&fft1, &signal, &resultingDataSets] { expect(gr::work::Status::OK == fft1.processBulk(signal, resultingDataSets)); };
     }
 
     if constexpr (gr::meta::complex_like<T>) {
-        ::benchmark::benchmark<nRepetitions>(fmt::format("{} - fftCT", type_name<T>())) = [&signal] {
-            auto signalCopy = signal;
-            computeFFTCooleyTukey<T>(signalCopy);
-        };
+        if (N <= 4096U) { // recursive reference implementation is too slow for larger sizes
+            ::benchmark::benchmark<nRepetitions>(fmt::format("{} - fftCT N={}", type_name<T>(), N), N) = [&signal] {
+                auto signalCopy = signal;
+                computeFFTCooleyTukey<T>(signalCopy);
+            };
+        }
     }
 
     ::benchmark::results::add_separator();
 }
 
+/// compares the windowing and spectrum post-processing of the FFT block: separate (scalar) passes vs. fused SIMD kernels
+template<typename T>
+void testSpectrumPostProcessing(gr::Size_t N) {
+    using namespace benchmark;
+    using namespace boost::ut;
+    using namespace boost::ut::reflection;
+    using namespace gr::algorithm;
+    using Complex = std::complex<T>;
+
+    constexpr int nRepetitions{100};
+
+    const std::vector<Complex> signal         = generateSinSample<Complex>(N, 256., 100., 1.);
+    const std::vector<T>       windowFunction = window::create<T>(window::Type::Hann, N);
+    std::vector<Complex>       windowed(N);
+    std::vector<T>             values(5UZ * N); // DataSet-like layout: [freq | re | im | mag | phase]
+    std::vector<T>             ranges(10UZ);
+    const auto                 slice = [&values, N](std::size_t i) { return std::span(values).subspan(i * N, N); };
+
+    ::benchmark::benchmark<nRepetitions>(fmt::format("{} - separate passes N={}", type_name<T>(), N), N) = [&] {
+        for (std::size_t i = 0UZ; i < N; i++) {
+            windowed[i].real(signal[i].real() * windowFunction[i]);
+            windowed[i].imag(signal[i].imag() * windowFunction[i]);
+        }
+        const auto magnitude = fft::computeMagnitudeSpectrum(windowed, fft::ConfigMagnitude{.outputInDb = true});
+        const auto phase     = fft::computePhaseSpectrum(windowed, fft::ConfigPhase{.outputInDeg = true, .unwrapPhase = true});
+        std::ranges::transform(windowed, slice(1UZ).begin(), [](const auto& c) { return c.real(); });
+        std::ranges::transform(windowed, slice(2UZ).begin(), [](const auto& c) { return c.imag(); });
+        std::ranges::copy(magnitude, slice(3UZ).begin());
+        std::ranges::copy(phase, slice(4UZ).begin());
+        for (std::size_t i = 1UZ; i < 5UZ; i++) {
+            const auto [min, max] = std::ranges::minmax_element(slice(i));
+            ranges[2UZ * i]       = *min;
+            ranges[2UZ * i + 1UZ] = *max;
+        }
+    };
+
+    ::benchmark::benchmark<nRepetitions>(fmt::format("{} - fused kernels N={}", type_name<T>(), N), N) = [&] {
+        fft::applyWindow(std::span<const Complex>(signal), std::span<const T>(windowFunction), std::span(windowed));
+        const auto range = fft::computeSpectrum(std::span<const Complex>(windowed), slice(1UZ), slice(2UZ), slice(3UZ), slice(4UZ), fft::ConfigSpectrum{.outputInDb = true, .outputInDeg = true, .unwrapPhase = true});
+        ranges           = {T(0), T(0), range.real.min, range.real.max, range.imag.min, range.imag.max, range.magnitude.min, range.magnitude.max, range.phase.min, range.phase.max};
+    };
+
+    ::benchmark::results::add_separator();
+}
+
+/// start-up time of many FFTW-based FFT blocks (construction + first transform), with and without the process-wide plan cache
+template<typename T>
+void testFFTwStartup(gr::Size_t N, unsigned int flags) {
+    using namespace benchmark;
+    using namespace boost::ut;
+    using namespace boost::ut::reflection;
+    using namespace gr;
+    using namespace gr::algorithm;
+
+    constexpr std::size_t nBlocks{200UZ};
+    constexpr int         nRepetitions{5};
+    using PrecisionType = FFTAlgoPrecision<T>::type;
+    using FFTBlock      = gr::blocks::fft::FFT<T, DataSet<PrecisionType>, FFTw>;
+
+    const std::vector<T> signal      = generateSinSample<T>(N, 256., 100., 1.);
+    const std::string    flagsName   = flags == FFTW_MEASURE ? "FFTW_MEASURE" : "FFTW_ESTIMATE";
+    auto                 startBlocks = [&signal, N, flags](bool usePlanCache) {
+        FFTwPlanCache::instance().clear(); // cold start
+        std::vector<std::unique_ptr<FFTBlock>> blocks;
+        blocks.reserve(nBlocks);
+        std::vector<DataSet<PrecisionType>> resultingDataSets(1);
+        for (std::size_t i = 0UZ; i < nBlocks; i++) {
+            auto& block                  = blocks.emplace_back(std::make_unique<FFTBlock>(property_map{{"fftSize", N}}));
+            block->_fftImpl.usePlanCache = usePlanCache;
+            block->_fftImpl.flags        = flags;
+            std::ignore                  = block->settings().applyStagedParameters();
+            expect(gr::work::Status::OK == block->processBulk(signal, resultingDataSets));
+        }
+    };
+
+    ::benchmark::benchmark<nRepetitions>(fmt::format("{} - {} FFTw blocks, no plan cache, {} N={}", type_name<T>(), nBlocks, flagsName, N), nBlocks) = [&startBlocks] { startBlocks(false); };
+    ::benchmark::benchmark<nRepetitions>(fmt::format("{} - {} FFTw blocks, plan cache, {} N={}", type_name<T>(), nBlocks, flagsName, N), nBlocks) = [&startBlocks] { startBlocks(true); };
+
+    ::benchmark::results::add_separator();
+}
+
 inline const boost::ut::suite _fft_bm_tests = [] {
     std::tuple<std::complex<float>, std::complex<double>> complexTypesToTest{};
     std::tuple<float, double>                             realTypesToTest{};
 
-    std::apply([]<class... TArgs>(TArgs... /*args*/) { (testFFT<TArgs>(), ...); }, complexTypesToTest);
-    std::apply([]<class... TArgs>(TArgs... /*args*/) { (testFFT<TArgs>(), ...); }, realTypesToTest);
+    for (gr::Size_t N : {1024U, 4096U, 16384U, 65536U}) {
+        std::apply([N]<class... TArgs>(TArgs... /*args*/) { (testFFT<TArgs>(N), ...); }, complexTypesToTest);
+        std::apply([N]<class... TArgs>(TArgs... /*args*/) { (testFFT<TArgs>(N), ...); }, realTypesToTest);
+    }
+
+    for (gr::Size_t N : {1024U, 4096U, 16384U, 65536U}) {
+        std::apply([N]<class... TArgs>(TArgs... /*args*/) { (testSpectrumPostProcessing<TArgs>(N), ...); }, realTypesToTest);
+    }
+
+    for (unsigned int flags : {FFTW_ESTIMATE, FFTW_MEASURE}) {
+        testFFTwStartup<std::complex<float>>(4096U, flags);
+        testFFTwStartup<float>(4096U, flags);
+    }
 };
 
 int main() { /* not needed by the UT framework */ }
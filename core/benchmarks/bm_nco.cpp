@@ -0,0 +1,96 @@
+#include <benchmark.hpp>
+
+#include <cmath>
+#include <complex>
+#include <numbers>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <gnuradio-4.0/algorithm/NCO.hpp>
+#include <gnuradio-4.0/basic/FrequencyShift.hpp>
+#include <gnuradio-4.0/basic/SignalGenerator.hpp>
+
+/// max. absolute error of e^{j·φ[n]} w.r.t. double-precision std::sin/std::cos (incl. phase/frequency quantisation)
+template<typename T>
+double ncoMaxError(gr::algorithm::NcoMode mode, double frequency, std::size_t N) {
+    gr::algorithm::NCO<T>        nco(frequency, 0., mode);
+    std::vector<std::complex<T>> out(N);
+    nco.generate(out);
+    double maxError = 0.;
+    for (std::size_t i = 0UZ; i < N; i++) {
+        const double phi = 2. * std::numbers::pi * frequency * static_cast<double>(i);
+        maxError         = std::max({maxError, std::abs(static_cast<double>(out[i].real()) - std::cos(phi)), std::abs(static_cast<double>(out[i].imag()) - std::sin(phi))});
+    }
+    return maxError;
+}
+
+template<typename T>
+void testNCO(std::size_t N) {
+    using namespace benchmark;
+    using namespace boost::ut;
+    using namespace boost::ut::reflection;
+    using namespace gr::algorithm;
+
+    constexpr int    nRepetitions{100};
+    constexpr double frequency = 0.0123; // normalised frequency [cycles/sample]
+
+    std::vector<T>               real(N);
+    std::vector<std::complex<T>> signal(N, std::complex<T>(1, 0));
+    std::vector<std::complex<T>> mixed(N);
+
+    // reference: per-sample std::sin as used by `SignalGenerator` prior to the NCO
+    double time = 0.;
+    ::benchmark::benchmark<nRepetitions>(fmt::format("{} - std::sin(2π·f·t) reference", type_name<T>()), N) = [&real, &time] {
+        for (auto& value : real) {
+            value = static_cast<T>(std::sin(2. * std::numbers::pi * frequency * time));
+            time += 1.;
+        }
+    };
+
+    for (const NcoMode mode : {NcoMode::Exact, NcoMode::Table, NcoMode::Polynomial}) {
+        const std::string modeName = fmt::format("{:10} (max error {:.1e})", magic_enum::enum_name(mode), ncoMaxError<T>(mode, frequency, N));
+        NCO<T>            nco(frequency, 0., mode);
+        ::benchmark::benchmark<nRepetitions>(fmt::format("{} - NCO::sin   {}", type_name<T>(), modeName), N) = [&nco, &real] { nco.sin(real); };
+        ::benchmark::benchmark<nRepetitions>(fmt::format("{} - NCO::mix   {}", type_name<T>(), modeName), N) = [&nco, &signal, &mixed] { nco.mix(signal, mixed); };
+    }
+
+    ::benchmark::results::add_separator();
+}
+
+template<typename T>
+void testBlocks(std::size_t N) {
+    using namespace benchmark;
+    using namespace boost::ut;
+    using namespace boost::ut::reflection;
+    using namespace gr;
+
+    constexpr int nRepetitions{100};
+
+    std::vector<T>               dummyInput(N);
+    std::vector<T>               real(N);
+    std::vector<std::complex<T>> signal(N, std::complex<T>(1, 0));
+    std::vector<std::complex<T>> mixed(N);
+
+    for (const std::string mode : {"Exact", "Table", "Polynomial"}) {
+        basic::SignalGenerator<T> signalGen({{"signal_type", "Sin"}, {"sample_rate", 1000.f}, {"frequency", T(12.3)}, {"nco_mode", mode}});
+        signalGen.init(signalGen.progress, signalGen.ioThreadPool);
+        ::benchmark::benchmark<nRepetitions>(fmt::format("{} - SignalGenerator Sin {}", type_name<T>(), mode), N) = [&signalGen, &dummyInput, &real] { expect(gr::work::Status::OK == signalGen.processBulk(dummyInput, real)); };
+
+        basic::FrequencyShift<T> shifter({{"sample_rate", 1000.f}, {"frequency_shift", 12.3}, {"nco_mode", mode}});
+        shifter.init(shifter.progress, shifter.ioThreadPool);
+        ::benchmark::benchmark<nRepetitions>(fmt::format("{} - FrequencyShift {}", type_name<T>(), mode), N) = [&shifter, &signal, &mixed] { expect(gr::work::Status::OK == shifter.processBulk(signal, mixed)); };
+    }
+
+    ::benchmark::results::add_separator();
+}
+
+inline const boost::ut::suite _nco_bm_tests = [] {
+    constexpr std::size_t N = 65536UZ;
+    testNCO<float>(N);
+    testNCO<double>(N);
+    testBlocks<float>(N);
+    testBlocks<double>(N);
+};
+
+int main() { /* not needed by the UT framework */ }
@@ -1,6 +1,10 @@
 #ifndef GNURADIO_BLOCK_HPP
 #define GNURADIO_BLOCK_HPP
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <ctime>
 #include <limits>
 #include <map>
 #include <source_location>
@@ -13,8 +17,10 @@
 #include <gnuradio-4.0/meta/utils.hpp>
 
 #include <gnuradio-4.0/BlockTraits.hpp>
+#include <gnuradio-4.0/LatencyProbe.hpp>
 #include <gnuradio-4.0/Port.hpp>
 #include <gnuradio-4.0/Sequence.hpp>
+#include <gnuradio-4.0/SingleWriterCounter.hpp>
 #include <gnuradio-4.0/Tag.hpp>
 #include <gnuradio-4.0/thread/thread_pool.hpp>
 
@@ -203,16 +209,125 @@ inline static const char* kResetDefaults    = "ResetDefaults";    ///< retrieve
 inline static const char* kActiveContext    = "ActiveContext";    ///< retrieve and set active context
 inline static const char* kSettingsCtx      = "SettingsCtx";      ///< retrieve/creates/remove a new stored context
 inline static const char* kSettingsContexts = "SettingsContexts"; ///< retrieve/creates/remove a new stored context
+inline static const char* kStats            = "Stats";            ///< retrieve (Get) or retrieve and reset (Set) the block's execution statistics, @see block::Stats
 
 } // namespace block::property
 
+#ifndef GR_ENABLE_BLOCK_STATS
+#define GR_ENABLE_BLOCK_STATS 0 // N.B. controlled by the CMake option 'ENABLE_BLOCK_STATS'
+#endif
+
 namespace block {
 enum class Category {
     NormalBlock,           ///< Block that does not contain children blocks
     TransparentBlockGroup, ///< Block with children blocks which do not have a dedicated scheduler
     ScheduledBlockGroup    ///< Block with children that have a dedicated scheduler
 };
+
+inline constexpr bool kStatsEnabled = GR_ENABLE_BLOCK_STATS != 0;
+
+namespace detail {
+[[nodiscard]] inline std::uint64_t threadCpuTimeNs() noexcept {
+#if defined(CLOCK_THREAD_CPUTIME_ID) && !defined(__EMSCRIPTEN__)
+    timespec cpuTime{};
+    if (::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpuTime) == 0) {
+        return static_cast<std::uint64_t>(cpuTime.tv_sec) * 1'000'000'000ULL + static_cast<std::uint64_t>(cpuTime.tv_nsec);
+    }
+#endif
+    return 0ULL; // not supported on this platform
 }
+} // namespace detail
+
+/**
+ * @brief per-block execution statistics recorded by 'Block::work(..)' if compiled with 'GR_ENABLE_BLOCK_STATS=1'
+ * (otherwise 'Block' holds an empty 'NoStats' placeholder and the bookkeeping is compiled out).
+ *
+ * Counters are written only by the thread executing the block and use relaxed atomics solely to permit concurrent reads,
+ * e.g. via the 'kStats' property or the graph's 'kGraphStats' message endpoint.
+ */
+struct alignas(hardware_destructive_interference_size) Stats {
+    using Counter = SingleWriterCounter;
+    static constexpr std::array<work::Status, 5UZ> kStatus{work::Status::OK, work::Status::DONE, work::Status::INSUFFICIENT_INPUT_ITEMS, work::Status::INSUFFICIENT_OUTPUT_ITEMS, work::Status::ERROR};
+
+    Counter                             nCalls{0U};
+    Counter                             nSamplesIn{0U};
+    Counter                             nSamplesOut{0U};
+    Counter                             wallTimeNs{0U};
+    Counter                             cpuTimeNs{0U}; // thread CPU time, 0 if not supported by the platform
+    Counter                             nSettingsApplied{0U};
+    std::array<Counter, kStatus.size()> nCallsByStatus{};
+    std::array<Counter, kStatus.size()> wallTimeByStatusNs{};
+    latency::Histogram                  probeLatency; // age of received 'gr::tag::LATENCY_PROBE' tags
+
+    [[nodiscard]] static constexpr std::size_t statusIndex(work::Status status) noexcept {
+        using enum work::Status;
+        switch (status) {
+        case OK: return 0UZ;
+        case DONE: return 1UZ;
+        case INSUFFICIENT_INPUT_ITEMS: return 2UZ;
+        case INSUFFICIENT_OUTPUT_ITEMS: return 3UZ;
+        default: return 4UZ;
+        }
+    }
+
+    void recordCall(work::Status status, std::uint64_t wallNs, std::uint64_t cpuNs) noexcept {
+        const std::size_t index = statusIndex(status);
+        singleWriterAdd(nCalls, 1U);
+        singleWriterAdd(wallTimeNs, wallNs);
+        singleWriterAdd(cpuTimeNs, cpuNs);
+        singleWriterAdd(nCallsByStatus[index], 1U);
+        singleWriterAdd(wallTimeByStatusNs[index], wallNs);
+    }
+
+    void recordSamples(std::size_t nIn, std::size_t nOut) noexcept {
+        singleWriterAdd(nSamplesIn, nIn);
+        singleWriterAdd(nSamplesOut, nOut);
+    }
+
+    void recordSettingsApplied() noexcept { singleWriterAdd(nSettingsApplied, 1U); }
+
+    void recordProbe(const property_map& tagMap) noexcept {
+        if (const auto ageNs = latency::probeAgeNs(tagMap); ageNs.has_value()) {
+            probeLatency.record(*ageNs);
+        }
+    }
+
+    void reset() noexcept {
+        for (Counter* counter : {&nCalls, &nSamplesIn, &nSamplesOut, &wallTimeNs, &cpuTimeNs, &nSettingsApplied}) {
+            counter->store(0U, std::memory_order_relaxed);
+        }
+        for (std::size_t i = 0UZ; i < kStatus.size(); i++) {
+            nCallsByStatus[i].store(0U, std::memory_order_relaxed);
+            wallTimeByStatusNs[i].store(0U, std::memory_order_relaxed);
+        }
+        probeLatency.reset();
+    }
+
+    [[nodiscard]] property_map toPropertyMap() const {
+        property_map byStatus;
+        for (std::size_t i = 0UZ; i < kStatus.size(); i++) {
+            byStatus[std::string(magic_enum::enum_name(kStatus[i]))] = property_map{{"calls", nCallsByStatus[i].load(std::memory_order_relaxed)}, {"wall_time_ns", wallTimeByStatusNs[i].load(std::memory_order_relaxed)}};
+        }
+        return {{"calls", nCalls.load(std::memory_order_relaxed)},                  //
+            {"samples_in", nSamplesIn.load(std::memory_order_relaxed)},             //
+            {"samples_out", nSamplesOut.load(std::memory_order_relaxed)},           //
+            {"wall_time_ns", wallTimeNs.load(std::memory_order_relaxed)},           //
+            {"cpu_time_ns", cpuTimeNs.load(std::memory_order_relaxed)},             //
+            {"settings_applied", nSettingsApplied.load(std::memory_order_relaxed)}, //
+            {"status", std::move(byStatus)},                                        //
+            {"probe_latency", probeLatency.toPropertyMap()}};
+    }
+};
+
+struct NoStats { // statistics disabled at compile-time: no storage, no-op bookkeeping
+    constexpr void                    recordCall(work::Status, std::uint64_t, std::uint64_t) const noexcept {}
+    constexpr void                    recordSamples(std::size_t, std::size_t) const noexcept {}
+    constexpr void                    recordSettingsApplied() const noexcept {}
+    constexpr void                    recordProbe(const property_map&) const noexcept {}
+    constexpr void                    reset() const noexcept {}
+    [[nodiscard]] static property_map toPropertyMap() { return {}; }
+};
+} // namespace block
 
 /**
  * @brief The 'Block<Derived>' is a base class for blocks that perform specific signal processing operations. It stores
@@ -297,6 +412,7 @@ enum class Category {
  * - `kActiveContext`: Returns current active context and allows to set a new one
  * - `kSettingsCtx`: Manages Settings Contexts Add/Remove/Get
  * - `kSettingsContexts`: Returns all Contextxs
+ * - `kStats`: Returns (Get) or returns and resets (Set) the execution statistics (requires `GR_ENABLE_BLOCK_STATS=1`)
  *
  * These properties can be interacted with through messages, supporting operations like setting values, querying states, and subscribing to updates.
  * This model provides a flexible interface for blocks to adapt their processing based on runtime conditions and external inputs.
@@ -440,6 +556,7 @@ public:
         {block::property::kActiveContext, &Block::propertyCallbackActiveContext},       //
         {block::property::kSettingsCtx, &Block::propertyCallbackSettingsCtx},           //
         {block::property::kSettingsContexts, &Block::propertyCallbackSettingsContexts}, //
+        {block::property::kStats, &Block::propertyCallbackStats},                       //
     };
     std::map<std::string, std::set<std::string>> propertySubscriptions;
 
@@ -452,6 +569,8 @@ protected:
     // intermediate non-real-time<->real-time setting states
     CtxSettings<Derived> _settings;
 
+    [[no_unique_address]] std::conditional_t<block::kStatsEnabled, block::Stats, block::NoStats> _stats{};
+
     [[nodiscard]] constexpr auto& self() noexcept { return *static_cast<Derived*>(this); }
 
     [[nodiscard]] constexpr const auto& self() const noexcept { return *static_cast<const Derived*>(this); }
@@ -550,6 +669,8 @@ public:
 
     [[nodiscard]] constexpr bool isBlocking() const noexcept { return blockingIO; }
 
+    [[nodiscard]] constexpr const auto& stats() const noexcept { return _stats; } // block::Stats or -- if disabled at compile-time -- block::NoStats
+
     [[nodiscard]] constexpr bool inputTagsPresent() const noexcept { return !_mergedInputTag.map.empty(); };
 
     [[nodiscard]] constexpr const Tag& mergedInputTag() const noexcept { return _mergedInputTag; }
@@ -727,6 +848,7 @@ public:
 
         if (inputTagsPresent()) {
             settings().autoUpdate(_mergedInputTag); // apply tags as new settings if matching
+            _stats.recordProbe(_mergedInputTag.map);
         }
     }
 
@@ -737,6 +859,7 @@ public:
         invokeUserProvidedFunction("applyChangedSettings()", [this] noexcept(false) {
             auto applyResult = settings().applyStagedParameters();
             checkBlockParameterConsistency();
+            _stats.recordSettingsApplied();
 
             if (!applyResult.forwardParameters.empty()) {
                 for (auto& [key, value] : applyResult.forwardParameters) {
@@ -1165,6 +1288,33 @@ protected:
         throw gr::exception(fmt::format("block {} property {} does not implement command {}, msg: {}", unique_name, propertyName, message.cmd, message));
     }
 
+    std::optional<Message> propertyCallbackStats(std::string_view propertyName, Message message) {
+        using enum gr::message::Command;
+        assert(propertyName == block::property::kStats);
+
+        if constexpr (!block::kStatsEnabled) {
+            throw gr::exception(fmt::format("block {} property {}: statistics are not enabled (compile with GR_ENABLE_BLOCK_STATS=1), msg: {}", unique_name, propertyName, message));
+        } else {
+            if (message.cmd == Get || message.cmd == Set) { // N.B. 'Set' returns and resets the accumulated statistics
+                message.data = _stats.toPropertyMap();
+                if (message.cmd == Set) {
+                    _stats.reset();
+                }
+                return message;
+            } else if (message.cmd == Subscribe) {
+                if (!message.clientRequestID.empty()) {
+                    propertySubscriptions[std::string(propertyName)].insert(message.clientRequestID);
+                }
+                return std::nullopt;
+            } else if (message.cmd == Unsubscribe) {
+                propertySubscriptions[std::string(propertyName)].erase(message.clientRequestID);
+                return std::nullopt;
+            }
+        }
+
+        throw gr::exception(fmt::format("block {} property {} does not implement command {}, msg: {}", unique_name, propertyName, message.cmd, message));
+    }
+
     std::optional<Message> propertyCallbackSettingsContexts(std::string_view propertyName, Message message) {
         using enum gr::message::Command;
         assert(propertyName == block::property::kSettingsContexts);
@@ -1541,6 +1691,19 @@ protected:
      * @return struct { std::size_t produced_work, work_return_t}
      */
     work::Result workInternal(std::size_t requestedWork) {
+        if constexpr (block::kStatsEnabled) {
+            const auto          wallStart = std::chrono::steady_clock::now();
+            const std::uint64_t cpuStart  = block::detail::threadCpuTimeNs();
+            const work::Result  result    = workInternalImpl(requestedWork);
+            const auto          wallTime  = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - wallStart);
+            _stats.recordCall(result.status, static_cast<std::uint64_t>(wallTime.count()), block::detail::threadCpuTimeNs() - cpuStart);
+            return result;
+        } else {
+            return workInternalImpl(requestedWork);
+        }
+    }
+
+    work::Result workInternalImpl(std::size_t requestedWork) {
         using enum gr::work::Status;
         using TInputTypes  = traits::block::stream_input_port_types<Derived>;
         using TOutputTypes = traits::block::stream_output_port_types<Derived>;
@@ -1738,8 +1901,9 @@ protected:
                 progress->notify_all();
             }
         }
+        _stats.recordSamples(processedIn, processedOut);
         return {requestedWork, performedWork, userReturnStatus};
-    } // end: work::Result workInternal(std::size_t requestedWork) { ... }
+    } // end: work::Result workInternalImpl(std::size_t requestedWork) { ... }
 
 public:
     work::Status invokeWork()
@@ -364,6 +364,11 @@ public:
 
     virtual UICategory uiCategory() const { return UICategory::None; }
 
+    /**
+     * @brief execution statistics of the block (@see block::Stats), empty if disabled at compile-time (GR_ENABLE_BLOCK_STATS)
+     */
+    [[nodiscard]] virtual property_map stats() const { return {}; }
+
     [[nodiscard]] virtual void* raw() = 0;
 };
 
@@ -463,6 +468,14 @@ public:
 
     UICategory uiCategory() const override { return T::DrawableControl::kCategory; }
 
+    [[nodiscard]] property_map stats() const override {
+        if constexpr (requires { blockRef().stats().toPropertyMap(); }) {
+            return blockRef().stats().toPropertyMap();
+        } else {
+            return {};
+        }
+    }
+
     void processScheduledMessages() override { return blockRef().processScheduledMessages(); }
 
     // For blocks that contain nested blocks (Graphs, Schedulers)
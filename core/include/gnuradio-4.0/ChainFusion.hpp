@@ -0,0 +1,183 @@
+#ifndef GNURADIO_CHAIN_FUSION_HPP
+#define GNURADIO_CHAIN_FUSION_HPP
+
+#include <gnuradio-4.0/BlockModel.hpp>
+#include <gnuradio-4.0/Graph.hpp>
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace gr::graph {
+
+namespace detail {
+[[nodiscard]] inline bool hasSingleStreamPort(BlockModel& block, bool input) {
+    auto& ports = input ? block.dynamicInputPorts() : block.dynamicOutputPorts();
+    return ports.size() == 1UZ && std::holds_alternative<gr::DynamicPort>(ports[0]);
+}
+
+[[nodiscard]] inline bool isFusable(BlockModel& block) { return block.blockCategory() == block::Category::NormalBlock && !block.isBlocking(); }
+} // namespace detail
+
+/**
+ * @brief graph-optimisation pass: returns the maximal linear chains of (type-erased) blocks that are connected by exclusive
+ * 1:1 edges, i.e. every block but the last has exactly one output port with exactly one edge, and every block but the
+ * first has exactly one input port with exactly one edge. The chain head may be a source and the chain tail a sink.
+ * Blocking (I/O) blocks and nested block groups are never part of a chain.
+ *
+ * Chains are returned in the order of their head block in the graph, members in data-flow order.
+ */
+[[nodiscard]] inline std::vector<std::vector<BlockModel*>> findLinearChains(Graph& graph, std::size_t minLength = 2UZ) {
+    std::unordered_map<const BlockModel*, std::size_t> nOutgoingEdges;
+    std::unordered_map<const BlockModel*, std::size_t> nIncomingEdges;
+    for (const Edge& edge : graph.edges()) {
+        nOutgoingEdges[edge._sourceBlock]++;
+        nIncomingEdges[edge._destinationBlock]++;
+    }
+
+    std::unordered_map<BlockModel*, BlockModel*> next;
+    std::unordered_set<BlockModel*>              hasPrevious;
+    for (const Edge& edge : graph.edges()) {
+        BlockModel* source      = edge._sourceBlock;
+        BlockModel* destination = edge._destinationBlock;
+        if (source == destination || nOutgoingEdges[source] != 1UZ || nIncomingEdges[destination] != 1UZ) {
+            continue;
+        }
+        if (!detail::isFusable(*source) || !detail::isFusable(*destination) || !detail::hasSingleStreamPort(*source, false) || !detail::hasSingleStreamPort(*destination, true)) {
+            continue;
+        }
+        next[source] = destination;
+        hasPrevious.insert(destination);
+    }
+
+    std::vector<std::vector<BlockModel*>> chains;
+    for (const auto& blockPtr : graph.blocks()) {
+        BlockModel* head = blockPtr.get();
+        if (!next.contains(head) || hasPrevious.contains(head)) { // N.B. pure cycles have no head and are never fused
+            continue;
+        }
+        std::vector<BlockModel*> chain{head};
+        for (auto it = next.find(head); it != next.end(); it = next.find(it->second)) {
+            chain.push_back(it->second);
+        }
+        if (chain.size() >= minLength) {
+            chains.push_back(std::move(chain));
+        }
+    }
+    return chains;
+}
+
+/**
+ * @brief executes a linear chain of blocks (see 'findLinearChains(..)') as a single scheduling unit.
+ *
+ * Rather than letting each block drain its (64k-sample) input buffer before the next one runs, 'work(..)' advances the
+ * whole chain in strips of 'stripSize' samples: each block processes at most one strip before handing over to its successor.
+ * Together with 'resizeInternalBuffers()', which shrinks the chain-internal edges to a few strips, the intermediate data
+ * stays L1/L2-resident instead of streaming every stage through main memory.
+ *
+ * N.B. the member blocks remain owned, initialised and lifecycle-controlled by their graph -- this is a non-owning view
+ * that is only meant to replace the members in the scheduler's job lists. The chain exposes no ports of its own: the
+ * scheduler's batch policy gates it on the input ports of its head block, and 'requestedWork' limits the samples processed
+ * by the head (i.e. the chain's input).
+ */
+class FusedBlockChain : public BlockModel {
+    std::vector<BlockModel*> _chain;
+    std::size_t              _stripSize;
+    std::size_t              _maxStripsPerWork;
+    std::string              _name;
+    std::string              _uniqueName;
+    property_map             _metaInformation;
+
+public:
+    explicit FusedBlockChain(std::vector<BlockModel*> chain, std::size_t stripSize = 1024UZ, std::size_t maxStripsPerWork = 64UZ) //
+        : _chain(std::move(chain)), _stripSize(std::max(stripSize, 1UZ)), _maxStripsPerWork(std::max(maxStripsPerWork, 1UZ)) {
+        if (_chain.empty()) {
+            throw gr::exception("FusedBlockChain requires at least one block");
+        }
+        _name               = fmt::format("fused[{}..{}]", _chain.front()->name(), _chain.back()->name());
+        _uniqueName         = fmt::format("fused[{}..{}]", _chain.front()->uniqueName(), _chain.back()->uniqueName());
+        msgIn               = _chain.front()->msgIn;
+        msgOut              = _chain.front()->msgOut;
+        _dynamicPortsLoader = [this] { _dynamicPortsLoaded = true; }; // ports remain those of the members
+    }
+
+    [[nodiscard]] std::span<BlockModel* const> members() const noexcept { return _chain; }
+    [[nodiscard]] std::size_t                  stripSize() const noexcept { return _stripSize; }
+
+    /**
+     * @brief re-connects the chain-internal edges through buffers sized to a few strips (or the minimum required by the
+     * downstream port). Needs to be called after the graph connected its edges.
+     */
+    [[nodiscard]] bool resizeInternalBuffers() {
+        bool success = true;
+        for (std::size_t i = 0UZ; i + 1UZ < _chain.size(); i++) {
+            gr::DynamicPort&  output = _chain[i]->dynamicOutputPort(0UZ);
+            gr::DynamicPort&  input  = _chain[i + 1UZ]->dynamicInputPort(0UZ);
+            const std::size_t nItems = std::max(2UZ * _stripSize, input.min_samples);
+            success                  = success && output.resizeBuffer(nItems) == ConnectionResult::SUCCESS && output.connect(input) == ConnectionResult::SUCCESS;
+        }
+        return success;
+    }
+
+    void init(std::shared_ptr<gr::Sequence> /*progress*/, std::shared_ptr<gr::thread_pool::BasicThreadPool> /*ioThreadPool*/) override {}
+
+    [[nodiscard]] work::Result work(std::size_t requestedWork = std::numeric_limits<std::size_t>::max()) override {
+        std::size_t performedWork = 0UZ;
+        std::size_t headWork      = 0UZ;
+        bool        allDone       = false;
+        for (std::size_t strip = 0UZ; strip < _maxStripsPerWork && headWork < requestedWork; strip++) {
+            std::size_t performedInStrip = 0UZ;
+            allDone                      = true;
+            for (BlockModel* block : _chain) {
+                const bool isHead                 = block == _chain.front();
+                const auto [_, performed, status] = block->work(isHead ? std::min(_stripSize, requestedWork - headWork) : _stripSize);
+                performedInStrip += performed;
+                headWork += isHead ? performed : 0UZ;
+                if (status == work::Status::ERROR) {
+                    return {requestedWork, performedWork + performedInStrip, work::Status::ERROR};
+                }
+                allDone = allDone && status == work::Status::DONE;
+            }
+            performedWork += performedInStrip;
+            if (performedInStrip == 0UZ) {
+                break;
+            }
+        }
+        return {requestedWork, performedWork, allDone ? work::Status::DONE : work::Status::OK};
+    }
+
+    void processScheduledMessages() override {
+        for (BlockModel* block : _chain) {
+            block->processScheduledMessages();
+        }
+    }
+
+    [[nodiscard]] std::expected<void, Error> changeState(lifecycle::State newState) noexcept override {
+        std::expected<void, Error> result{};
+        for (BlockModel* block : _chain) {
+            if (auto e = block->changeState(newState); !e && result) {
+                result = std::move(e);
+            }
+        }
+        return result;
+    }
+
+    [[nodiscard]] constexpr bool      isBlocking() const noexcept override { return false; }
+    [[nodiscard]] lifecycle::State    state() const noexcept override { return _chain.front()->state(); }
+    [[nodiscard]] std::string_view    name() const override { return _name; }
+    void                              setName(std::string name) noexcept override { _name = std::move(name); }
+    [[nodiscard]] std::string_view    typeName() const override { return "gr::graph::FusedBlockChain"; }
+    [[nodiscard]] std::string_view    uniqueName() const override { return _uniqueName; }
+    [[nodiscard]] property_map&       metaInformation() noexcept override { return _metaInformation; }
+    [[nodiscard]] const property_map& metaInformation() const override { return _metaInformation; }
+    [[nodiscard]] SettingsBase&       settings() override { return _chain.front()->settings(); } // N.B. settings remain per member block
+    [[nodiscard]] const SettingsBase& settings() const override { return std::as_const(*_chain.front()).settings(); }
+    [[nodiscard]] work::Status        draw(const property_map& /*config*/ = {}) override { return work::Status::ERROR; }
+    [[nodiscard]] void*               raw() override { return this; }
+};
+
+} // namespace gr::graph
+
+#endif // GNURADIO_CHAIN_FUSION_HPP
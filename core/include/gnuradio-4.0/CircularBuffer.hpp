@@ -326,6 +326,9 @@ class CircularBuffer {
                 if (!_parent->_buffer->_isMmapAllocated) {
                     const std::size_t size = _parent->_buffer->_size;
                     // mirror samples below/above the buffer's wrap-around point
+                    // N.B. copy-assignment by design: readers may access a slot through either half, so moving/swapping would
+                    // leave stale or moved-from objects behind. For non-trivial types (e.g. DataSet<T>) copy-assignment re-uses
+                    // the capacities of the destination, i.e. it does not allocate once every slot has held a fully-sized object.
                     const std::size_t nFirstHalf  = std::min(size - _parent->_index, _parent->_nRequestedSamplesToPublish);
                     const std::size_t nSecondHalf = _parent->_nRequestedSamplesToPublish - nFirstHalf;
 
@@ -648,6 +651,12 @@ class CircularBuffer {
             _readIndexCached = _readIndex->value();
         }
 
+        // N.B. only safe if another reader of the same buffer is at or before `startPosition` (i.e. keeps the data from being overwritten)
+        explicit Reader(std::shared_ptr<BufferImpl> buffer, std::size_t startPosition) noexcept : Reader(std::move(buffer)) {
+            _readIndex->setValue(startPosition);
+            _readIndexCached = startPosition;
+        }
+
         Reader(Reader&& other) noexcept
             : _readIndex(std::move(other._readIndex)),                                      //
               _readIndexCached(std::exchange(other._readIndexCached, _readIndex->value())), //
@@ -724,6 +733,15 @@ public:
     [[nodiscard]] BufferWriterLike auto new_writer() { return Writer<T>(_shared_buffer_ptr); }
     [[nodiscard]] BufferReaderLike auto new_reader() { return Reader<T>(_shared_buffer_ptr); }
 
+    /**
+     * @brief creates an additional reader starting at the position of an existing `reader` of this buffer (rather than at the writer's position),
+     * e.g. to tap into an existing stream without copying it. N.B. needs to be called from the thread owning `reader`.
+     */
+    [[nodiscard]] BufferReaderLike auto new_reader(const BufferReaderLike auto& reader) {
+        assert(reader.buffer()._shared_buffer_ptr == _shared_buffer_ptr && "reader needs to belong to the same buffer");
+        return Reader<T>(_shared_buffer_ptr, reader.position());
+    }
+
     // implementation specific interface -- not part of public Buffer / production-code API
     [[nodiscard]] std::size_t n_writers() const { return _shared_buffer_ptr->_writer_count.load(std::memory_order_relaxed); }
     [[nodiscard]] std::size_t n_readers() const { return _shared_buffer_ptr->_reader_count.load(std::memory_order_relaxed); }
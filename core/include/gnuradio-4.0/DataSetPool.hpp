@@ -0,0 +1,85 @@
+#ifndef GNURADIO_DATASETPOOL_HPP
+#define GNURADIO_DATASETPOOL_HPP
+
+#include <cstddef>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "DataSet.hpp"
+
+namespace gr {
+
+/**
+ * @brief bounded, thread-safe free-list of DataSet<T> objects that keeps the heap storage of released data sets alive for re-use.
+ *
+ * A DataSet<T> is a struct of many std::vector<>s and allocating a fresh one for every published chunk/trigger window
+ * dominates the cost of small DataSets. Producers instead `acquire()` a previously used object and overwrite its fields,
+ * consumers (or the producer itself, once a slot in the output buffer has been consumed) hand it back via `release(..)`.
+ *
+ * N.B. recycled objects are returned with their previous content. Producers are expected to overwrite all fields, preferably
+ * by assignment (e.g. `ds = dataSetTemplate;`, `ds.signal_values.assign(...)`, `ds.signal_names.resize(n)` + element-wise
+ * assignment) which re-uses the existing capacities of the outer and nested containers rather than reallocating them.
+ * The same holds for the copy of published slots into the mirrored half of non-mmap'ed `CircularBuffer<DataSet<T>>`s.
+ *
+ * Example:
+ * @code
+ * gr::DataSetPool<float> pool;
+ * auto ds = pool.acquire();           // recycled (or default-constructed if the pool is empty)
+ * ds      = dataSetTemplate;          // re-uses the storage of the previous use
+ * ds.signal_values.assign(data.begin(), data.end());
+ * publish(ds);                        // e.g. std::swap(outputSpan[0], ds) -> 'ds' now holds the previously consumed slot
+ * pool.release(std::move(ds));        // ... which is handed back for the next acquire()
+ * @endcode
+ */
+template<typename T>
+class DataSetPool {
+    mutable std::mutex      _mutex;
+    std::vector<DataSet<T>> _free; // capacity reserved up-front -> push/pop never allocate
+    std::size_t             _capacity;
+
+public:
+    using value_type = DataSet<T>;
+
+    explicit DataSetPool(std::size_t capacity = 16UZ) : _capacity(capacity) { _free.reserve(capacity); }
+
+    DataSetPool(const DataSetPool&)            = delete;
+    DataSetPool& operator=(const DataSetPool&) = delete;
+
+    /**
+     * @brief returns a recycled DataSet (with its previous content and capacities) or a default-constructed one if none is available.
+     */
+    [[nodiscard]] DataSet<T> acquire() {
+        std::lock_guard lock(_mutex);
+        if (_free.empty()) {
+            return {};
+        }
+        DataSet<T> ds = std::move(_free.back());
+        _free.pop_back();
+        return ds;
+    }
+
+    /**
+     * @brief hands a no longer used DataSet back to the pool. The object is dropped (i.e. freed) if the pool is already full.
+     */
+    void release(DataSet<T>&& ds) {
+        std::unique_lock lock(_mutex);
+        if (_free.size() < _capacity) {
+            _free.push_back(std::move(ds));
+            return;
+        }
+        lock.unlock(); // deallocate outside the critical section
+        DataSet<T> dropped = std::move(ds);
+    }
+
+    [[nodiscard]] std::size_t size() const {
+        std::lock_guard lock(_mutex);
+        return _free.size();
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return _capacity; }
+};
+
+} // namespace gr
+
+#endif // GNURADIO_DATASETPOOL_HPP
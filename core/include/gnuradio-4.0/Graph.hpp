@@ -15,6 +15,7 @@
 #include <algorithm>
 #include <iostream>
 #include <map>
+#include <numeric>
 #include <tuple>
 #include <variant>
 
@@ -54,6 +55,8 @@ inline static const char* kGraphInspect   = "GraphInspect";
 inline static const char* kGraphInspected = "GraphInspected";
 
 inline static const char* kRegistryBlockTypes = "RegistryBlockTypes";
+
+inline static const char* kGraphStats = "GraphStats"; ///< execution statistics of all child blocks (by unique name), @see block::Stats
 } // namespace graph::property
 
 class Graph : public gr::Block<Graph> {
@@ -192,6 +195,7 @@ public:
         propertyCallbacks[graph::property::kRemoveEdge]         = &Graph::propertyCallbackRemoveEdge;
         propertyCallbacks[graph::property::kGraphInspect]       = &Graph::propertyCallbackGraphInspect;
         propertyCallbacks[graph::property::kRegistryBlockTypes] = &Graph::propertyCallbackRegistryBlockTypes;
+        propertyCallbacks[graph::property::kGraphStats]         = &Graph::propertyCallbackGraphStats;
     }
     Graph(Graph&)            = delete; // there can be only one owner of Graph
     Graph& operator=(Graph&) = delete; // there can be only one owner of Graph
@@ -541,6 +545,19 @@ public:
         return message;
     }
 
+    std::optional<Message> propertyCallbackGraphStats([[maybe_unused]] std::string_view propertyName, Message message) {
+        assert(propertyName == graph::property::kGraphStats);
+        if constexpr (!block::kStatsEnabled) {
+            throw gr::exception(fmt::format("graph {} property {}: statistics are not enabled (compile with GR_ENABLE_BLOCK_STATS=1), msg: {}", this->unique_name, propertyName, message));
+        }
+        property_map result;
+        for (const auto& child : blocks()) {
+            result[std::string(child->uniqueName())] = child->stats();
+        }
+        message.data = std::move(result);
+        return message;
+    }
+
     std::optional<Message> propertyCallbackRegistryBlockTypes([[maybe_unused]] std::string_view propertyName, Message message) {
         assert(propertyName == graph::property::kRegistryBlockTypes);
         PluginLoader&                   loader      = gr::globalPluginLoader();
@@ -763,9 +780,8 @@ struct to_right_descriptor : TDesc {
  * Note:
  *  - The implementation of the actual processing logic (e.g., `processOne()`, `processOne_simd()`, etc.)
  *    and their SIMD variants is specific to the logic and capabilities of the blocks being merged.
- *
- * Limitations:
- *  - Currently, SIMD support for multiple output ports is not implemented.
+ *  - Blocks that implement `processBulk(..)` (incl. `Resampling<>` decimators/interpolators) are merged by a second
+ *    `MergedGraph` specialisation that chains them through an internal scratch buffer (see below).
  */
 
 template<SourceBlockLike Left, SinkBlockLike Right, std::size_t OutId, std::size_t InId>
@@ -849,6 +865,20 @@ private:
         }(std::make_index_sequence<I>(), std::make_index_sequence<J>());
     }
 
+    // collects all merged outputs (i.e. left outputs except 'OutId' followed by all right outputs) into a flat std::tuple
+    template<typename TLeftOut, typename TRightOut>
+    static constexpr auto merged_outputs(const TLeftOut& left_out, const TRightOut& right_out) {
+        using std::get;
+        constexpr std::size_t kNLeftOut  = traits::block::stream_output_port_types<Left>::size;
+        constexpr std::size_t kNRightOut = traits::block::stream_output_port_types<Right>::size;
+        auto leftRemaining               = [&]<std::size_t... Is, std::size_t... Js>(std::index_sequence<Is...>, std::index_sequence<Js...>) { return std::make_tuple(get<Is>(left_out)..., get<OutId + 1 + Js>(left_out)...); }(std::make_index_sequence<OutId>(), std::make_index_sequence<kNLeftOut - OutId - 1>());
+        if constexpr (kNRightOut == 1) {
+            return std::tuple_cat(std::move(leftRemaining), std::make_tuple(right_out));
+        } else {
+            return std::tuple_cat(std::move(leftRemaining), [&]<std::size_t... Ks>(std::index_sequence<Ks...>) { return std::make_tuple(get<Ks>(right_out)...); }(std::make_index_sequence<kNRightOut>()));
+        }
+    }
+
 public:
     constexpr MergedGraph(Left l, Right r) : left(std::move(l)), right(std::move(r)) {}
 
@@ -864,8 +894,19 @@ public:
     template<meta::any_simd... Ts>
     requires traits::block::can_processOne_simd<Left> and traits::block::can_processOne_simd<Right>
     constexpr vir::simdize<ReturnType, (0, ..., Ts::size())> processOne(const Ts&... inputs) {
-        static_assert(traits::block::stream_output_port_types<Left>::size == 1, "TODO: SIMD for multiple output ports not implemented yet");
-        return apply_right<InId, traits::block::stream_input_port_types<Right>::size() - InId - 1>(std::tie(inputs...), apply_left<traits::block::stream_input_port_types<Left>::size()>(std::tie(inputs...)));
+        if constexpr (traits::block::stream_output_port_types<Left>::size == 1) {
+            return apply_right<InId, traits::block::stream_input_port_types<Right>::size() - InId - 1>(std::tie(inputs...), apply_left<traits::block::stream_input_port_types<Left>::size()>(std::tie(inputs...)));
+        } else {
+            // left produces a simdized tuple: feed the connected element to the right block and pass all others through
+            using std::get;
+            const auto left_out  = apply_left<traits::block::stream_input_port_types<Left>::size()>(std::tie(inputs...));
+            const auto right_out = apply_right<InId, traits::block::stream_input_port_types<Right>::size() - InId - 1>(std::tie(inputs...), get<OutId>(left_out));
+            const auto outputs   = merged_outputs(left_out, right_out);
+
+            vir::simdize<ReturnType, (0, ..., Ts::size())> result{};
+            [&]<std::size_t... Is>(std::index_sequence<Is...>) { ((get<Is>(result) = get<Is>(outputs)), ...); }(std::make_index_sequence<std::tuple_size_v<std::remove_cvref_t<decltype(outputs)>>>());
+            return result;
+        }
     }
 
     constexpr auto processOne_simd(auto N)
@@ -926,11 +967,612 @@ public:
 template<SourceBlockLike Left, SinkBlockLike Right, std::size_t OutId, std::size_t InId>
 inline std::atomic_size_t MergedGraph<Left, Right, OutId, InId>::_unique_id_counter{0UZ};
 
+namespace detail {
+/**
+ * @brief 'ReaderSpanLike' view over the scratch (or outer input) samples handed to the `processBulk(..)` of a merged block.
+ * Consume requests are only recorded and evaluated by the enclosing `MergedGraph`.
+ */
+template<typename T>
+struct MergedReaderSpan {
+    using value_type = std::remove_cv_t<T>;
+    using iterator   = typename std::span<const value_type>::iterator;
+
+private:
+    std::span<const value_type> _span;
+    std::size_t                 _nConsumed = std::dynamic_extent; // dynamic_extent: no explicit consume(..) request -> all samples
+
+public:
+    constexpr explicit MergedReaderSpan(std::span<const value_type> span = {}) noexcept : _span(span) {}
+
+    [[nodiscard]] constexpr iterator          begin() const noexcept { return _span.begin(); }
+    [[nodiscard]] constexpr iterator          end() const noexcept { return _span.end(); }
+    [[nodiscard]] constexpr std::size_t       size() const noexcept { return _span.size(); }
+    [[nodiscard]] constexpr bool              empty() const noexcept { return _span.empty(); }
+    [[nodiscard]] constexpr const value_type* data() const noexcept { return _span.data(); }
+    [[nodiscard]] constexpr const value_type& operator[](std::size_t i) const noexcept { return _span[i]; }
+    operator const std::span<const value_type>&() const noexcept { return _span; }
+    operator std::span<const value_type>&() noexcept { return _span; }
+
+    [[nodiscard]] constexpr bool consume(std::size_t nSamples) noexcept {
+        if (nSamples > _span.size()) {
+            return false;
+        }
+        _nConsumed = nSamples;
+        return true;
+    }
+    [[nodiscard]] constexpr bool        tryConsume(std::size_t nSamples) noexcept { return consume(nSamples); }
+    [[nodiscard]] constexpr std::size_t nSamplesToConsume() const noexcept { return _nConsumed == std::dynamic_extent ? _span.size() : _nConsumed; }
+};
+static_assert(ReaderSpanLike<MergedReaderSpan<int>>);
+
+/**
+ * @brief 'InputSpanLike' scratch span, tag indices are relative to the first sample of the span.
+ */
+template<typename T>
+struct MergedInputSpan : public MergedReaderSpan<T> {
+    MergedReaderSpan<gr::Tag> rawTags;
+    bool                      isConnected = true;
+    bool                      isSync      = true;
+
+    constexpr MergedInputSpan(std::span<const std::remove_cv_t<T>> data, std::span<const gr::Tag> tags_) noexcept : MergedReaderSpan<T>(data), rawTags(tags_) {}
+
+    [[nodiscard]] auto tags() {
+        return std::views::transform(rawTags, [](const gr::Tag& tag) { return std::make_pair(static_cast<std::ptrdiff_t>(tag.index), std::cref(tag.map)); });
+    }
+
+    void consumeTags(std::size_t /*untilLocalIndex*/) noexcept {} // N.B. scratch tags are only valid for a single call
+
+    [[nodiscard]] Tag getMergedTag(std::size_t untilLocalIndex = 1UZ) const {
+        Tag result{0UZ, {}};
+        for (const gr::Tag& tag : rawTags | std::views::take_while([untilLocalIndex](const gr::Tag& t) { return t.index < untilLocalIndex; })) {
+            for (const auto& [key, value] : tag.map) {
+                result.map.insert_or_assign(key, value);
+            }
+        }
+        return result;
+    }
+};
+static_assert(InputSpanLike<MergedInputSpan<int>>);
+
+/**
+ * @brief 'WriterSpanLike' view over the scratch (or outer output) samples, publish requests are recorded as for 'MergedReaderSpan'.
+ */
+template<typename T>
+struct MergedWriterSpan {
+    using value_type = std::remove_cv_t<T>;
+    using iterator   = typename std::span<value_type>::iterator;
+
+private:
+    std::span<value_type> _span;
+    std::size_t           _nPublished = std::dynamic_extent; // dynamic_extent: no explicit publish(..) request -> all samples
+
+public:
+    constexpr explicit MergedWriterSpan(std::span<value_type> span = {}) noexcept : _span(span) {}
+
+    [[nodiscard]] constexpr iterator    begin() const noexcept { return _span.begin(); }
+    [[nodiscard]] constexpr iterator    end() const noexcept { return _span.end(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return _span.size(); }
+    [[nodiscard]] constexpr bool        empty() const noexcept { return _span.empty(); }
+    [[nodiscard]] constexpr value_type* data() const noexcept { return _span.data(); }
+    [[nodiscard]] constexpr value_type& operator[](std::size_t i) const noexcept { return _span[i]; }
+    operator const std::span<value_type>&() const noexcept { return _span; }
+    operator std::span<value_type>&() noexcept { return _span; }
+
+    constexpr void                      publish(std::size_t nSamples) noexcept { _nPublished = std::min(nSamples, _span.size()); }
+    [[nodiscard]] constexpr std::size_t nSamplesToPublish() const noexcept { return _nPublished == std::dynamic_extent ? _span.size() : _nPublished; }
+};
+static_assert(WriterSpanLike<MergedWriterSpan<int>>);
+
+/**
+ * @brief 'OutputSpanLike' scratch span, tags published via 'publishTag(..)' are collected into an external vector.
+ */
+template<typename T>
+struct MergedOutputSpan : public MergedWriterSpan<T> {
+    MergedWriterSpan<gr::Tag> tags{}; // N.B. unused -- tags are collected via publishTag(..)
+    std::vector<gr::Tag>*     publishedTags;
+    bool                      isConnected = true;
+    bool                      isSync      = true;
+
+    constexpr MergedOutputSpan(std::span<std::remove_cv_t<T>> data, std::vector<gr::Tag>& publishedTags_) noexcept : MergedWriterSpan<T>(data), publishedTags(&publishedTags_) {}
+
+    void publishTag(const property_map& tagData, std::size_t tagOffset = 0UZ) {
+        if (!publishedTags->empty() && publishedTags->back().index == tagOffset) { // -> merge tags with the same index
+            for (const auto& [key, value] : tagData) {
+                publishedTags->back().map.insert_or_assign(key, value);
+            }
+            return;
+        }
+        publishedTags->push_back(Tag{tagOffset, tagData});
+    }
+};
+static_assert(OutputSpanLike<MergedOutputSpan<int>>);
+
+struct MergedResamplingRatio {
+    std::size_t in  = 1UZ;
+    std::size_t out = 1UZ;
+};
+
+// effective input:output ratio of a block, nested bulk-merged blocks report the ratio of their whole chain
+template<typename TBlock>
+[[nodiscard]] constexpr MergedResamplingRatio mergedResamplingRatio(const TBlock& block) noexcept {
+    if constexpr (requires { block.mergedInputChunkSize(); }) {
+        return {block.mergedInputChunkSize(), block.mergedOutputChunkSize()};
+    } else {
+        return {static_cast<std::size_t>(block.input_chunk_size.value), static_cast<std::size_t>(block.output_chunk_size.value)};
+    }
+}
+} // namespace detail
+
+template<typename TBlock>
+concept BulkSourceBlockLike = (traits::block::can_processOne<TBlock> or traits::block::can_processBulk<TBlock>) and traits::block::template stream_input_port_types<TBlock>::size <= 1 and traits::block::template stream_output_port_types<TBlock>::size == 1;
+
+template<typename TBlock>
+concept BulkSinkBlockLike = (traits::block::can_processOne<TBlock> or traits::block::can_processBulk<TBlock>) and traits::block::template stream_input_port_types<TBlock>::size == 1 and traits::block::template stream_output_port_types<TBlock>::size <= 1;
+
+template<typename Left, typename Right>
+concept MergeableBlocks = (SourceBlockLike<Left> and SinkBlockLike<Right>) or (BulkSourceBlockLike<Left> and BulkSinkBlockLike<Right>);
+
+/**
+ * @brief `MergedGraph` specialisation for blocks that (also) implement `processBulk(..)`, e.g. `Resampling<>`
+ * decimators/interpolators, FFTs or other chunk-based blocks, that cannot be fused sample-by-sample.
+ *
+ * The left block writes into an internal scratch buffer (sized to a few thousand samples to remain cache-resident)
+ * that is handed directly to the right block, bypassing the run-time circular buffer of a regular edge:
+ *  - rates: the merged block processes in multiples of its combined ratio (see `mergedInputChunkSize()` and
+ *    `mergedOutputChunkSize()`), `processBulk(..)` members are called with `input_chunk_size`-aligned chunks,
+ *    `processOne(..)` members are invoked sample-by-sample. Samples that the right block cannot (yet) consume are
+ *    carried over to the next call. The merged block itself declares `Resampling<>` with `input_chunk_size` and
+ *    `output_chunk_size` set to the combined ratio, i.e. like any other resampling block, a trailing remainder of less
+ *    than `input_chunk_size` samples is dropped once the end-of-stream tag is pending.
+ *  - tags: each member sees the tags of its input via the `in.tags()`/`in.rawTags` scratch span API, tags published via
+ *    `out.publishTag(..)` are forwarded downstream. Unless a member declares `NoDefaultTagForwarding`, its input tags
+ *    are forwarded to its output at the rate-scaled position (as done by `Block<T>` for stand-alone blocks).
+ *
+ *  - lifecycle: the members are not initialised by a graph, i.e. their resampling ratio and other parameters need to be
+ *    set on the member fields (e.g. `decimator.input_chunk_size = 4U;`) before merging. On construction, a member's
+ *    `settingsChanged(..)` callback is invoked once with all of its current parameters (e.g. to design filter taps or to
+ *    derive `input_chunk_size` from a decimation parameter). `start()`, `stop()`, `pause()`, `resume()` and `reset()`
+ *    of the merged block are forwarded to the members.
+ *
+ * Limitations: the merged members are restricted to at most one stream input and one stream output each and a non-zero
+ * `stride` is rejected (throws).
+ */
+template<typename Left, typename Right, std::size_t OutId, std::size_t InId>
+requires(BulkSourceBlockLike<Left> and BulkSinkBlockLike<Right> and not(SourceBlockLike<Left> and SinkBlockLike<Right>))
+class MergedGraph<Left, Right, OutId, InId> : public Block<MergedGraph<Left, Right, OutId, InId>, NoDefaultTagForwarding, Resampling<>> {
+    static_assert(OutId == 0UZ && InId == 0UZ, "bulk-merged blocks have at most one stream input and output port");
+    static_assert(std::is_same_v<typename traits::block::stream_output_port_types<Left>::template at<0>, typename traits::block::stream_input_port_types<Right>::template at<0>>, "Port types do not match");
+
+    static std::atomic_size_t _unique_id_counter;
+
+    template<typename TDesc>
+    friend struct to_right_descriptor;
+
+    template<typename TDesc>
+    friend struct to_left_descriptor;
+
+public:
+    using AllPorts = meta::concat<
+        // Left:
+        typename meta::concat<typename traits::block::all_port_descriptors<Left>::template filter<traits::port::is_message_port>, traits::block::stream_input_ports<Left>, meta::remove_at<OutId, traits::block::stream_output_ports<Left>>>::template transform<to_left_descriptor>,
+        // Right:
+        typename meta::concat<typename traits::block::all_port_descriptors<Right>::template filter<traits::port::is_message_port>, meta::remove_at<InId, traits::block::stream_input_ports<Right>>, traits::block::stream_output_ports<Right>>::template transform<to_right_descriptor>>;
+
+    GR_MAKE_REFLECTABLE(MergedGraph);
+
+    const std::size_t unique_id   = _unique_id_counter++;
+    const std::string unique_name = fmt::format("MergedGraph<{}:{},{}:{}>#{}", gr::meta::type_name<Left>(), OutId, gr::meta::type_name<Right>(), InId, unique_id);
+
+private:
+    using base = Block<MergedGraph<Left, Right, OutId, InId>, NoDefaultTagForwarding, Resampling<>>;
+    using TMid = typename traits::block::stream_output_port_types<Left>::template at<0>;
+
+    static constexpr bool        kHasInput    = traits::block::stream_input_port_types<Left>::size == 1;
+    static constexpr bool        kHasOutput   = traits::block::stream_output_port_types<Right>::size == 1;
+    static constexpr std::size_t kScratchSize = 4096UZ; // nominal number of intermediate samples per pass -> fits L1/L2
+
+    struct StageResult {
+        work::Status status;
+        std::size_t  consumed;
+        std::size_t  produced;
+    };
+
+    Left  left;
+    Right right;
+
+    detail::MergedResamplingRatio _leftRatio;
+    detail::MergedResamplingRatio _rightRatio;
+    std::size_t                   _inChunk  = 1UZ; // combined ratio of the merged chain
+    std::size_t                   _outChunk = 1UZ;
+    std::vector<TMid>             _scratch;
+    std::size_t                   _scratchFill = 0UZ; // samples produced by 'left' and not yet consumed by 'right'
+    std::vector<Tag>              _inputTags;         // outer input tags of the current call, local indices
+    std::vector<Tag>              _scratchTags;       // tags published into the scratch buffer, scratch indices
+    std::vector<Tag>              _outputTags;        // tags published by 'right', local output indices
+
+    friend base;
+
+    template<typename, typename, std::size_t, std::size_t>
+    friend class MergedGraph;
+
+    static constexpr std::size_t merged_work_chunk_size() noexcept {
+        std::size_t chunkSize = kScratchSize;
+        if constexpr (requires { Left::merged_work_chunk_size(); }) {
+            chunkSize = std::min(chunkSize, Left::merged_work_chunk_size());
+        }
+        if constexpr (requires { Right::merged_work_chunk_size(); }) {
+            chunkSize = std::min(chunkSize, Right::merged_work_chunk_size());
+        }
+        return chunkSize;
+    }
+
+    template<typename TBlock>
+    static void checkMember(const TBlock& block) {
+        if (block.stride.value != 0U && block.stride.value != block.input_chunk_size.value) { // N.B. stride == input_chunk_size: back-to-back
+            throw gr::exception(fmt::format("cannot merge '{}': stride = {} is not supported by MergedGraph", block.name.value, block.stride.value));
+        }
+    }
+
+    // N.B. members are not initialised by a graph -> invoke their 'settingsChanged(..)' callback once with all current parameters
+    template<typename TBlock>
+    static void applyMemberSettings(TBlock& block) {
+        if constexpr (HasSettingsChangedCallback<TBlock>) {
+            property_map newSettings;
+            refl::for_each_data_member_index<TBlock>([&block, &newSettings](auto kIdx) {
+                using MemberType = refl::data_member_type<TBlock, kIdx>;
+                using Type       = unwrap_if_wrapped_t<std::remove_cvref_t<MemberType>>;
+                if constexpr (settings::isReadableMember<Type, MemberType>()) {
+                    newSettings.insert_or_assign(std::string(refl::data_member_name<TBlock, kIdx>.view()), pmtv::pmt(refl::data_member<kIdx>(block)));
+                }
+            });
+            if constexpr (requires(const property_map& oldSettings) { block.settingsChanged(oldSettings, newSettings); }) {
+                block.settingsChanged(property_map{}, newSettings);
+            } else {
+                property_map forwardSettings; // N.B. not published -- the members' outputs are not connected to a graph
+                block.settingsChanged(property_map{}, newSettings, forwardSettings);
+            }
+        }
+    }
+
+    void forEachMember(auto&& func) {
+        func(left);
+        func(right);
+    }
+
+    // executes one member on the given spans and returns the number of consumed input and produced output samples
+    template<typename TBlock>
+    static StageResult runStage(TBlock& block, auto input, std::span<const Tag> inputTags, auto output, std::vector<Tag>& outputTags) {
+        using enum work::Status;
+        constexpr bool kIsSource = traits::block::stream_input_port_types<TBlock>::size == 0UZ;
+        constexpr bool kIsSink   = traits::block::stream_output_port_types<TBlock>::size == 0UZ;
+
+        StageResult result{OK, 0UZ, 0UZ};
+        if constexpr (traits::block::can_processBulk<TBlock>) {
+            using TIn  = typename decltype(input)::value_type;
+            using TOut = typename decltype(output)::value_type;
+            detail::MergedInputSpan<TIn>   in(input, inputTags);
+            detail::MergedOutputSpan<TOut> out(output, outputTags);
+            if constexpr (kIsSource) {
+                result.status = block.processBulk(out);
+            } else if constexpr (kIsSink) {
+                result.status = block.processBulk(in);
+            } else {
+                result.status = block.processBulk(in, out);
+            }
+            if (result.status == INSUFFICIENT_INPUT_ITEMS || result.status == INSUFFICIENT_OUTPUT_ITEMS || result.status == ERROR) {
+                return {result.status, 0UZ, 0UZ};
+            }
+            result.consumed = kIsSource ? 0UZ : in.nSamplesToConsume();
+            result.produced = kIsSink ? 0UZ : out.nSamplesToPublish();
+        } else { // processOne(..) -> 1:1
+            const std::size_t nSamples = kIsSource ? output.size() : (kIsSink ? input.size() : std::min(input.size(), output.size()));
+            for (std::size_t i = 0UZ; i < nSamples; i++) {
+                if constexpr (kIsSource) {
+                    output[i] = block.processOne();
+                } else if constexpr (kIsSink) {
+                    block.processOne(input[i]);
+                } else {
+                    output[i] = block.processOne(input[i]);
+                }
+            }
+            result.consumed = kIsSource ? 0UZ : nSamples;
+            result.produced = kIsSink ? 0UZ : nSamples;
+        }
+
+        if constexpr (!kIsSource && !kIsSink && !TBlock::noDefaultTagForwarding) { // default tag forwarding to the rate-scaled output position
+            const detail::MergedResamplingRatio ratio = detail::mergedResamplingRatio(block);
+            for (const Tag& tag : inputTags) {
+                if (tag.index >= result.consumed) {
+                    break;
+                }
+                const std::size_t outIndex = tag.index / ratio.in * ratio.out;
+                if (outputTags.empty() || outputTags.back().index < outIndex) {
+                    outputTags.push_back(Tag{outIndex, tag.map});
+                } else { // N.B. keep the published tags ordered, user-published tags take precedence
+                    auto it = std::ranges::find_if(outputTags, [outIndex](const Tag& t) { return t.index >= outIndex; });
+                    if (it != outputTags.end() && it->index == outIndex) {
+                        for (const auto& [key, value] : tag.map) {
+                            it->map.try_emplace(key, value);
+                        }
+                    } else {
+                        outputTags.insert(it, Tag{outIndex, tag.map});
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    [[nodiscard]] std::size_t leftSourceBudget() const noexcept {
+        if constexpr (requires(const Left& l) {
+                          { available_samples(l) } -> std::same_as<std::size_t>;
+                      }) {
+            return available_samples(left);
+        } else {
+            return std::numeric_limits<std::size_t>::max();
+        }
+    }
+
+    template<typename TIn, typename TOut>
+    work::Status processMerged(TIn& outerIn, TOut& outerOut) {
+        using enum work::Status;
+        constexpr std::size_t kMax = std::numeric_limits<std::size_t>::max();
+
+        const std::size_t nInput  = [&outerIn] {
+            if constexpr (kHasInput) {
+                return outerIn.size();
+            } else {
+                return kMax;
+            }
+        }();
+        const std::size_t nOutput = [&outerOut] {
+            if constexpr (kHasOutput) {
+                return outerOut.size();
+            } else {
+                return kMax;
+            }
+        }();
+
+        _inputTags.clear();
+        if constexpr (kHasInput) {
+            for (const auto& [relIndex, tagMap] : outerIn.tags()) {
+                if (relIndex >= 0 && static_cast<std::size_t>(relIndex) < nInput) {
+                    _inputTags.push_back(Tag{static_cast<std::size_t>(relIndex), tagMap});
+                }
+            }
+        }
+
+        std::size_t  inPos        = 0UZ;
+        std::size_t  outPos       = 0UZ;
+        std::size_t  sourceBudget = kHasInput ? kMax : leftSourceBudget();
+        work::Status leftStatus   = OK;
+        work::Status rightStatus  = OK;
+        bool         progress     = false;
+        std::size_t  nextInputTag = 0UZ;
+        while (rightStatus == OK) {
+            // 1. left: fill the scratch buffer as far as 'right' can process it into the available output space
+            const std::size_t rightMidLimit = kHasOutput ? (nOutput - outPos) / _rightRatio.out * _rightRatio.in : kMax;
+            const std::size_t midTarget     = std::min(_scratch.size(), rightMidLimit);
+            StageResult       leftResult{OK, 0UZ, 0UZ};
+            if (leftStatus == OK && midTarget > _scratchFill) {
+                const std::size_t nChunks = std::min(kHasInput ? (nInput - inPos) / _leftRatio.in : kMax, std::min((midTarget - _scratchFill) / _leftRatio.out, sourceBudget));
+                if (nChunks > 0UZ) {
+                    const std::size_t nLeftIn  = kHasInput ? nChunks * _leftRatio.in : 0UZ;
+                    const std::size_t nLeftOut = nChunks * _leftRatio.out;
+                    const std::size_t tagBegin = nextInputTag;
+                    std::size_t       tagEnd   = tagBegin;
+                    for (; tagEnd < _inputTags.size() && _inputTags[tagEnd].index < inPos + nLeftIn; tagEnd++) {
+                        _inputTags[tagEnd].index -= inPos; // -> relative to the left input chunk
+                    }
+                    const std::size_t nScratchTags = _scratchTags.size();
+                    auto              scratchOut   = std::span<TMid>(_scratch).subspan(_scratchFill, nLeftOut);
+                    if constexpr (kHasInput) {
+                        leftResult = runStage(left, std::span(std::ranges::data(outerIn) + inPos, nLeftIn), std::span<const Tag>(_inputTags).subspan(tagBegin, tagEnd - tagBegin), scratchOut, _scratchTags);
+                    } else {
+                        leftResult = runStage(left, std::span<const TMid>{}, std::span<const Tag>{}, scratchOut, _scratchTags);
+                    }
+                    for (std::size_t i = tagBegin; i < tagEnd; i++) {
+                        _inputTags[i].index += inPos;
+                    }
+                    for (std::size_t i = nScratchTags; i < _scratchTags.size(); i++) { // -> scratch buffer indices
+                        _scratchTags[i].index += _scratchFill;
+                    }
+                    leftStatus = leftResult.status == DONE || leftResult.status == ERROR ? leftResult.status : OK;
+                    inPos += leftResult.consumed;
+                    _scratchFill += leftResult.produced;
+                    sourceBudget = sourceBudget == kMax ? kMax : sourceBudget - std::min(sourceBudget, leftResult.produced);
+                    while (nextInputTag < _inputTags.size() && _inputTags[nextInputTag].index < inPos) {
+                        nextInputTag++;
+                    }
+                }
+            }
+            if (leftStatus == ERROR) {
+                break;
+            }
+
+            // 2. right: process all complete input chunks of the scratch buffer
+            const std::size_t nRightIn = std::min(_scratchFill / _rightRatio.in * _rightRatio.in, rightMidLimit);
+            StageResult       rightResult{OK, 0UZ, 0UZ};
+            if (nRightIn > 0UZ) {
+                const auto nTags = static_cast<std::size_t>(std::ranges::count_if(_scratchTags, [nRightIn](const Tag& tag) { return tag.index < nRightIn; }));
+                const auto input = std::span<const TMid>(_scratch).first(nRightIn);
+                _outputTags.clear();
+                if constexpr (kHasOutput) {
+                    rightResult = runStage(right, input, std::span<const Tag>(_scratchTags).first(nTags), std::span(std::ranges::data(outerOut) + outPos, nRightIn / _rightRatio.in * _rightRatio.out), _outputTags);
+                    for (const Tag& tag : _outputTags) {
+                        if (tag.index < rightResult.produced) {
+                            outerOut.publishTag(tag.map, outPos + tag.index);
+                        }
+                    }
+                } else {
+                    rightResult = runStage(right, input, std::span<const Tag>(_scratchTags).first(nTags), std::span<TMid>{}, _outputTags);
+                }
+                rightStatus = rightResult.status == DONE || rightResult.status == ERROR ? rightResult.status : OK;
+                outPos += rightResult.produced;
+
+                // compact the scratch buffer: carry-over samples/tags not (yet) consumed by 'right'
+                const std::size_t consumed = std::min(rightResult.consumed, _scratchFill);
+                std::move(_scratch.begin() + static_cast<std::ptrdiff_t>(consumed), _scratch.begin() + static_cast<std::ptrdiff_t>(_scratchFill), _scratch.begin());
+                _scratchFill -= consumed;
+                std::erase_if(_scratchTags, [consumed](const Tag& tag) { return tag.index < consumed; });
+                for (Tag& tag : _scratchTags) {
+                    tag.index -= consumed;
+                }
+            }
+
+            const bool passProgress = leftResult.consumed > 0UZ || leftResult.produced > 0UZ || rightResult.consumed > 0UZ || rightResult.produced > 0UZ;
+            progress                = progress || passProgress;
+            if (!passProgress || (!kHasInput && !kHasOutput)) { // N.B. blocks w/o ports: one scratch buffer per call
+                break;
+            }
+        }
+
+        if constexpr (kHasInput) {
+            std::ignore = outerIn.consume(inPos);
+        }
+        if constexpr (kHasOutput) {
+            outerOut.publish(outPos);
+        }
+
+        if (leftStatus == ERROR || rightStatus == ERROR) {
+            return ERROR;
+        }
+        if (rightStatus == DONE || (leftStatus == DONE && _scratchFill < _rightRatio.in)) {
+            return DONE;
+        }
+        if (!progress) {
+            return kHasInput ? INSUFFICIENT_INPUT_ITEMS : INSUFFICIENT_OUTPUT_ITEMS;
+        }
+        return OK;
+    }
+
+public:
+    MergedGraph(Left l, Right r, property_map initParameters = {}) : base(std::move(initParameters)), left(std::move(l)), right(std::move(r)) {
+        applyMemberSettings(left); // N.B. may update the members' resampling ratio
+        applyMemberSettings(right);
+        checkMember(left);
+        checkMember(right);
+        _leftRatio  = detail::mergedResamplingRatio(left);
+        _rightRatio = detail::mergedResamplingRatio(right);
+        if constexpr (!kHasInput) { // N.B. sources have no resampling ratio
+            _leftRatio = {1UZ, 1UZ};
+        }
+        if constexpr (!kHasOutput) { // N.B. sinks have no resampling ratio
+            _rightRatio.out = 1UZ;
+        }
+
+        // smallest self-contained unit: 'k' left chunks produce an integer number of right input chunks
+        const std::size_t k = _rightRatio.in / std::gcd(_leftRatio.out, _rightRatio.in);
+        _inChunk            = k * _leftRatio.in;
+        _outChunk           = k * _leftRatio.out / _rightRatio.in * _rightRatio.out;
+
+        const std::size_t unit = k * _leftRatio.out; // intermediate samples per unit
+        _scratch.resize(std::max(unit, kScratchSize / unit * unit));
+
+        // N.B. the scheduler hands out complete units only -> the end-of-stream remainder is dropped rather than stalling
+        this->input_chunk_size  = static_cast<gr::Size_t>(_inChunk);
+        this->output_chunk_size = static_cast<gr::Size_t>(_outChunk);
+    }
+
+    /// default-constructed members, e.g. for 'Graph::emplaceBlock<MergedGraph<..>>(..)' of members that derive their configuration in 'settingsChanged(..)'
+    explicit MergedGraph(property_map initParameters = {})
+    requires(std::default_initializable<Left> && std::default_initializable<Right>)
+        : MergedGraph(Left(), Right(), std::move(initParameters)) {}
+
+    void start() {
+        forEachMember([](auto& block) {
+            if constexpr (requires { block.start(); }) {
+                block.start();
+            }
+        });
+    }
+
+    void stop() {
+        forEachMember([](auto& block) {
+            if constexpr (requires { block.stop(); }) {
+                block.stop();
+            }
+        });
+    }
+
+    void pause() {
+        forEachMember([](auto& block) {
+            if constexpr (requires { block.pause(); }) {
+                block.pause();
+            }
+        });
+    }
+
+    void resume() {
+        forEachMember([](auto& block) {
+            if constexpr (requires { block.resume(); }) {
+                block.resume();
+            }
+        });
+    }
+
+    void reset() {
+        forEachMember([](auto& block) {
+            if constexpr (requires { block.reset(); }) {
+                block.reset();
+            }
+        });
+    }
+
+    /// combined number of input samples consumed for each `mergedOutputChunkSize()` output samples (cf. `input_chunk_size`)
+    [[nodiscard]] constexpr std::size_t mergedInputChunkSize() const noexcept { return _inChunk; }
+    /// combined number of output samples produced for each `mergedInputChunkSize()` input samples (cf. `output_chunk_size`)
+    [[nodiscard]] constexpr std::size_t mergedOutputChunkSize() const noexcept { return _outChunk; }
+
+    // if the left block (source) implements available_samples (a customization point), then pass the call through (rate-scaled)
+    friend constexpr std::size_t available_samples(const MergedGraph& self) noexcept
+    requires requires(const Left& l) {
+        { available_samples(l) } -> std::same_as<std::size_t>;
+    }
+    {
+        const std::size_t nAvailable = available_samples(self.left);
+        return nAvailable == std::numeric_limits<std::size_t>::max() ? nAvailable : nAvailable / self._inChunk * self._outChunk;
+    }
+
+    work::Status processBulk(InputSpanLike auto& in, OutputSpanLike auto& out)
+    requires(kHasInput && kHasOutput)
+    {
+        return processMerged(in, out);
+    }
+
+    work::Status processBulk(OutputSpanLike auto& out)
+    requires(!kHasInput && kHasOutput)
+    {
+        std::nullptr_t noInput = nullptr;
+        return processMerged(noInput, out);
+    }
+
+    work::Status processBulk(InputSpanLike auto& in)
+    requires(kHasInput && !kHasOutput)
+    {
+        std::nullptr_t noOutput = nullptr;
+        return processMerged(in, noOutput);
+    }
+
+    work::Status processBulk()
+    requires(!kHasInput && !kHasOutput)
+    {
+        std::nullptr_t noInput  = nullptr;
+        std::nullptr_t noOutput = nullptr;
+        return processMerged(noInput, noOutput);
+    }
+};
+
+template<typename Left, typename Right, std::size_t OutId, std::size_t InId>
+requires(BulkSourceBlockLike<Left> and BulkSinkBlockLike<Right> and not(SourceBlockLike<Left> and SinkBlockLike<Right>))
+inline std::atomic_size_t MergedGraph<Left, Right, OutId, InId>::_unique_id_counter{0UZ};
+
 /**
  * This methods can merge simple blocks that are defined via a single `auto processOne(..)` producing a
  * new `merged` node, bypassing the dynamic run-time buffers.
  * Since the merged node can be highly optimised during compile-time, it's execution performance is usually orders
  * of magnitude more efficient than executing a cascade of the same constituent blocks. See the benchmarks for details.
+ * Blocks that implement `processBulk(..)` (e.g. `Resampling<>` decimators) are chained via an internal scratch buffer.
  * This function uses the connect-by-port-ID API.
  *
  * Example:
@@ -948,7 +1590,8 @@ inline std::atomic_size_t MergedGraph<Left, Right, OutId, InId>::_unique_id_coun
  * }
  * @endcode
  */
-template<std::size_t OutId, std::size_t InId, SourceBlockLike A, SinkBlockLike B>
+template<std::size_t OutId, std::size_t InId, typename A, typename B>
+requires MergeableBlocks<A, B>
 constexpr auto mergeByIndex(A&& a, B&& b) -> MergedGraph<std::remove_cvref_t<A>, std::remove_cvref_t<B>, OutId, InId> {
     if constexpr (!std::is_same_v<typename traits::block::stream_output_port_types<std::remove_cvref_t<A>>::template at<OutId>, typename traits::block::stream_input_port_types<std::remove_cvref_t<B>>::template at<InId>>) {
         gr::meta::print_types<gr::meta::message_type<"OUTPUT_PORTS_ARE:">, typename traits::block::stream_output_port_types<std::remove_cvref_t<A>>, std::integral_constant<int, OutId>, typename traits::block::stream_output_port_types<std::remove_cvref_t<A>>::template at<OutId>,
@@ -980,7 +1623,8 @@ constexpr auto mergeByIndex(A&& a, B&& b) -> MergedGraph<std::remove_cvref_t<A>,
  * }
  * @endcode
  */
-template<meta::fixed_string OutName, meta::fixed_string InName, SourceBlockLike A, SinkBlockLike B>
+template<meta::fixed_string OutName, meta::fixed_string InName, typename A, typename B>
+requires MergeableBlocks<A, B>
 constexpr auto merge(A&& a, B&& b) {
     constexpr int OutIdUnchecked = meta::indexForName<OutName, typename traits::block::stream_output_ports<A>>();
     constexpr int InIdUnchecked  = meta::indexForName<InName, typename traits::block::stream_input_ports<B>>();
@@ -82,6 +82,27 @@ public:
         static_assert(N == std::dynamic_extent, "incompatible fixed capacity and using capacity argument");
     }
 
+    /**
+     * @brief Changes the capacity keeping the newest min(size(), newCapacity) elements (moved in a single pass rather than re-pushed).
+     */
+    constexpr void set_capacity(std::size_t newCapacity) {
+        static_assert(N == std::dynamic_extent, "cannot change a fixed capacity");
+        if (newCapacity == 0) {
+            throw std::out_of_range("capacity is zero");
+        }
+        if (newCapacity == _capacity) {
+            return;
+        }
+        const std::size_t nKeep = std::min(_size, newCapacity);
+        buffer_type       newBuffer(newCapacity * 2, _buffer.get_allocator());
+        std::move(begin(), std::next(begin(), static_cast<signed_index_type>(nKeep)), newBuffer.begin()); // newest element at index 0
+        std::copy_n(newBuffer.begin(), nKeep, std::next(newBuffer.begin(), static_cast<signed_index_type>(newCapacity)));
+        _buffer         = std::move(newBuffer);
+        _capacity       = newCapacity;
+        _size           = nKeep;
+        _write_position = 0UZ;
+    }
+
     /**
      * @brief Adds an element to the end expiring the oldest element beyond the buffer's capacities.
      */
@@ -0,0 +1,156 @@
+#ifndef GNURADIO_LATENCY_PROBE_HPP
+#define GNURADIO_LATENCY_PROBE_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <gnuradio-4.0/SingleWriterCounter.hpp>
+#include <gnuradio-4.0/Tag.hpp>
+
+namespace gr::latency {
+
+/**
+ * End-to-end latency measurement via probe tags:
+ * sources (or a 'gr::testing::LatencyProbeInjector' placed after them) periodically publish a 'gr::tag::LATENCY_PROBE'
+ * tag carrying the monotonic time of its injection and the name of the injecting block (the 'path'). The probe travels
+ * with the default tag forwarding ('Block::publishMergedInputTag(..)'), and any block downstream can compute its age:
+ * - all blocks if compiled with 'GR_ENABLE_BLOCK_STATS=1' (@see block::Stats, 'probe_latency'), and
+ * - sinks such as 'gr::testing::LatencyMonitor' which publish the per-path histograms via their message port.
+ * N.B. the age is the time the probe spent in buffers and blocks before the receiving block's 'work(..)' started.
+ */
+
+inline constexpr const char* kProbeTime   = "time";   // probe injection time, [ns] since steady_clock epoch
+inline constexpr const char* kProbeSource = "source"; // unique name of the injecting block
+
+[[nodiscard]] inline std::uint64_t nowNs() noexcept { return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()); }
+
+/// tag map entry for a newly injected probe, e.g. 'outSpan.publishTag(property_map{makeProbe(name)}, 0UZ)'
+[[nodiscard]] inline std::pair<std::string, pmtv::pmt> makeProbe(std::string_view source, std::uint64_t timeNs = nowNs()) { //
+    return {std::string(tag::LATENCY_PROBE.shortKey()), property_map{{kProbeTime, timeNs}, {kProbeSource, std::string(source)}}};
+}
+
+namespace detail {
+[[nodiscard]] inline const property_map* findProbe(const property_map& tagMap) noexcept {
+    const auto it = tagMap.find(tag::LATENCY_PROBE.shortKey());
+    return it != tagMap.end() ? std::get_if<property_map>(&it->second) : nullptr;
+}
+
+template<typename T>
+[[nodiscard]] inline const T* findProbeField(const property_map& probe, const char* key) noexcept {
+    const auto it = probe.find(key);
+    return it != probe.end() ? std::get_if<T>(&it->second) : nullptr;
+}
+} // namespace detail
+
+/// age of the probe contained in the given tag map (if any)
+[[nodiscard]] inline std::optional<std::uint64_t> probeAgeNs(const property_map& tagMap, std::uint64_t timeNs = nowNs()) noexcept {
+    const property_map* probe = detail::findProbe(tagMap);
+    const auto*         time  = probe != nullptr ? detail::findProbeField<std::uint64_t>(*probe, kProbeTime) : nullptr;
+    if (time == nullptr) {
+        return std::nullopt;
+    }
+    return timeNs > *time ? timeNs - *time : 0U;
+}
+
+/// unique name of the block that injected the probe contained in the given tag map (if any)
+[[nodiscard]] inline std::optional<std::string_view> probeSource(const property_map& tagMap) noexcept {
+    const property_map* probe  = detail::findProbe(tagMap);
+    const auto*         source = probe != nullptr ? detail::findProbeField<std::string>(*probe, kProbeSource) : nullptr;
+    return source != nullptr ? std::optional<std::string_view>(*source) : std::nullopt;
+}
+
+/**
+ * @brief fixed-size log-linear latency histogram: exact below 16 ns, 8 sub-buckets (i.e. <= 12.5% relative error) per
+ * power of two above. Single writer, relaxed atomics permit concurrent reads (e.g. from the message handler).
+ */
+class Histogram {
+public:
+    static constexpr std::size_t kLinearBuckets = 16UZ;
+    static constexpr std::size_t kSubBucketBits = 3UZ;
+    static constexpr std::size_t kSubBuckets    = 1UZ << kSubBucketBits;
+    static constexpr std::size_t kFirstExponent = std::bit_width(kLinearBuckets) - 1UZ; // 2^4 = 16
+    static constexpr std::size_t kNBuckets      = kLinearBuckets + (64UZ - kFirstExponent) * kSubBuckets;
+
+private:
+    using Counter = SingleWriterCounter;
+    std::array<Counter, kNBuckets> _buckets{};
+    Counter                        _count{0U};
+    Counter                        _sum{0U};
+    Counter                        _max{0U};
+
+public:
+    [[nodiscard]] static constexpr std::size_t bucketIndex(std::uint64_t value) noexcept {
+        if (value < kLinearBuckets) {
+            return static_cast<std::size_t>(value);
+        }
+        const std::size_t exponent = static_cast<std::size_t>(std::bit_width(value)) - 1UZ;
+        const std::size_t sub      = static_cast<std::size_t>(value >> (exponent - kSubBucketBits)) & (kSubBuckets - 1UZ);
+        return kLinearBuckets + (exponent - kFirstExponent) * kSubBuckets + sub;
+    }
+
+    /// largest value mapped to the given bucket
+    [[nodiscard]] static constexpr std::uint64_t bucketUpperBound(std::size_t index) noexcept {
+        if (index < kLinearBuckets) {
+            return index;
+        }
+        const std::size_t   exponent = (index - kLinearBuckets) / kSubBuckets + kFirstExponent;
+        const std::uint64_t sub      = (index - kLinearBuckets) % kSubBuckets;
+        const std::uint64_t width    = 1ULL << (exponent - kSubBucketBits);
+        return ((kSubBuckets + sub) << (exponent - kSubBucketBits)) + (width - 1U);
+    }
+
+    void record(std::uint64_t valueNs) noexcept {
+        singleWriterAdd(_buckets[bucketIndex(valueNs)], 1U);
+        singleWriterAdd(_count, 1U);
+        singleWriterAdd(_sum, valueNs);
+        if (valueNs > _max.load(std::memory_order_relaxed)) {
+            _max.store(valueNs, std::memory_order_relaxed);
+        }
+    }
+
+    void reset() noexcept {
+        for (Counter& bucket : _buckets) {
+            bucket.store(0U, std::memory_order_relaxed);
+        }
+        for (Counter* counter : {&_count, &_sum, &_max}) {
+            counter->store(0U, std::memory_order_relaxed);
+        }
+    }
+
+    [[nodiscard]] std::uint64_t count() const noexcept { return _count.load(std::memory_order_relaxed); }
+    [[nodiscard]] std::uint64_t max() const noexcept { return _max.load(std::memory_order_relaxed); }
+    [[nodiscard]] std::uint64_t mean() const noexcept { return count() == 0U ? 0U : _sum.load(std::memory_order_relaxed) / count(); }
+
+    /// upper bound of the bucket containing the q-quantile (q in [0, 1]), clamped to the recorded maximum
+    [[nodiscard]] std::uint64_t quantile(double q) const noexcept {
+        const std::uint64_t n = count();
+        if (n == 0U) {
+            return 0U;
+        }
+        const auto    rank       = static_cast<std::uint64_t>(std::clamp(q, 0.0, 1.0) * static_cast<double>(n - 1U)) + 1U;
+        std::uint64_t cumulative = 0U;
+        for (std::size_t i = 0UZ; i < kNBuckets; i++) {
+            cumulative += _buckets[i].load(std::memory_order_relaxed);
+            if (cumulative >= rank) {
+                return std::min(bucketUpperBound(i), max());
+            }
+        }
+        return max();
+    }
+
+    [[nodiscard]] property_map toPropertyMap() const {
+        return {{"count", count()}, {"mean_ns", mean()}, {"p50_ns", quantile(0.50)}, {"p90_ns", quantile(0.90)}, {"p99_ns", quantile(0.99)}, {"max_ns", max()}};
+    }
+};
+
+} // namespace gr::latency
+
+#endif // GNURADIO_LATENCY_PROBE_HPP
@@ -0,0 +1,174 @@
+#ifndef GNURADIO_PERF_COUNTERS_HPP
+#define GNURADIO_PERF_COUNTERS_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+
+#include <fmt/format.h>
+
+#include <gnuradio-4.0/SingleWriterCounter.hpp>
+#include <gnuradio-4.0/Tag.hpp>
+
+#if __has_include(<unistd.h>) && __has_include(<sys/ioctl.h>) && __has_include(<sys/syscall.h>) && __has_include(<linux/perf_event.h>) && !defined(__EMSCRIPTEN__) && !defined(GR_NO_PERF_COUNTER)
+#define GR_HAS_PERF_COUNTER 1
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#define GR_HAS_PERF_COUNTER 0
+#endif
+
+namespace gr::profiling::perf {
+
+/**
+ * @brief snapshot (or difference) of the hardware performance counters of a thread
+ */
+struct CounterValues {
+    std::uint64_t cycles          = 0U;
+    std::uint64_t instructions    = 0U;
+    std::uint64_t cacheReferences = 0U;
+    std::uint64_t cacheMisses     = 0U;
+    std::uint64_t branchMisses    = 0U;
+
+    [[nodiscard]] constexpr CounterValues operator-(const CounterValues& other) const noexcept { //
+        return {cycles - other.cycles, instructions - other.instructions, cacheReferences - other.cacheReferences, cacheMisses - other.cacheMisses, branchMisses - other.branchMisses};
+    }
+};
+
+/**
+ * @brief group of hardware counters (cycles, instructions, cache references/misses, branch misses) of the calling
+ * thread, opened via 'perf_event_open(..)' and read as a whole with a single system call.
+ *
+ * N.B. Linux only and subject to '/proc/sys/kernel/perf_event_paranoid' (<= 2 for user-space counting of own threads)
+ * and to the availability of a PMU (often missing in virtual machines). If not available, 'isValid()' is false and all
+ * readings are zero.
+ */
+class ThreadCounters {
+    static constexpr std::size_t kNCounters = 5UZ;
+    std::array<int, kNCounters>  _fds{-1, -1, -1, -1, -1};
+
+#if GR_HAS_PERF_COUNTER
+    static int open(std::uint64_t config, int groupFd) noexcept {
+        perf_event_attr attr{};
+        attr.size           = sizeof(perf_event_attr);
+        attr.type           = PERF_TYPE_HARDWARE;
+        attr.config         = config;
+        attr.disabled       = groupFd == -1 ? 1 : 0; // the group is enabled via its leader
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+        attr.read_format    = PERF_FORMAT_GROUP;
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0 /* calling thread */, -1 /* any CPU */, groupFd, PERF_FLAG_FD_CLOEXEC));
+    }
+#endif
+
+    void close() noexcept {
+#if GR_HAS_PERF_COUNTER
+        for (int& fd : _fds) {
+            if (fd != -1) {
+                ::close(fd);
+            }
+            fd = -1;
+        }
+#endif
+    }
+
+public:
+    ThreadCounters() noexcept {
+#if GR_HAS_PERF_COUNTER
+        constexpr std::array<std::uint64_t, kNCounters> kConfig{PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_REFERENCES, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+        for (std::size_t i = 0UZ; i < kNCounters; i++) {
+            _fds[i] = open(kConfig[i], _fds[0]);
+            if (_fds[i] == -1) {
+                static std::atomic_flag reported = ATOMIC_FLAG_INIT;
+                if (!reported.test_and_set()) {
+                    fmt::println(stderr, "perf::ThreadCounters: hardware counters not available (error {}: '{}') -- check '/proc/sys/kernel/perf_event_paranoid' and PMU support", errno, std::strerror(errno));
+                }
+                close();
+                return;
+            }
+        }
+        if (ioctl(_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) == -1) {
+            close();
+        }
+#endif
+    }
+
+    ~ThreadCounters() { close(); }
+
+    ThreadCounters(const ThreadCounters&)            = delete;
+    ThreadCounters& operator=(const ThreadCounters&) = delete;
+    ThreadCounters(ThreadCounters&&)                 = delete;
+    ThreadCounters& operator=(ThreadCounters&&)      = delete;
+
+    [[nodiscard]] bool isValid() const noexcept { return _fds[0] != -1; }
+
+    [[nodiscard]] CounterValues read() const noexcept {
+#if GR_HAS_PERF_COUNTER
+        std::array<std::uint64_t, 1UZ + kNCounters> data{}; // layout of PERF_FORMAT_GROUP: { nr, values[nr] }
+        if (isValid() && ::read(_fds[0], data.data(), sizeof(data)) == static_cast<ssize_t>(sizeof(data))) {
+            return {data[1], data[2], data[3], data[4], data[5]};
+        }
+#endif
+        return {};
+    }
+
+    /// counters of the calling (e.g. scheduler worker) thread, opened on first use
+    [[nodiscard]] static const ThreadCounters& forThisThread() noexcept {
+        thread_local const ThreadCounters counters;
+        return counters;
+    }
+};
+
+/**
+ * @brief hardware counter deltas accumulated over the sampled work calls of a block.
+ */
+struct alignas(hardware_destructive_interference_size) BlockCounters {
+    using Counter = SingleWriterCounter;
+
+    Counter nCalls{0U};   // all work calls
+    Counter nSamples{0U}; // sampled work calls, i.e. calls contributing to the counters below
+    Counter cycles{0U};
+    Counter instructions{0U};
+    Counter cacheReferences{0U};
+    Counter cacheMisses{0U};
+    Counter branchMisses{0U};
+
+    void recordSample(const CounterValues& delta) noexcept {
+        singleWriterAdd(nSamples, 1U);
+        singleWriterAdd(cycles, delta.cycles);
+        singleWriterAdd(instructions, delta.instructions);
+        singleWriterAdd(cacheReferences, delta.cacheReferences);
+        singleWriterAdd(cacheMisses, delta.cacheMisses);
+        singleWriterAdd(branchMisses, delta.branchMisses);
+    }
+
+    void reset() noexcept {
+        for (Counter* counter : {&nCalls, &nSamples, &cycles, &instructions, &cacheReferences, &cacheMisses, &branchMisses}) {
+            counter->store(0U, std::memory_order_relaxed);
+        }
+    }
+
+    [[nodiscard]] property_map toPropertyMap() const {
+        const auto   load        = [](const Counter& counter) { return counter.load(std::memory_order_relaxed); };
+        const double nCycles     = static_cast<double>(load(cycles));
+        const double nReferences = static_cast<double>(load(cacheReferences));
+        return {{"calls", load(nCalls)},                 //
+            {"sampled_calls", load(nSamples)},           //
+            {"cycles", load(cycles)},                    //
+            {"instructions", load(instructions)},        //
+            {"cache_references", load(cacheReferences)}, //
+            {"cache_misses", load(cacheMisses)},         //
+            {"branch_misses", load(branchMisses)},       //
+            {"ipc", nCycles > 0. ? static_cast<double>(load(instructions)) / nCycles : 0.},
+            {"cache_miss_ratio", nReferences > 0. ? static_cast<double>(load(cacheMisses)) / nReferences : 0.}};
+    }
+};
+
+} // namespace gr::profiling::perf
+
+#endif // GNURADIO_PERF_COUNTERS_HPP
@@ -695,7 +695,7 @@ public:
         return false;
     }
 
-    [[nodiscard]] constexpr static std::size_t available() noexcept { return 0; } //  ↔ maps to Buffer::Buffer[Reader, Writer].available()
+    [[nodiscard]] std::size_t available() const noexcept { return _ioHandler.available(); } //  ↔ maps to Buffer::Buffer[Reader, Writer].available(), i.e. readable samples (input) or free space (output)
 
     [[nodiscard]] constexpr std::size_t min_buffer_size() const noexcept {
         if constexpr (Required::kIsConst) {
@@ -974,6 +974,7 @@ private:
         [[nodiscard]] virtual std::size_t nReaders() const   = 0;
         [[nodiscard]] virtual std::size_t nWriters() const   = 0;
         [[nodiscard]] virtual std::size_t bufferSize() const = 0;
+        [[nodiscard]] virtual std::size_t available() const  = 0;
     };
 
     std::unique_ptr<model> _accessor;
@@ -1040,6 +1041,7 @@ private:
         [[nodiscard]] std::size_t nReaders() const override { return _value.nReaders(); }
         [[nodiscard]] std::size_t nWriters() const override { return _value.nWriters(); }
         [[nodiscard]] std::size_t bufferSize() const override { return _value.bufferSize(); }
+        [[nodiscard]] std::size_t available() const override { return _value.available(); }
 
         [[nodiscard]] bool isConnected() const noexcept override { return _value.isConnected(); }
 
@@ -1107,6 +1109,7 @@ public:
     [[nodiscard]] std::size_t nReaders() const { return _accessor->nReaders(); }
     [[nodiscard]] std::size_t nWriters() const { return _accessor->nWriters(); }
     [[nodiscard]] std::size_t bufferSize() const { return _accessor->bufferSize(); }
+    [[nodiscard]] std::size_t available() const { return _accessor->available(); }
 
     [[nodiscard]] ConnectionResult disconnect() noexcept { return _accessor->disconnect(); }
 
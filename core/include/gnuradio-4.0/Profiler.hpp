@@ -5,13 +5,26 @@
 
 #include <fmt/format.h>
 
+#include <array>
+#include <atomic>
+#include <bit>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
 #include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <span>
 #include <string>
 #include <string_view>
 #include <thread>
+#include <type_traits>
 #include <unordered_map>
 #include <variant>
+#include <vector>
 
 #include <unistd.h>
 
@@ -23,7 +36,7 @@ namespace detail {
 using clock      = std::chrono::high_resolution_clock;
 using time_point = clock::time_point;
 
-enum class EventType {
+enum class EventType : char {
     DurationBegin = 'B', // Duration Event (begin).
     DurationEnd   = 'E', // Duration Event (end).
     Complete      = 'X', // Complete Event.
@@ -37,62 +50,274 @@ enum class EventType {
     FlowEnd       = 'f'  // Flow Event (end).
 };
 
-inline std::string format_args(const std::vector<arg_value>& args) {
-    if (args.empty()) {
-        return "{}";
+enum class ArgType : std::uint32_t { None = 0U, Int, Double, String };
+
+struct BinaryArg {
+    std::uint32_t keyId = 0U; // interned argument name
+    ArgType       type  = ArgType::None;
+    std::uint64_t value = 0U; // int64, bit-cast double, or interned string id
+};
+
+inline constexpr std::size_t kMaxArgs = 2UZ; // N.B. additional arguments are dropped
+
+/**
+ * @brief fixed-size, trivially copyable trace record -- names, categories and string arguments are interned, i.e.
+ * referenced by ids into the profiler's string table. This is also the record layout of the binary trace file.
+ */
+struct BinaryEvent {
+    std::int64_t                     ts          = 0;  // [ns] since profiler start
+    std::int64_t                     dur         = 0;  // [ns] duration of 'Complete' events
+    std::uint32_t                    nameId      = 0U; // interned event name
+    std::uint32_t                    catId       = 0U; // interned event categories
+    std::uint32_t                    id          = 0U; // ID for matching async or flow events
+    std::uint16_t                    threadIndex = 0U; // dense per-profiler thread index
+    EventType                        type        = EventType::Instant;
+    std::uint8_t                     nArgs       = 0U;
+    std::array<BinaryArg, kMaxArgs> args{};
+};
+
+// size of BinaryEvent must be power of 2, otherwise circular_buffer doesn't work correctly
+static_assert(std::has_single_bit(sizeof(BinaryEvent)) && sizeof(BinaryEvent) == 64UZ);
+static_assert(std::is_trivially_copyable_v<BinaryEvent>);
+
+struct EncodedArgs {
+    std::array<BinaryArg, kMaxArgs> args{};
+    std::uint8_t                    nArgs = 0U;
+};
+
+struct StringHash {
+    using is_transparent = void;
+    [[nodiscard]] std::size_t operator()(std::string_view str) const noexcept { return std::hash<std::string_view>{}(str); }
+};
+
+/**
+ * @brief process-wide (per profiler) table of interned strings. Ids are dense and stable, id '0' is the empty string.
+ */
+class StringTable {
+    mutable std::mutex                                                   _mutex;
+    std::deque<std::string>                                              _strings{std::string{}}; // N.B. deque: stable references for the views below
+    std::unordered_map<std::string_view, std::uint32_t, StringHash, std::equal_to<>> _ids{{std::string_view{}, 0U}};
+
+public:
+    [[nodiscard]] std::uint32_t intern(std::string_view str) {
+        std::lock_guard lock(_mutex);
+        if (auto it = _ids.find(str); it != _ids.end()) {
+            return it->second;
+        }
+        const std::string& stored = _strings.emplace_back(str);
+        const auto         id     = static_cast<std::uint32_t>(_strings.size() - 1UZ);
+        _ids.emplace(stored, id);
+        return id;
     }
-    std::string r = "{";
-    for (std::size_t i = 0; i < args.size(); ++i) {
-        if (i > 0) {
-            r += ",";
+
+    /// appends all strings with an id >= 'result.size()' to 'result'
+    void copyNewStrings(std::vector<std::string>& result) const {
+        std::lock_guard lock(_mutex);
+        for (std::size_t i = result.size(); i < _strings.size(); i++) {
+            result.push_back(_strings[i]);
         }
-        if (std::holds_alternative<std::string>(args[i].second)) {
-            r += fmt::format("\"{}\":\"{}\"", args[i].first, std::get<std::string>(args[i].second));
-        } else if (std::holds_alternative<double>(args[i].second)) {
-            r += fmt::format("\"{}\":{}", args[i].first, std::get<double>(args[i].second));
-        } else {
-            r += fmt::format("\"{}\":{}", args[i].first, std::get<int>(args[i].second));
+    }
+};
+
+inline void appendJsonString(std::string& out, std::string_view str) {
+    for (const char c : str) {
+        switch (c) {
+        case '"': out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\n': out += "\\n"; break;
+        case '\t': out += "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                out += fmt::format("\\u{:04x}", static_cast<unsigned>(c));
+            } else {
+                out += c;
+            }
         }
     }
-    r += "}";
-    return r;
 }
 
-struct alignas(256) TraceEvent { // fills up to power of 2 size, see static_assert below. unaligned size is 152
-    std::thread::id           thread_id;
-    std::string               name;   // Event name.
-    EventType                 type;   // Event type.
-    std::chrono::microseconds ts;     // Timestamp
-    std::chrono::microseconds dur;    // Duration of the event, for 'X' type.
-    int                       id = 0; // ID for matching async or flow events.
-    std::string               cat;    // Event categories.
-    std::vector<arg_value>    args;   // Event arguments.
-
-    // Function to format a TraceEvent into JSON format.
-    std::string toJSON(int pid, int tid) const {
-        using enum EventType;
-        switch (type) {
-        case DurationBegin:
-        case DurationEnd:
-        case Counter:
-        case Instant: return fmt::format(R"({{"name": "{}", "ph": "{}", "ts": {}, "pid": {}, "tid": {}, "cat": "{}", "args": {}}})", name, static_cast<char>(type), ts.count(), pid, tid, cat, format_args(args));
-        case Complete: return fmt::format(R"({{"name": "{}", "ph": "X", "ts": {}, "pid": {}, "tid": {}, "dur": {}, "cat": "{}", "args": {}}})", name, ts.count(), pid, tid, dur.count(), cat, format_args(args));
-        case AsyncStart:
-        case AsyncStep:
-        case AsyncEnd: return fmt::format(R"({{"name": "{}", "ph": "{}", "ts": {}, "pid": {}, "tid": {}, "id": "{}", "cat": "{}", "args": {}}})", name, static_cast<char>(type), ts.count(), pid, tid, id, cat, format_args(args));
-        default: // TODO
-            return fmt::format(R"({{"name": "{}", "ph": "{}", "ts": {}, "pid": {}, "tid": {}, "cat": "{}", "args": {}}})", name, static_cast<char>(type), ts.count(), pid, tid, cat, format_args(args));
+/**
+ * @brief Chrome/Perfetto JSON trace output ('chrome://tracing', 'ui.perfetto.dev') of binary events
+ */
+class JsonTraceWriter {
+    std::ostream&            _out;
+    int                      _pid;
+    bool                     _isFirst = true;
+    std::vector<std::string> _strings;
+    std::string              _line;
+
+    [[nodiscard]] std::string_view str(std::uint32_t id) const noexcept { return id < _strings.size() ? std::string_view(_strings[id]) : std::string_view("<unknown>"); }
+
+    void appendArgs(const BinaryEvent& event) {
+        _line += '{';
+        for (std::size_t i = 0UZ; i < std::min<std::size_t>(event.nArgs, kMaxArgs); i++) {
+            const BinaryArg& arg = event.args[i];
+            if (i > 0UZ) {
+                _line += ',';
+            }
+            _line += '"';
+            appendJsonString(_line, str(arg.keyId));
+            _line += "\":";
+            switch (arg.type) {
+            case ArgType::Int: _line += fmt::format("{}", static_cast<std::int64_t>(arg.value)); break;
+            case ArgType::Double: _line += fmt::format("{}", std::bit_cast<double>(arg.value)); break;
+            case ArgType::String:
+                _line += '"';
+                appendJsonString(_line, str(static_cast<std::uint32_t>(arg.value)));
+                _line += '"';
+                break;
+            default: _line += "null";
+            }
         }
+        _line += '}';
+    }
 
-        return {};
+public:
+    JsonTraceWriter(std::ostream& out, int pid) : _out(out), _pid(pid) {}
+
+    std::vector<std::string>& strings() noexcept { return _strings; }
+
+    void begin() { _out << "[\n"; }
+
+    void write(const BinaryEvent& event) {
+        using enum EventType;
+        _line.clear();
+        _line += _isFirst ? "{\"name\": \"" : ",\n{\"name\": \"";
+        appendJsonString(_line, str(event.nameId));
+        _line += fmt::format(R"(", "ph": "{}", "ts": {:.3f}, "pid": {}, "tid": {})", static_cast<char>(event.type), static_cast<double>(event.ts) * 1e-3, _pid, event.threadIndex);
+        if (event.type == Complete) {
+            _line += fmt::format(R"(, "dur": {:.3f})", static_cast<double>(event.dur) * 1e-3);
+        } else if (event.type == AsyncStart || event.type == AsyncStep || event.type == AsyncEnd) {
+            _line += fmt::format(R"(, "id": "{}")", event.id);
+        }
+        _line += R"(, "cat": ")";
+        appendJsonString(_line, str(event.catId));
+        _line += R"(", "args": )";
+        appendArgs(event);
+        _line += '}';
+        _out << _line;
+        _isFirst = false;
     }
+
+    void end() { _out << "\n]\n"; }
 };
 
-// size of TraceEvent must be power of 2, otherwise circular_buffer doesn't work correctly
-static_assert(std::has_single_bit(sizeof(TraceEvent)));
+/**
+ * @brief compact binary trace output, file layout (native endianness):
+ *  header: 'kMagic' (8 bytes), version (uint32), pid (uint32)
+ *  records: 'S' id (uint32), length (uint32), characters -- string table entry, emitted before the first event referencing it
+ *           'E' count (uint32), count x BinaryEvent      -- raw events
+ * @see convertBinaryTraceToJson(..)
+ */
+class BinaryTraceWriter {
+    std::ostream& _out;
+    std::size_t   _nStringsWritten = 0UZ;
+
+    template<typename T>
+    void writeRaw(const T& value) {
+        _out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+public:
+    static constexpr std::array<char, 8> kMagic{'G', 'R', 'T', 'R', 'A', 'C', 'E', '\0'};
+    static constexpr std::uint32_t       kVersion = 1U;
+
+    BinaryTraceWriter(std::ostream& out, int pid) : _out(out) {
+        _out.write(kMagic.data(), kMagic.size());
+        writeRaw(kVersion);
+        writeRaw(static_cast<std::uint32_t>(pid));
+    }
+
+    void writeStrings(const std::vector<std::string>& strings) {
+        for (; _nStringsWritten < strings.size(); _nStringsWritten++) {
+            const std::string& str = strings[_nStringsWritten];
+            _out.put('S');
+            writeRaw(static_cast<std::uint32_t>(_nStringsWritten));
+            writeRaw(static_cast<std::uint32_t>(str.size()));
+            _out.write(str.data(), static_cast<std::streamsize>(str.size()));
+        }
+    }
+
+    void writeEvents(std::span<const BinaryEvent> events) {
+        if (events.empty()) {
+            return;
+        }
+        _out.put('E');
+        writeRaw(static_cast<std::uint32_t>(events.size()));
+        _out.write(reinterpret_cast<const char*>(events.data()), static_cast<std::streamsize>(events.size_bytes()));
+    }
+};
 
 } // namespace detail
 
+/**
+ * @brief offline conversion of a binary trace (@see OutputFormat::Binary) into the Chrome/Perfetto JSON trace format
+ * @return false if the input is not a (complete) binary trace
+ */
+inline bool convertBinaryTraceToJson(std::istream& in, std::ostream& out) {
+    using detail::BinaryEvent;
+    using detail::BinaryTraceWriter;
+    auto readRaw        = [&in]<typename T>(T& value) { return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T))); };
+    auto fitsIntoStream = [&in](std::size_t nBytes) { // N.B. guards the allocations below against corrupt record sizes, non-seekable streams are read in chunks
+        const std::streampos position = in.tellg();
+        if (position < 0 || !in.seekg(0, std::ios::end)) {
+            in.clear();
+            return true;
+        }
+        const std::streampos end = in.tellg();
+        in.seekg(position);
+        return end >= position && nBytes <= static_cast<std::size_t>(end - position);
+    };
+
+    std::array<char, 8> magic{};
+    std::uint32_t       version = 0U;
+    std::uint32_t       pid     = 0U;
+    if (!in.read(magic.data(), magic.size()) || magic != BinaryTraceWriter::kMagic || !readRaw(version) || version != BinaryTraceWriter::kVersion || !readRaw(pid)) {
+        return false;
+    }
+
+    constexpr std::size_t    kMaxEventsPerRead = 4096UZ;
+    detail::JsonTraceWriter  json(out, static_cast<int>(pid));
+    std::vector<BinaryEvent> events;
+    json.begin();
+    for (int recordType = in.get(); recordType != std::char_traits<char>::eof(); recordType = in.get()) {
+        std::uint32_t first  = 0U;
+        std::uint32_t second = 0U;
+        if (recordType == 'S' && readRaw(first) && readRaw(second)) {
+            if (first > json.strings().size() || !fitsIntoStream(second)) { // N.B. ids are written densely and in order
+                return false;
+            }
+            std::string str(second, '\0');
+            if (!in.read(str.data(), static_cast<std::streamsize>(second))) {
+                return false;
+            }
+            if (first == json.strings().size()) {
+                json.strings().push_back(std::move(str));
+            } else {
+                json.strings()[first] = std::move(str);
+            }
+        } else if (recordType == 'E' && readRaw(first)) {
+            if (!fitsIntoStream(static_cast<std::size_t>(first) * sizeof(BinaryEvent))) {
+                return false;
+            }
+            for (std::size_t nRemaining = first; nRemaining > 0UZ;) {
+                events.resize(std::min(nRemaining, kMaxEventsPerRead));
+                if (!in.read(reinterpret_cast<char*>(events.data()), static_cast<std::streamsize>(events.size() * sizeof(BinaryEvent)))) {
+                    return false;
+                }
+                for (const BinaryEvent& event : events) {
+                    json.write(event);
+                }
+                nRemaining -= events.size();
+            }
+        } else {
+            return false;
+        }
+    }
+    json.end();
+    return true;
+}
+
 template<typename T>
 concept SimpleEvent = requires(T e) {
     { e.finish() } -> std::same_as<void>;
@@ -120,9 +345,17 @@ concept ProfilerLike = requires(T p) {
 
 enum class OutputMode { StdOut, File };
 
+enum class OutputFormat {
+    Binary, /// compact binary trace, @see convertBinaryTraceToJson(..) and the 'gr-trace2json' tool
+    Json    /// Chrome/Perfetto JSON trace
+};
+
 struct Options {
-    std::string output_file;
-    OutputMode  output_mode = OutputMode::File;
+    std::string               output_file;
+    OutputMode                output_mode   = OutputMode::File;
+    OutputFormat              output_format = OutputFormat::Binary; // N.B. OutputMode::StdOut always uses JSON
+    std::size_t               buffer_size   = 32768UZ;              // per-thread event ring capacity, events are dropped (and counted) if full
+    std::chrono::milliseconds flush_interval{10};                   // period of the output thread draining the rings, 'buffer_size' needs to cover the events recorded per thread within this period
 };
 
 namespace null {
@@ -156,87 +389,83 @@ public:
 
 template<typename Handler>
 struct CompleteEvent {
-    Handler&               _handler;
-    std::string            _name;
-    std::string            _categories;
-    std::vector<arg_value> _args;
-    bool                   _finished = false;
-    detail::time_point     _start    = detail::clock::now();
+    Handler&            _handler;
+    std::uint32_t       _nameId;
+    std::uint32_t       _catId;
+    detail::EncodedArgs _args;
+    bool                _finished = false;
+    detail::time_point  _start    = detail::clock::now();
 
-    explicit CompleteEvent(Handler& handler, std::string_view name, std::string_view categories, std::initializer_list<arg_value> args) : _handler{handler}, _name{name}, _categories{categories}, _args{args} {}
+    explicit CompleteEvent(Handler& handler, std::string_view name, std::string_view categories, std::initializer_list<arg_value> args) : _handler{handler}, _nameId{handler.intern(name)}, _catId{handler.intern(categories)}, _args{handler.encodeArgs(args)} {}
 
     ~CompleteEvent() { finish(); }
 
     CompleteEvent(const CompleteEvent&)                = delete;
     CompleteEvent& operator=(const CompleteEvent&)     = delete;
-    CompleteEvent(CompleteEvent&&) noexcept            = default;
-    CompleteEvent& operator=(CompleteEvent&&) noexcept = default;
+    CompleteEvent(CompleteEvent&& other) noexcept : _handler(other._handler), _nameId(other._nameId), _catId(other._catId), _args(other._args), _finished(std::exchange(other._finished, true)), _start(other._start) {}
+    CompleteEvent& operator=(CompleteEvent&&) noexcept = delete;
 
     void finish() noexcept {
         if (_finished) {
             return;
         }
-        const auto elapsed = detail::clock::now() - _start;
-        auto       r       = _handler.reserveEvent();
-        r[0].name          = _name;
-        r[0].type          = detail::EventType::Complete;
-        r[0].ts            = std::chrono::duration_cast<std::chrono::microseconds>(_start - _handler.Profiler().start());
-        r[0].dur           = std::chrono::duration_cast<std::chrono::microseconds>(elapsed);
-        r[0].cat           = _categories;
-        r[0].args          = _args;
-        r.publish(1);
+        _handler.postEvent(detail::EventType::Complete, _nameId, _catId, 0U, _start, detail::clock::now() - _start, _args);
         _finished = true;
     }
 };
 
 template<typename Handler>
 class AsyncEvent {
-    Handler&    _handler;
-    bool        _finished = false;
-    int         _id;
-    std::string _name;
+    Handler&      _handler;
+    bool          _finished = false;
+    std::uint32_t _id;
+    std::uint32_t _nameId;
 
 public:
-    explicit AsyncEvent(Handler& handler, std::string_view name, int id, std::string_view categories = {}, std::initializer_list<arg_value> args = {}) : _handler(handler), _id{id}, _name{name} { postEvent(detail::EventType::AsyncStart, categories, args); }
+    explicit AsyncEvent(Handler& handler, std::string_view name, std::uint32_t id, std::string_view categories = {}, std::initializer_list<arg_value> args = {}) : _handler(handler), _id{id}, _nameId{handler.intern(name)} { //
+        _handler.postEvent(detail::EventType::AsyncStart, _nameId, _handler.intern(categories), _id, detail::clock::now(), {}, _handler.encodeArgs(args));
+    }
 
     ~AsyncEvent() { finish(); }
 
-    AsyncEvent(const AsyncEvent&)                = delete;
-    AsyncEvent& operator=(const AsyncEvent&)     = delete;
-    AsyncEvent(AsyncEvent&&) noexcept            = default;
-    AsyncEvent& operator=(AsyncEvent&&) noexcept = default;
+    AsyncEvent(const AsyncEvent&)            = delete;
+    AsyncEvent& operator=(const AsyncEvent&) = delete;
+    AsyncEvent(AsyncEvent&& other) noexcept : _handler(other._handler), _finished(std::exchange(other._finished, true)), _id(other._id), _nameId(other._nameId) {}
+    AsyncEvent& operator=(AsyncEvent&&) noexcept = delete;
 
-    void step() noexcept { postEvent(detail::EventType::AsyncStep); }
+    void step() noexcept { _handler.postEvent(detail::EventType::AsyncStep, _nameId, 0U, _id, detail::clock::now()); }
 
     void finish() noexcept {
         if (_finished) {
             return;
         }
-        postEvent(detail::EventType::AsyncEnd);
+        _handler.postEvent(detail::EventType::AsyncEnd, _nameId, 0U, _id, detail::clock::now());
         _finished = true;
     }
-
-private:
-    void postEvent(detail::EventType type, std::string_view categories = {}, std::initializer_list<arg_value> args = {}) noexcept {
-        auto r    = _handler.reserveEvent();
-        r[0].name = _name;
-        r[0].type = type;
-        r[0].id   = _id;
-        r[0].cat  = categories;
-        r[0].args = args;
-        r.publish(1);
-    }
 };
 
-template<typename TProfiler, typename TWriterType>
+/**
+ * @brief per-thread event producer: owns a single-producer/single-consumer ring of fixed-size binary events that is
+ * drained by the profiler's output thread. Names are interned once per thread (local cache), i.e. recording an event
+ * neither allocates nor takes a lock in steady state. If the ring is full, the event is dropped and counted.
+ * N.B. the event functions are not 'noexcept': interning a new name locks and allocates (may throw 'std::bad_alloc').
+ */
+template<typename TProfiler>
 class Handler {
-    using this_t = Handler<TProfiler, TWriterType>;
-    TProfiler&  _profiler;
-    TWriterType _writer;
-    int         _nextId = 1;
+    using this_t     = Handler<TProfiler>;
+    using BufferType = gr::CircularBuffer<detail::BinaryEvent>;
+
+    TProfiler&                                                                      _profiler;
+    std::uint16_t                                                                   _threadIndex;
+    BufferType                                                                      _buffer;
+    decltype(std::declval<BufferType&>().new_writer())                              _writer = _buffer.new_writer();
+    decltype(std::declval<BufferType&>().new_reader())                              _reader = _buffer.new_reader(); // N.B. only accessed by the output thread
+    std::unordered_map<std::string, std::uint32_t, detail::StringHash, std::equal_to<>> _idCache;
+    std::uint32_t                                                                   _nextId = 1U;
+    std::atomic<std::size_t>                                                        _nDropped{0UZ};
 
 public:
-    explicit Handler(TProfiler& profiler, TWriterType&& writer) : _profiler(profiler), _writer{std::move(writer)} {}
+    explicit Handler(TProfiler& profiler, std::uint16_t threadIndex, std::size_t bufferSize) : _profiler(profiler), _threadIndex(threadIndex), _buffer(bufferSize) {}
 
     Handler(const this_t&)               = delete;
     this_t& operator=(const this_t&)     = delete;
@@ -245,110 +474,200 @@ public:
 
     const TProfiler& Profiler() const { return _profiler; }
 
-    auto reserveEvent() noexcept {
-        const auto elapsed = detail::clock::now() - _profiler.start();
-        auto       r       = _writer.reserve(1);
-        r[0].thread_id     = std::this_thread::get_id();
-        r[0].ts            = std::chrono::duration_cast<std::chrono::microseconds>(elapsed);
-        return r;
+    [[nodiscard]] auto&       reader() noexcept { return _reader; }
+    [[nodiscard]] std::size_t droppedEvents() const noexcept { return _nDropped.load(std::memory_order_relaxed); }
+
+    [[nodiscard]] std::uint32_t intern(std::string_view str) {
+        if (str.empty()) {
+            return 0U;
+        }
+        if (auto it = _idCache.find(str); it != _idCache.end()) {
+            return it->second;
+        }
+        const std::uint32_t id = _profiler.strings().intern(str);
+        _idCache.emplace(std::string(str), id);
+        return id;
     }
 
-    void instantEvent(std::string_view name, std::string_view categories = {}, std::initializer_list<arg_value> args = {}) noexcept {
-        auto r    = reserveEvent();
-        r[0].name = name;
-        r[0].type = detail::EventType::Instant;
-        r[0].cat  = categories;
-        r[0].args = args;
-        r.publish(1);
+    [[nodiscard]] detail::EncodedArgs encodeArgs(std::initializer_list<arg_value> args) {
+        detail::EncodedArgs result;
+        for (const auto& [key, value] : args) {
+            if (result.nArgs == detail::kMaxArgs) {
+                break;
+            }
+            detail::BinaryArg& arg = result.args[result.nArgs++];
+            arg.keyId              = intern(key);
+            if (const int* v = std::get_if<int>(&value)) {
+                arg = {arg.keyId, detail::ArgType::Int, static_cast<std::uint64_t>(static_cast<std::int64_t>(*v))};
+            } else if (const double* d = std::get_if<double>(&value)) {
+                arg = {arg.keyId, detail::ArgType::Double, std::bit_cast<std::uint64_t>(*d)};
+            } else {
+                arg = {arg.keyId, detail::ArgType::String, intern(std::get<std::string>(value))};
+            }
+        }
+        return result;
     }
 
-    void counterEvent(std::string_view name, std::string_view categories, std::initializer_list<arg_value> args = {}) noexcept {
-        auto r    = reserveEvent();
-        r[0].name = name;
-        r[0].type = detail::EventType::Counter;
-        r[0].cat  = std::string{categories};
-        r[0].args = args;
-        r.publish(1);
+    void postEvent(detail::EventType type, std::uint32_t nameId, std::uint32_t catId, std::uint32_t id, detail::time_point time, detail::clock::duration duration = {}, const detail::EncodedArgs& args = {}) noexcept {
+        auto span = _writer.tryReserve(1UZ);
+        if (span.size() == 0UZ) {
+            _nDropped.fetch_add(1UZ, std::memory_order_relaxed);
+            return;
+        }
+        span[0] = detail::BinaryEvent{.ts = std::chrono::duration_cast<std::chrono::nanoseconds>(time - _profiler.start()).count(), //
+            .dur                          = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count(),                 //
+            .nameId                       = nameId,
+            .catId                        = catId,
+            .id                           = id,
+            .threadIndex                  = _threadIndex,
+            .type                         = type,
+            .nArgs                        = args.nArgs,
+            .args                         = args.args};
+        span.publish(1UZ);
     }
 
-    [[nodiscard]] CompleteEvent<this_t> startCompleteEvent(std::string_view name, std::string_view categories = {}, std::initializer_list<arg_value> args = {}) noexcept { return CompleteEvent<this_t>{*this, name, categories, args}; }
+    void instantEvent(std::string_view name, std::string_view categories = {}, std::initializer_list<arg_value> args = {}) { postEvent(detail::EventType::Instant, intern(name), intern(categories), 0U, detail::clock::now(), {}, encodeArgs(args)); }
+
+    void counterEvent(std::string_view name, std::string_view categories, std::initializer_list<arg_value> args = {}) { postEvent(detail::EventType::Counter, intern(name), intern(categories), 0U, detail::clock::now(), {}, encodeArgs(args)); }
+
+    [[nodiscard]] CompleteEvent<this_t> startCompleteEvent(std::string_view name, std::string_view categories = {}, std::initializer_list<arg_value> args = {}) { return CompleteEvent<this_t>{*this, name, categories, args}; }
 
-    [[nodiscard]] AsyncEvent<this_t> startAsyncEvent(std::string_view name, std::string_view categories = {}, std::initializer_list<arg_value> args = {}) noexcept {
+    [[nodiscard]] AsyncEvent<this_t> startAsyncEvent(std::string_view name, std::string_view categories = {}, std::initializer_list<arg_value> args = {}) {
         const auto id = _nextId;
         ++_nextId;
         return AsyncEvent<this_t>{*this, name, id, categories, args};
     }
 };
 
+/**
+ * @brief the default profiler: events are recorded into per-thread rings (@see Handler) and written by a single output
+ * thread that sleeps between flushes ('Options::flush_interval') -- either as compact binary trace (default, convert
+ * with 'convertBinaryTraceToJson(..)' or 'gr-trace2json') or directly as Chrome/Perfetto JSON.
+ */
 class Profiler {
-    gr::CircularBuffer<detail::TraceEvent> _buffer;
-    using WriterType  = decltype(_buffer.new_writer());
-    using HandlerType = Handler<Profiler, WriterType>;
+    using HandlerType = Handler<Profiler>;
+
+    Options                                _options;
+    detail::StringTable                    _strings;
     std::mutex                             _handlers_lock;
-    std::map<std::thread::id, HandlerType> _handlers;
-    std::atomic<bool>                      _finished = false;
-    decltype(_buffer.new_reader())         _reader   = _buffer.new_reader();
+    std::map<std::thread::id, HandlerType> _handlers; // N.B. node-based container: handler addresses are stable
+    std::mutex                             _wake_lock;
+    std::condition_variable                _wake;
+    bool                                   _finished = false; // guarded by '_wake_lock'
+    detail::time_point                     _start    = detail::clock::now();
     std::thread                            _event_handler;
-    detail::time_point                     _start = detail::clock::now();
 
-public:
-    explicit Profiler(const Options& options = {}) : _buffer(500000) {
-        _event_handler = std::thread([options, &reader = _reader, &finished = _finished]() {
-            auto          file_name = options.output_file;
-            std::ofstream out_file;
-            if (file_name.empty() && options.output_mode == OutputMode::File) {
-                static std::atomic<int> counter = 0;
-                file_name                       = fmt::format("profile.{}.{}.trace", getpid(), counter++);
-                out_file                        = std::ofstream(file_name, std::ios::out | std::ios::binary);
+    void drainEvents(auto&& writeEvents) {
+        std::vector<HandlerType*> handlers;
+        {
+            std::lock_guard lock{_handlers_lock};
+            handlers.reserve(_handlers.size());
+            for (auto& [_, handler] : _handlers) {
+                handlers.push_back(&handler);
+            }
+        }
+        for (HandlerType* handler : handlers) {
+            auto&             reader     = handler->reader();
+            const std::size_t nAvailable = reader.available();
+            if (nAvailable == 0UZ) {
+                continue;
             }
+            ReaderSpanLike auto events = reader.get(nAvailable);
+            writeEvents(std::span<const detail::BinaryEvent>(events.data(), events.size()));
+            std::ignore = events.consume(events.size());
+        }
+    }
 
-            std::ostream& out_stream = options.output_mode == OutputMode::File ? out_file : std::cout;
-            const int     pid        = getpid();
-
-            // assign numerical values to threads as we see them
-            std::unordered_map<std::thread::id, int> mapped_threads;
-            bool                                     seen_finished = false;
-
-            fmt::print(out_stream, "[\n");
-            bool is_first = true;
-            while (!seen_finished) {
-                seen_finished = finished;
-                while (reader.available() > 0) {
-                    ReaderSpanLike auto event = reader.get(1);
-                    auto                it    = mapped_threads.find(event[0].thread_id);
-                    if (it == mapped_threads.end()) {
-                        it = mapped_threads.emplace(event[0].thread_id, static_cast<int>(mapped_threads.size())).first;
-                    }
-                    if (!is_first) {
-                        fmt::print(out_stream, ",\n{}", event[0].toJSON(pid, it->second));
-                    } else {
-                        fmt::print(out_stream, "{}", event[0].toJSON(pid, it->second));
-                    }
-                    is_first    = false;
-                    std::ignore = event.consume(1);
+    void runOutputLoop() {
+        std::string file_name = _options.output_file;
+        if (file_name.empty() && _options.output_mode == OutputMode::File) {
+            static std::atomic<int> counter = 0;
+            file_name                       = fmt::format("profile.{}.{}.{}", getpid(), counter++, _options.output_format == OutputFormat::Binary ? "grtrace" : "trace");
+        }
+        std::ofstream out_file;
+        if (_options.output_mode == OutputMode::File) {
+            out_file = std::ofstream(file_name, std::ios::out | std::ios::binary);
+        }
+        std::ostream& out_stream = _options.output_mode == OutputMode::File ? static_cast<std::ostream&>(out_file) : std::cout;
+        const int     pid        = getpid();
+
+        std::vector<std::string> strings;
+        auto                     loop = [this](auto&& writeEvents) {
+            std::unique_lock lock{_wake_lock};
+            while (true) {
+                const bool finished = _finished;
+                lock.unlock();
+                drainEvents(writeEvents);
+                lock.lock();
+                if (finished) {
+                    return;
                 }
+                // N.B. timed wake-up by design: notifying on each empty -> non-empty ring transition would add a (futex) syscall to the
+                // recording threads' hot path, 'flush_interval' thus bounds the output latency and dimensions the rings ('buffer_size')
+                _wake.wait_for(lock, _options.flush_interval, [this] { return _finished; });
             }
-            fmt::println(out_stream, "\n]");
-        });
+        };
+
+        if (_options.output_mode == OutputMode::File && _options.output_format == OutputFormat::Binary) {
+            detail::BinaryTraceWriter writer(out_stream, pid);
+            loop([this, &writer, &strings](std::span<const detail::BinaryEvent> events) {
+                _strings.copyNewStrings(strings); // N.B. after reading the events: includes all ids they reference
+                writer.writeStrings(strings);
+                writer.writeEvents(events);
+            });
+        } else {
+            detail::JsonTraceWriter writer(out_stream, pid);
+            writer.begin();
+            loop([this, &writer](std::span<const detail::BinaryEvent> events) {
+                _strings.copyNewStrings(writer.strings());
+                for (const auto& event : events) {
+                    writer.write(event);
+                }
+            });
+            writer.end();
+        }
+        out_stream.flush();
+    }
 
+public:
+    explicit Profiler(const Options& options = {}) : _options(options) {
         reset();
+        _event_handler = std::thread([this] { runOutputLoop(); });
     }
 
     ~Profiler() {
-        _finished = true;
+        {
+            std::lock_guard lock{_wake_lock};
+            _finished = true;
+        }
+        _wake.notify_all();
         _event_handler.join();
+        if (const std::size_t nDropped = droppedEvents(); nDropped > 0UZ) {
+            fmt::println(std::cerr, "gr::profiling::Profiler: dropped {} events (per-thread buffer_size: {})", nDropped, _options.buffer_size);
+        }
     }
 
     detail::time_point start() const { return _start; }
 
     void reset() noexcept { _start = detail::clock::now(); }
 
-    Handler<Profiler, WriterType>& forThisThread() {
+    [[nodiscard]] detail::StringTable& strings() noexcept { return _strings; }
+
+    [[nodiscard]] std::size_t droppedEvents() {
+        std::lock_guard lock{_handlers_lock};
+        std::size_t     nDropped = 0UZ;
+        for (const auto& [_, handler] : _handlers) {
+            nDropped += handler.droppedEvents();
+        }
+        return nDropped;
+    }
+
+    HandlerType& forThisThread() {
         const auto            this_id = std::this_thread::get_id();
         const std::lock_guard lock{_handlers_lock};
         auto                  it = _handlers.find(this_id);
         if (it == _handlers.end()) {
-            it = _handlers.try_emplace(this_id, *this, _buffer.new_writer()).first;
+            it = _handlers.try_emplace(this_id, *this, static_cast<std::uint16_t>(_handlers.size()), _options.buffer_size).first;
         }
 
         return it->second;
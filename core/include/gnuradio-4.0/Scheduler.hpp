@@ -8,11 +8,15 @@
 #include <set>
 #include <source_location>
 #include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
+#include <gnuradio-4.0/ChainFusion.hpp>
 #include <gnuradio-4.0/Graph.hpp>
 #include <gnuradio-4.0/LifeCycle.hpp>
 #include <gnuradio-4.0/Message.hpp>
+#include <gnuradio-4.0/PerfCounters.hpp>
 #include <gnuradio-4.0/Port.hpp>
 #include <gnuradio-4.0/Profiler.hpp>
 #include <gnuradio-4.0/meta/reflection.hpp>
@@ -28,6 +32,23 @@ enum class ExecutionPolicy {
     singleThreadedBlocking /// blocks with a time-out if none of the blocks in the graph made progress (N.B. a CPU/battery power-saving measures)
 };
 
+/**
+ * @brief work-size hint for a (type-erased) block: the scheduler defers the block until at least 'minBatchSize' samples
+ * are available on all of its connected synchronous input ports or until the block has been deferred for 'maxLatency',
+ * i.e. it trades latency for fewer, larger 'work(..)' calls that amortise the fixed per-call overhead.
+ * If 'alignment' > 1, the requested work is rounded down to multiples thereof (e.g. FFT sizes or SIMD widths).
+ * 'minBatchSize' is clamped to the smallest connected input buffer size when the scheduler starts.
+ */
+struct BatchPolicy {
+    std::size_t               minBatchSize = 0UZ; // 0, 1: deferral disabled
+    std::chrono::microseconds maxLatency{1000};
+    std::size_t               alignment = 0UZ; // 0, 1: no alignment
+};
+
+namespace property {
+inline static const char* kPerfCounters = "PerfCounters"; ///< sampled hardware counters per block (by unique name), Get or retrieve-and-reset (Set), @see perf_counter_interval
+} // namespace property
+
 template<typename Derived, ExecutionPolicy execution = ExecutionPolicy::singleThreaded, profiling::ProfilerLike TProfiler = profiling::null::Profiler>
 class SchedulerBase : public Block<Derived> {
     friend class lifecycle::StateMachine<Derived>;
@@ -42,6 +63,27 @@ protected:
     std::recursive_mutex                _jobListsMutex; // only used when modifying and copying the graph->local job list
     JobLists                            _jobLists = std::make_shared<std::vector<std::vector<BlockModel*>>>();
 
+    std::vector<std::unique_ptr<gr::graph::FusedBlockChain>> _fusedChains; // scheduling units replacing linear block chains in the job lists
+
+    struct BatchState {
+        BatchPolicy                           policy;
+        BlockModel*                           inputBlock = nullptr; // block whose input ports gate the unit, i.e. the head member of fused chains
+        std::chrono::steady_clock::time_point deferredSince{};
+        bool                                  isDeferred = false;
+        bool                                  isDone     = false;
+    };
+    std::unordered_map<std::string, BatchPolicy>      _batchPolicies; // per-block overrides of the scheduler-wide policy (key: block unique name)
+    std::unordered_map<const BlockModel*, BatchState> _batchStates;   // gated scheduling units, (re-)built by 'start()' -- N.B. each entry is only accessed by the worker owning the unit
+
+    struct PerfCounterState {
+        std::string                    uniqueName;
+        std::size_t                    interval          = 0UZ;
+        std::size_t                    nCallsSinceSample = 0UZ;
+        profiling::perf::BlockCounters counters;
+        std::atomic<bool>              resetRequested{false}; // N.B. 'counters' are reset by the owning worker, @see perfCounters(bool)
+    };
+    std::unordered_map<const BlockModel*, PerfCounterState> _perfCounters; // per scheduling unit, (re-)built by 'start()' if 'perf_counter_interval' > 0 -- N.B. written only by the worker owning the unit
+
     MsgPortOutForChildren    _toChildMessagePort;
     MsgPortInFromChildren    _fromChildMessagePort;
     std::vector<gr::Message> _pendingMessagesToChildren;
@@ -50,11 +92,17 @@ protected:
 public:
     using base_t = Block<Derived>;
 
-    Annotated<gr::Size_t, "timeout", Doc<"sleep timeout to wait if graph has made no progress ">>                              timeout_ms                      = 10U;
-    Annotated<gr::Size_t, "timeout_inactivity_count", Doc<"number of inactive cycles w/o progress before sleep is triggered">> timeout_inactivity_count        = 20U;
-    Annotated<gr::Size_t, "process_stream_to_message_ratio", Doc<"number of stream to msg processing">>                        process_stream_to_message_ratio = 16U;
+    Annotated<gr::Size_t, "timeout", Doc<"sleep timeout to wait if graph has made no progress ">>                                     timeout_ms                      = 10U;
+    Annotated<gr::Size_t, "timeout_inactivity_count", Doc<"number of inactive cycles w/o progress before sleep is triggered">>        timeout_inactivity_count        = 20U;
+    Annotated<gr::Size_t, "process_stream_to_message_ratio", Doc<"number of stream to msg processing">>                               process_stream_to_message_ratio = 16U;
+    Annotated<bool, "fuse_linear_chains", Doc<"execute linear 1:1 block chains as single cache-blocked scheduling units">>            fuse_linear_chains              = false;
+    Annotated<gr::Size_t, "chain_strip_size", Doc<"samples per block invocation within fused chains (sizes chain-internal buffers)">> chain_strip_size                = 1024U;
+    Annotated<gr::Size_t, "min_batch_size", Doc<"defer blocks until N input samples are available (0: disabled)">>                   min_batch_size                  = 0U;
+    Annotated<gr::Size_t, "max_batch_latency", Unit<"us">, Doc<"max. time a block is deferred waiting for 'min_batch_size'">>         max_batch_latency_us            = 1000U;
+    Annotated<gr::Size_t, "batch_alignment", Doc<"requested work of deferred blocks is rounded to multiples of N (0: none)">>         batch_alignment                 = 0U;
+    Annotated<gr::Size_t, "perf_counter_interval", Doc<"sample hardware counters every N-th work call of each block (0: disabled)">>  perf_counter_interval           = 0U;
 
-    GR_MAKE_REFLECTABLE(SchedulerBase, timeout_ms, timeout_inactivity_count, process_stream_to_message_ratio);
+    GR_MAKE_REFLECTABLE(SchedulerBase, timeout_ms, timeout_inactivity_count, process_stream_to_message_ratio, fuse_linear_chains, chain_strip_size, min_batch_size, max_batch_latency_us, batch_alignment, perf_counter_interval);
 
     constexpr static block::Category blockCategory = block::Category::ScheduledBlockGroup;
 
@@ -63,7 +111,9 @@ public:
     explicit SchedulerBase(gr::Graph&&   graph,                                                                                                  //
         std::shared_ptr<BasicThreadPool> thread_pool       = std::make_shared<BasicThreadPool>("simple-scheduler-pool", thread_pool::CPU_BOUND), //
         const profiling::Options&        profiling_options = {})                                                                                        //
-        : _graph(std::move(graph)), _profiler{profiling_options}, _profilerHandler{_profiler.forThisThread()}, _pool(std::move(thread_pool)) {}
+        : _graph(std::move(graph)), _profiler{profiling_options}, _profilerHandler{_profiler.forThisThread()}, _pool(std::move(thread_pool)) {
+        this->propertyCallbacks[scheduler::property::kPerfCounters] = &SchedulerBase::propertyCallbackPerfCounters;
+    }
 
     ~SchedulerBase() {
         if (this->state() == lifecycle::RUNNING) {
@@ -199,14 +249,64 @@ public:
 
     [[nodiscard]] const JobLists& jobs() const noexcept { return _jobLists; }
 
+    /**
+     * @brief overrides the scheduler-wide batch policy ('min_batch_size', 'max_batch_latency', 'batch_alignment') for the
+     * block with the given unique name. Takes effect with the next (re-)start of the scheduler.
+     * N.B. a fused chain (see 'fuse_linear_chains') is gated by the input ports and the policy of its head block.
+     */
+    void setBatchPolicy(std::string_view blockUniqueName, BatchPolicy policy) { _batchPolicies.insert_or_assign(std::string(blockUniqueName), policy); }
+
+    /**
+     * @brief hardware counters (cycles, instructions, cache and branch misses, IPC) per scheduling unit, accumulated over
+     * every 'perf_counter_interval'-th work call. Counts cover only the sampled calls ('sampled_calls' of 'calls').
+     * While running, 'reset' is deferred to the worker owning the unit (counters are single-writer), i.e. increments between
+     * the returned snapshot and the worker's next call of the unit are discarded.
+     */
+    [[nodiscard]] property_map perfCounters(bool reset = false) {
+        const bool   isIdle = _nRunningJobs.load(std::memory_order_acquire) == 0UZ; // no worker is writing the counters
+        property_map result;
+        for (auto& [_, state] : _perfCounters) {
+            result[state.uniqueName] = state.counters.toPropertyMap();
+            if (reset && isIdle) {
+                state.counters.reset();
+                state.resetRequested.store(false, std::memory_order_relaxed);
+            } else if (reset) {
+                state.resetRequested.store(true, std::memory_order_release);
+            }
+        }
+        return result;
+    }
+
 protected:
-    forceinline work::Result traverseBlockListOnce(const std::vector<BlockModel*>& blocks) noexcept {
+    forceinline work::Result traverseBlockListOnce(const std::vector<BlockModel*>& blocks, auto& profilerHandler) noexcept {
         constexpr std::size_t requestedWorkAllBlocks = std::numeric_limits<std::size_t>::max();
         std::size_t           performedWorkAllBlocks = 0UZ;
         bool                  unfinishedBlocksExist  = false; // i.e. at least one block returned OK, INSUFFICIENT_INPUT_ITEMS, or INSUFFICIENT_OUTPU_ITEMS
         for (auto& currentBlock : blocks) {
-            const auto [requested_work, performed_work, status] = currentBlock->work(requestedWorkAllBlocks);
+            std::size_t requestedWork = requestedWorkAllBlocks;
+            BatchState* batch         = nullptr;
+            if (!_batchStates.empty()) {
+                if (auto it = _batchStates.find(currentBlock); it != _batchStates.end()) {
+                    batch = &it->second;
+                }
+            }
+            if (batch != nullptr && !batch->isDone && !admitBatch(*batch->inputBlock, *batch, requestedWork)) {
+                unfinishedBlocksExist = true; // deferred until enough samples accumulated or the latency bound expired
+                continue;
+            }
+
+            PerfCounterState* perf = nullptr;
+            if (!_perfCounters.empty()) {
+                if (auto it = _perfCounters.find(currentBlock); it != _perfCounters.end()) {
+                    perf = &it->second;
+                }
+            }
+
+            const auto [requested_work, performed_work, status] = perf == nullptr ? currentBlock->work(requestedWork) : workWithPerfCounters(*currentBlock, *perf, requestedWork, profilerHandler);
             performedWorkAllBlocks += performed_work;
+            if (batch != nullptr) {
+                batch->isDone = status == work::Status::DONE;
+            }
 
             if (status == work::Status::ERROR) {
                 return {requested_work, performedWorkAllBlocks, work::Status::ERROR};
@@ -220,12 +320,169 @@ protected:
         return {requestedWorkAllBlocks, performedWorkAllBlocks, unfinishedBlocksExist ? work::Status::OK : work::Status::DONE};
     }
 
+    work::Result workWithPerfCounters(BlockModel& block, PerfCounterState& state, std::size_t requestedWork, auto& profilerHandler) noexcept {
+        if (state.resetRequested.load(std::memory_order_relaxed) && state.resetRequested.exchange(false, std::memory_order_acq_rel)) [[unlikely]] {
+            state.counters.reset();
+        }
+        singleWriterAdd(state.counters.nCalls, 1U);
+        if (++state.nCallsSinceSample < state.interval) {
+            return block.work(requestedWork);
+        }
+        state.nCallsSinceSample = 0UZ;
+
+        const profiling::perf::ThreadCounters& counters = profiling::perf::ThreadCounters::forThisThread(); // N.B. per worker thread
+        if (!counters.isValid()) {
+            return block.work(requestedWork);
+        }
+        const profiling::perf::CounterValues before = counters.read();
+        const work::Result                   result = block.work(requestedWork);
+        const profiling::perf::CounterValues delta  = counters.read() - before;
+        state.counters.recordSample(delta);
+
+        const double ipc = delta.cycles > 0U ? static_cast<double>(delta.instructions) / static_cast<double>(delta.cycles) : 0.;
+        try {
+            profilerHandler.counterEvent(state.uniqueName, "perf", {{"ipc", ipc}, {"cache_misses", static_cast<double>(delta.cacheMisses)}});
+        } catch (...) { // N.B. trace events are best-effort (e.g. string interning may allocate) and must not fail the block's work
+        }
+        return result;
+    }
+
+    void updatePerfCounterStates() {
+        if (perf_counter_interval.value == 0U) {
+            _perfCounters.clear();
+            return;
+        }
+        decltype(_perfCounters) perfCounters; // N.B. re-built: drops the states of blocks no longer scheduled (stale 'BlockModel*' keys)
+        std::lock_guard         lock(_jobListsMutex);
+        for (const auto& jobList : *_jobLists) {
+            for (BlockModel* block : jobList) {
+                if (auto node = _perfCounters.extract(block); !node.empty()) { // keeps the counters accumulated in previous runs
+                    perfCounters.insert(std::move(node));
+                }
+                PerfCounterState& state = perfCounters[block];
+                if (state.uniqueName != block->uniqueName()) { // new block, possibly at the address of a removed one
+                    state.uniqueName = block->uniqueName();
+                    state.counters.reset();
+                }
+                state.interval = perf_counter_interval.value;
+            }
+        }
+        _perfCounters = std::move(perfCounters);
+    }
+
+    std::optional<Message> propertyCallbackPerfCounters([[maybe_unused]] std::string_view propertyName, Message message) {
+        using enum gr::message::Command;
+        assert(propertyName == scheduler::property::kPerfCounters);
+
+        if (message.cmd != Get && message.cmd != Set) {
+            throw gr::exception(fmt::format("scheduler {} property {} does not implement command {}, msg: {}", this->unique_name, propertyName, message.cmd, message));
+        }
+        message.data = perfCounters(message.cmd == Set); // N.B. 'Set' returns and resets the accumulated counters
+        return message;
+    }
+
+    /// minimum of 'projection(port)' over the connected synchronous input ports (max. of std::size_t if there are none)
+    [[nodiscard]] static std::size_t minOverConnectedInputs(BlockModel& block, auto projection) {
+        std::size_t minValue = std::numeric_limits<std::size_t>::max();
+        auto        update   = [&minValue, &projection](gr::DynamicPort& port) {
+            if (port.isSynchronous() && port.isConnected()) {
+                minValue = std::min(minValue, static_cast<std::size_t>(projection(port)));
+            }
+        };
+        for (auto& portOrCollection : block.dynamicInputPorts()) {
+            std::visit(meta::overloaded{[&update](gr::DynamicPort& port) { update(port); }, //
+                           [&update](std::vector<gr::DynamicPort>& ports) { std::ranges::for_each(ports, update); }},
+                portOrCollection);
+        }
+        return minValue;
+    }
+
+    [[nodiscard]] static std::size_t minAvailableInputSamples(BlockModel& block) {
+        return minOverConnectedInputs(block, [](gr::DynamicPort& port) { return port.available(); });
+    }
+
+    /// returns true if the (gated) block should be executed now and adapts 'requestedWork' to the batch alignment
+    [[nodiscard]] static bool admitBatch(BlockModel& block, BatchState& state, std::size_t& requestedWork) noexcept {
+        const std::size_t available = minAvailableInputSamples(block);
+        if (available < state.policy.minBatchSize) {
+            const auto now = std::chrono::steady_clock::now();
+            if (!state.isDeferred) {
+                state.isDeferred    = true;
+                state.deferredSince = now;
+                return false;
+            }
+            if (now - state.deferredSince < state.policy.maxLatency) {
+                return false;
+            }
+        } else if (state.policy.alignment > 1UZ && available >= state.policy.alignment && available != std::numeric_limits<std::size_t>::max()) {
+            requestedWork = available - available % state.policy.alignment;
+        }
+        state.isDeferred = false; // N.B. an expired deadline also lets the block see EOS/DONE of its upstream
+        return true;
+    }
+
+    void updateBatchStates() {
+        _batchStates.clear();
+        const BatchPolicy defaultPolicy{.minBatchSize = min_batch_size.value, .maxLatency = std::chrono::microseconds(max_batch_latency_us.value), .alignment = batch_alignment.value};
+        std::unordered_map<const BlockModel*, BlockModel*> chainHeads; // N.B. fused chains expose no ports of their own
+        for (const auto& chain : _fusedChains) {
+            chainHeads.emplace(chain.get(), chain->members().front());
+        }
+        std::lock_guard lock(_jobListsMutex);
+        for (const auto& jobList : *_jobLists) {
+            for (BlockModel* block : jobList) {
+                const auto  head       = chainHeads.find(block);
+                BlockModel* inputBlock = head != chainHeads.end() ? head->second : block;
+                const auto  it         = _batchPolicies.find(std::string(inputBlock->uniqueName()));
+                BatchPolicy policy     = it != _batchPolicies.end() ? it->second : defaultPolicy;
+                if (policy.minBatchSize > 1UZ) { // N.B. larger batches never fit into the input buffer, i.e. would be admitted only by the latency bound
+                    policy.minBatchSize = std::min(policy.minBatchSize, minOverConnectedInputs(*inputBlock, [](gr::DynamicPort& port) { return port.bufferSize(); }));
+                }
+                if (policy.minBatchSize > 1UZ && !block->isBlocking() && !inputBlock->dynamicInputPorts().empty()) {
+                    _batchStates.emplace(block, BatchState{.policy = policy, .inputBlock = inputBlock});
+                }
+            }
+        }
+    }
+
     void init() {
         [[maybe_unused]] const auto pe = _profilerHandler.startCompleteEvent("scheduler_base.init");
         base_t::processScheduledMessages(); // make sure initial subscriptions are processed
         connectBlockMessagePorts();
     }
 
+    /**
+     * @brief graph-optimisation pass (if 'fuse_linear_chains' is enabled): replaces the members of each linear chain in
+     * 'blockOrder' by a single FusedBlockChain scheduling unit (at the position of the first member encountered).
+     * N.B. to be called by the derived scheduler's init() before it distributes the blocks into job lists.
+     */
+    [[nodiscard]] std::vector<BlockModel*> fuseLinearChains(std::vector<BlockModel*> blockOrder) {
+        _fusedChains.clear();
+        if (!fuse_linear_chains.value) {
+            return blockOrder;
+        }
+
+        std::unordered_map<BlockModel*, gr::graph::FusedBlockChain*> chainOf;
+        for (auto& chain : gr::graph::findLinearChains(_graph)) {
+            auto& fused = _fusedChains.emplace_back(std::make_unique<gr::graph::FusedBlockChain>(std::move(chain), static_cast<std::size_t>(chain_strip_size.value)));
+            for (BlockModel* member : fused->members()) {
+                chainOf[member] = fused.get();
+            }
+        }
+
+        std::vector<BlockModel*>        result;
+        std::unordered_set<BlockModel*> scheduled;
+        for (BlockModel* block : blockOrder) {
+            auto it = chainOf.find(block);
+            if (it == chainOf.end()) {
+                result.push_back(block);
+            } else if (scheduled.insert(it->second).second) {
+                result.push_back(it->second);
+            }
+        }
+        return result;
+    }
+
     void reset() {
         _graph.forEachBlockMutable([this](auto& block) { this->emitErrorMessageIfAny("reset() -> LifecycleState", block.changeState(lifecycle::INITIALISED)); });
         _graph.disconnectAllEdges();
@@ -236,6 +493,21 @@ protected:
         if (!result) {
             this->emitErrorMessage("init()", "Failed to connect blocks in graph");
         }
+        if (!_fusedChains.empty()) {
+            for (auto& chain : _fusedChains) {
+                if (!chain->resizeInternalBuffers()) {
+                    this->emitErrorMessage("start()", fmt::format("Failed to resize the internal buffers of {}", chain->uniqueName()));
+                }
+            }
+            _graph.forEachEdgeMutable([](Edge& edge) {
+                if (edge._sourcePort != nullptr) {
+                    edge._actualBufferSize = edge._sourcePort->bufferSize();
+                }
+            });
+        }
+
+        updateBatchStates();
+        updatePerfCounterStates();
 
         std::lock_guard lock(_jobListsMutex);
         _graph.forEachBlockMutable([this](auto& block) { this->emitErrorMessageIfAny("LifecycleState -> RUNNING", block.changeState(lifecycle::RUNNING)); });
@@ -258,7 +530,7 @@ protected:
         _nRunningJobs.fetch_add(1UZ, std::memory_order_acq_rel);
         _nRunningJobs.notify_all();
 
-        [[maybe_unused]] auto& profiler_handler = _profiler.forThisThread();
+        auto& profiler_handler = _profiler.forThisThread();
 
         std::vector<BlockModel*> localBlockList;
         {
@@ -298,7 +570,7 @@ protected:
             }
 
             if (activeState == lifecycle::State::RUNNING) {
-                gr::work::Result result = traverseBlockListOnce(localBlockList);
+                gr::work::Result result = traverseBlockListOnce(localBlockList, profiler_handler);
                 if (result.status == work::Status::DONE) {
                     break; // nothing happened -> shutdown this worker
                 } else if (result.status == work::Status::ERROR) {
@@ -386,22 +658,28 @@ private:
         base_t::init();
         [[maybe_unused]] const auto pe = this->_profilerHandler.startCompleteEvent("scheduler_simple.init");
 
+        std::vector<BlockModel*> blockList;
+        blockList.reserve(this->_graph.blocks().size());
+        std::ranges::transform(this->_graph.blocks(), std::back_inserter(blockList), [](auto& block) { return block.get(); });
+        blockList = this->fuseLinearChains(std::move(blockList));
+
         // generate job list
         std::size_t n_batches = 1UZ;
         switch (base_t::executionPolicy()) {
         case ExecutionPolicy::singleThreaded:
         case ExecutionPolicy::singleThreadedBlocking: break;
-        case ExecutionPolicy::multiThreaded: n_batches = std::min(static_cast<std::size_t>(this->_pool->maxThreads()), this->_graph.blocks().size()); break;
+        case ExecutionPolicy::multiThreaded: n_batches = std::min(static_cast<std::size_t>(this->_pool->maxThreads()), blockList.size()); break;
         }
 
         std::lock_guard lock(base_t::_jobListsMutex);
+        this->_jobLists->clear(); // N.B. may be re-initialised after a stop
         this->_jobLists->reserve(n_batches);
         for (std::size_t i = 0; i < n_batches; i++) {
             // create job-set for thread
             auto& job = this->_jobLists->emplace_back(std::vector<BlockModel*>());
-            job.reserve(this->_graph.blocks().size() / n_batches + 1);
-            for (std::size_t j = i; j < this->_graph.blocks().size(); j += n_batches) {
-                job.push_back(this->_graph.blocks()[j].get());
+            job.reserve(blockList.size() / n_batches + 1);
+            for (std::size_t j = i; j < blockList.size(); j += n_batches) {
+                job.push_back(blockList[j]);
             }
         }
     }
@@ -432,6 +710,7 @@ private:
         std::vector<block_t>                    _source_blocks{};
         // compute the adjacency list
         std::set<block_t> block_reached;
+        _blocklist.clear(); // N.B. may be re-initialised after a stop
         for (auto& e : this->_graph.edges()) {
             _adjacency_list[e._sourceBlock].push_back(e._destinationBlock);
             _source_blocks.push_back(e._sourceBlock);
@@ -464,6 +743,8 @@ private:
             }
         }
 
+        _blocklist = this->fuseLinearChains(std::move(_blocklist));
+
         // generate job list
         std::size_t n_batches = 1UZ;
         switch (base_t::executionPolicy()) {
@@ -473,6 +754,7 @@ private:
         }
 
         std::lock_guard lock(base_t::_jobListsMutex);
+        this->_jobLists->clear(); // N.B. may be re-initialised after a stop
         this->_jobLists->reserve(n_batches);
         for (std::size_t i = 0; i < n_batches; i++) {
             // create job-set for thread
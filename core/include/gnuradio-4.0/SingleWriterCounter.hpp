@@ -0,0 +1,20 @@
+#ifndef GNURADIO_SINGLE_WRITER_COUNTER_HPP
+#define GNURADIO_SINGLE_WRITER_COUNTER_HPP
+
+#include <atomic>
+#include <cstdint>
+
+namespace gr {
+
+/**
+ * @brief statistics counter that is written by a single thread only (e.g. the one executing a block) -- the relaxed
+ * atomic solely permits concurrent reads (e.g. from message handlers), @see singleWriterAdd(..)
+ */
+using SingleWriterCounter = std::atomic<std::uint64_t>;
+
+/// plain relaxed load and store instead of a locked read-modify-write ('fetch_add'): only valid for a single writer
+inline void singleWriterAdd(SingleWriterCounter& counter, std::uint64_t value) noexcept { counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed); }
+
+} // namespace gr
+
+#endif // GNURADIO_SINGLE_WRITER_COUNTER_HPP
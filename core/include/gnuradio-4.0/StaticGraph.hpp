@@ -0,0 +1,262 @@
+#ifndef GNURADIO_STATIC_GRAPH_HPP
+#define GNURADIO_STATIC_GRAPH_HPP
+
+#include <gnuradio-4.0/Block.hpp>
+#include <gnuradio-4.0/Sequence.hpp>
+#include <gnuradio-4.0/thread/thread_pool.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <expected>
+#include <limits>
+#include <memory>
+#include <span>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+namespace gr {
+
+/**
+ * @brief compile-time edge of a 'StaticGraph': connects the output port 'sourcePortName' of the block at index 'sourceBlockIndex'
+ * to the input port 'destinationPortName' of the block at index 'destinationBlockIndex'.
+ */
+template<std::size_t sourceBlockIndex, fixed_string sourcePortName, std::size_t destinationBlockIndex, fixed_string destinationPortName, std::size_t minBufferSize = 65536UZ>
+struct StaticEdge {
+    static constexpr std::size_t  kSourceBlock      = sourceBlockIndex;
+    static constexpr fixed_string kSourcePort       = sourcePortName;
+    static constexpr std::size_t  kDestinationBlock = destinationBlockIndex;
+    static constexpr fixed_string kDestinationPort  = destinationPortName;
+    static constexpr std::size_t  kMinBufferSize    = minBufferSize;
+};
+
+template<typename... TBlocks>
+struct StaticBlocks {};
+
+template<typename... TEdges>
+struct StaticEdges {};
+
+template<typename TBlockList, typename TEdgeList>
+class StaticGraph;
+
+/**
+ * @brief fixed graph of (non type-erased) blocks with a compile-time edge list, for small graphs that are fully known at
+ * compile-time and whose per-'work(..)' overhead matters (i.e. small chunk sizes).
+ *
+ * Compared to a 'gr::Graph' executed by a 'gr::scheduler::*', the run-time gain is limited to devirtualisation:
+ *  - blocks are stored by value in a std::tuple (no 'BlockModel'/'BlockWrapper' indirection), 'work(..)' calls each
+ *    'Block<..>::work(..)' directly so that the scheduling loop is unrolled and can be inlined by the compiler,
+ *  - nothing else is hoisted: each 'Block<..>::work(..)' call evaluates its port min/max, chunk-size, tag and EOS limits
+ *    exactly as it does within a 'gr::Graph', and the edge buffers are sized once when connecting (as in 'gr::Graph'),
+ *  - the edges are resolved (port indices, type checks) at compile-time, which catches wiring errors early but does not
+ *    affect the per-call cost,
+ *  - there is no topology/message-driven reconfiguration: blocks and edges are fixed for the lifetime of the graph.
+ * The saving is thus a fixed per-block-call overhead that only matters for small chunk sizes (see 'bm_Scheduler').
+ *
+ * Blocks are executed in the order of their declaration, which should follow the data-flow (sources first).
+ * Blocks are constructed in-place from their initial parameters (the StaticGraph is neither copyable nor movable).
+ *
+ * Example:
+ * @code
+ * using namespace gr::testing;
+ * gr::StaticGraph<gr::StaticBlocks<CountingSource<float>, Copy<float>, CountingSink<float>>, //
+ *     gr::StaticEdges<gr::StaticEdge<0, "out", 1, "in">, gr::StaticEdge<1, "out", 2, "in">>> graph({{{{"n_samples_max", 1024U}}, {}, {}}});
+ * std::ignore = graph.runAndWait();
+ * @endcode
+ */
+template<typename... TBlocks, typename... TEdges>
+class StaticGraph<StaticBlocks<TBlocks...>, StaticEdges<TEdges...>> {
+    static constexpr std::size_t kNBlocks = sizeof...(TBlocks);
+    static_assert(kNBlocks > 0UZ, "StaticGraph requires at least one block");
+
+    template<std::size_t I>
+    using block_type = std::tuple_element_t<I, std::tuple<TBlocks...>>;
+
+    template<typename TEdge>
+    static consteval bool isValidEdge() {
+        static_assert(TEdge::kSourceBlock < kNBlocks && TEdge::kDestinationBlock < kNBlocks, "StaticEdge block index out of range");
+        using TSource      = block_type<TEdge::kSourceBlock>;
+        using TDestination = block_type<TEdge::kDestinationBlock>;
+        static_assert(meta::indexForName<TEdge::kSourcePort, traits::block::all_output_ports<TSource>>() != meta::invalid_index, "There is no output port with the specified name in the source block");
+        static_assert(meta::indexForName<TEdge::kDestinationPort, traits::block::all_input_ports<TDestination>>() != meta::invalid_index, "There is no input port with the specified name in the destination block");
+        using TSourcePort      = std::remove_cvref_t<decltype(outputPort<TEdge::kSourcePort>(static_cast<TSource*>(nullptr)))>;
+        using TDestinationPort = std::remove_cvref_t<decltype(inputPort<TEdge::kDestinationPort>(static_cast<TDestination*>(nullptr)))>;
+        static_assert(std::is_same_v<typename TSourcePort::value_type, typename TDestinationPort::value_type>, "The source port type needs to match the sink port type");
+        return true;
+    }
+    static_assert((isValidEdge<TEdges>() && ...));
+
+    std::shared_ptr<gr::Sequence>                     _progress     = std::make_shared<gr::Sequence>();
+    std::shared_ptr<gr::thread_pool::BasicThreadPool> _ioThreadPool = gr::thread_pool::defaultIoThreadPool(); // N.B. shared, graphs are meant to be small and numerous
+    std::tuple<TBlocks...>                            _blocks;
+    std::array<std::size_t, sizeof...(TEdges)>        _bufferSizes{};
+
+    template<std::size_t... Is>
+    StaticGraph(std::index_sequence<Is...>, std::array<property_map, kNBlocks>&& initParameters) : _blocks(std::move(initParameters[Is])...) {
+        forEachBlock([this](auto& block) { block.init(_progress, _ioThreadPool); });
+        if (!connectEdges()) {
+            throw gr::exception("StaticGraph: failed to connect edges");
+        }
+    }
+
+    template<typename TEdge>
+    ConnectionResult connectEdge(std::size_t& bufferSize) {
+        auto& sourcePort      = outputPort<TEdge::kSourcePort>(&std::get<TEdge::kSourceBlock>(_blocks));
+        auto& destinationPort = inputPort<TEdge::kDestinationPort>(&std::get<TEdge::kDestinationBlock>(_blocks));
+        std::ignore           = destinationPort.disconnect();
+        if (bufferSize == 0UZ) { // N.B. computed once, re-used when re-connecting
+            bufferSize = std::max({TEdge::kMinBufferSize, sourcePort.min_buffer_size(), destinationPort.min_buffer_size()});
+        }
+        if (sourcePort.resizeBuffer(bufferSize) != ConnectionResult::SUCCESS) {
+            return ConnectionResult::FAILED;
+        }
+        return sourcePort.connect(destinationPort);
+    }
+
+    [[nodiscard]] bool connectEdges() {
+        return [this]<std::size_t... Is>(std::index_sequence<Is...>) { return ((connectEdge<TEdges>(_bufferSizes[Is]) == ConnectionResult::SUCCESS) && ...); }(std::index_sequence_for<TEdges...>());
+    }
+
+    template<std::size_t I>
+    forceinline bool workBlock(std::size_t requestedWork, work::Result& result, bool& unfinishedBlocksExist) noexcept {
+        const auto [_, performedWork, status] = std::get<I>(_blocks).work(requestedWork);
+        result.performed_work += performedWork;
+        if (status == work::Status::ERROR) {
+            result.status = work::Status::ERROR;
+            return false;
+        }
+        unfinishedBlocksExist = unfinishedBlocksExist || status != work::Status::DONE;
+        return true;
+    }
+
+public:
+    std::size_t timeout_ms                      = 10UZ; // sleep timeout to wait if graph has made no progress
+    std::size_t timeout_inactivity_count        = 20UZ; // number of inactive cycles w/o progress before sleep is triggered
+    std::size_t process_stream_to_message_ratio = 16UZ; // number of stream to msg processing
+
+    explicit StaticGraph(std::array<property_map, kNBlocks> initParameters = {}) : StaticGraph(std::make_index_sequence<kNBlocks>(), std::move(initParameters)) {}
+
+    StaticGraph(const StaticGraph&)            = delete;
+    StaticGraph(StaticGraph&&)                 = delete; // N.B. blocks keep references to themselves (settings, ports)
+    StaticGraph& operator=(const StaticGraph&) = delete;
+    StaticGraph& operator=(StaticGraph&&)      = delete;
+
+    ~StaticGraph() { stop(); }
+
+    [[nodiscard]] static constexpr std::size_t size() noexcept { return kNBlocks; }
+
+    template<std::size_t I>
+    [[nodiscard]] constexpr block_type<I>& block() noexcept {
+        return std::get<I>(_blocks);
+    }
+
+    template<std::size_t I>
+    [[nodiscard]] constexpr const block_type<I>& block() const noexcept {
+        return std::get<I>(_blocks);
+    }
+
+    [[nodiscard]] constexpr std::span<const std::size_t> bufferSizes() const noexcept { return _bufferSizes; }
+
+    [[nodiscard]] const Sequence& progress() const noexcept { return *_progress; }
+
+    template<typename F>
+    constexpr void forEachBlock(F&& f) {
+        std::apply([&f](auto&... block) { (f(block), ...); }, _blocks);
+    }
+
+    void processScheduledMessages() {
+        forEachBlock([](auto& block) { block.processScheduledMessages(); });
+    }
+
+    /**
+     * @brief (re-)connects the edges and transitions all blocks to RUNNING. Blocks that were stopped by a previous run are
+     * reset (STOPPED -> INITIALISED) first, samples remaining in the edge buffers are dropped.
+     */
+    std::expected<void, Error> start() {
+        std::expected<void, Error> result{};
+        auto                       setResult = [&result](std::expected<void, Error>&& e) {
+            if (!e && result) {
+                result = std::move(e);
+            }
+        };
+        bool needsReconnect = false;
+        forEachBlock([&](auto& block) {
+            if (block.state() == lifecycle::State::STOPPED || block.state() == lifecycle::State::ERROR) {
+                setResult(block.changeStateTo(lifecycle::State::INITIALISED));
+                needsReconnect = true;
+            }
+        });
+        if (needsReconnect && !connectEdges()) {
+            return std::unexpected(Error("StaticGraph: failed to connect edges"));
+        }
+        forEachBlock([&](auto& block) {
+            if (block.state() != lifecycle::State::RUNNING) {
+                setResult(block.changeStateTo(lifecycle::State::RUNNING));
+            }
+        });
+        return result;
+    }
+
+    void stop() {
+        forEachBlock([](auto& block) {
+            if (lifecycle::isActive(block.state())) {
+                std::ignore = block.changeStateTo(lifecycle::State::REQUESTED_STOP);
+            }
+            if (block.state() == lifecycle::State::REQUESTED_STOP && !block.isBlocking()) {
+                std::ignore = block.changeStateTo(lifecycle::State::STOPPED);
+            }
+        });
+    }
+
+    /**
+     * @brief executes each block once (in declaration order) and returns the accumulated work. The returned status is
+     * DONE if all blocks are done, ERROR if any block reported an error (remaining blocks are skipped), and OK otherwise.
+     */
+    [[nodiscard]] forceinline work::Result work(std::size_t requestedWork = std::numeric_limits<std::size_t>::max()) noexcept {
+        work::Result result{requestedWork, 0UZ, work::Status::OK};
+        bool         unfinishedBlocksExist = false;
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) { std::ignore = (workBlock<Is>(requestedWork, result, unfinishedBlocksExist) && ...); }(std::make_index_sequence<kNBlocks>());
+        if (result.status != work::Status::ERROR && !unfinishedBlocksExist) {
+            result.status = work::Status::DONE;
+        }
+        return result;
+    }
+
+    /**
+     * @brief starts the graph and calls 'work(requestedWork)' until all blocks are done (or any block reported an error).
+     */
+    std::expected<void, Error> runAndWait(std::size_t requestedWork = std::numeric_limits<std::size_t>::max()) {
+        processScheduledMessages();
+        if (auto e = start(); !e) {
+            return e;
+        }
+
+        std::size_t  msgToCount         = 0UZ;
+        std::size_t  inactiveCycleCount = 0UZ;
+        work::Result result{};
+        do {
+            if (msgToCount++ % std::max(process_stream_to_message_ratio, 1UZ) == 0UZ) {
+                processScheduledMessages();
+            }
+            result             = work(requestedWork);
+            inactiveCycleCount = result.performed_work == 0UZ ? inactiveCycleCount + 1UZ : 0UZ;
+            if (inactiveCycleCount > timeout_inactivity_count) { // e.g. waiting for blocking I/O blocks
+                std::this_thread::sleep_for(std::chrono::milliseconds(timeout_ms));
+                inactiveCycleCount = 0UZ;
+            }
+        } while (result.status == work::Status::OK);
+
+        stop();
+        processScheduledMessages();
+        if (result.status == work::Status::ERROR) {
+            return std::unexpected(Error("StaticGraph: block reported an error"));
+        }
+        return {};
+    }
+};
+
+} // namespace gr
+
+#endif // GNURADIO_STATIC_GRAPH_HPP
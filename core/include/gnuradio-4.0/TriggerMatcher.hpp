@@ -1,6 +1,15 @@
 #ifndef GNURADIO_TRIGGERMATCHER_HPP
 #define GNURADIO_TRIGGERMATCHER_HPP
 
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
 #include "gnuradio-4.0/Message.hpp"
 #include "gnuradio-4.0/Tag.hpp"
 #include "gnuradio-4.0/meta/formatter.hpp"
@@ -211,66 +220,107 @@ inline void verifyFilterState(std::string_view matchCriteria, property_map& stat
     state[key::kIsSingleTrigger] = bool(std::get<bool>(state.at(key::kStartDefined)) xor std::get<bool>(state.at(key::kStopDefined)));
 }
 
-[[nodiscard]] inline trigger::MatchResult filter(std::string_view filterDefinition, const Tag& tag, property_map& filterState) {
-    using namespace gr::trigger::detail;
-    verifyFilterState(filterDefinition, filterState); // N.B. automatically generates config and state variables if needed
-
-    const auto startDefined = std::get<bool>(filterState[key::kStartDefined]);
-    const auto stopDefined  = std::get<bool>(filterState[key::kStopDefined]);
-    if ((!startDefined && !stopDefined) || tag.map.empty()) {
-        return trigger::MatchResult::Ignore;
+/**
+ * @brief parsed (i.e. compiled) start/stop trigger name and context criteria of a filter definition.
+ *
+ * Views into either the (cached) property_map filter state or the strings owned by a CompiledFilter.
+ */
+struct FilterView {
+    bool             startDefined = false;
+    bool             stopDefined  = false;
+    std::string_view startTriggerName;
+    std::string_view startCtx;
+    std::string_view stopTriggerName;
+    std::string_view stopCtx;
+    bool             startTriggerNameEnds = false;
+    bool             startCtxEnds         = false;
+    bool             stopTriggerNameEnds  = false;
+    bool             stopCtxEnds          = false;
+
+    [[nodiscard]] constexpr bool isSingleTrigger() const noexcept { return startDefined xor stopDefined; }
+
+    [[nodiscard]] static FilterView fromState(const property_map& state) {
+        return {.startDefined = std::get<bool>(state.at(key::kStartDefined)), .stopDefined = std::get<bool>(state.at(key::kStopDefined)),                                                         //
+            .startTriggerName = std::get<std::string>(state.at(key::kStartTriggerName)), .startCtx = std::get<std::string>(state.at(key::kStartCtx)),                                             //
+            .stopTriggerName = std::get<std::string>(state.at(key::kStopTriggerName)), .stopCtx = std::get<std::string>(state.at(key::kStopCtx)),                                                 //
+            .startTriggerNameEnds = std::get<bool>(state.at(key::kStartTriggerNameEnds)), .startCtxEnds = std::get<bool>(state.at(key::kStartCtxEnds)),                                           //
+            .stopTriggerNameEnds = std::get<bool>(state.at(key::kStopTriggerNameEnds)), .stopCtxEnds = std::get<bool>(state.at(key::kStopCtxEnds))};
     }
-    const auto triggerActive    = std::get<bool>(filterState[key::kTriggerActive]);
-    const auto startTriggerName = std::get<std::string>(filterState[key::kStartTriggerName]);
-    const auto startCtx         = std::get<std::string>(filterState[key::kStartCtx]);
-    const auto stopTriggerName  = std::get<std::string>(filterState[key::kStopTriggerName]);
-    const auto stopCtx          = std::get<std::string>(filterState[key::kStopCtx]);
-    /// fmt::println("filter {} -> '{}'/'{}' & '{}'/'{}'\nfilter state: {}", filterDefinition, startTriggerName, startCtx, stopTriggerName, stopCtx, filterState);
-
-    std::string triggerName;
-    std::string triggerCtx;
-    if (tag.map.contains(tag::TRIGGER_NAME.shortKey())) {
-        triggerName = std::get<std::string>(tag.map.at(tag::TRIGGER_NAME.shortKey()));
+};
+
+/**
+ * @brief mutable per-filter matching state (equivalent of the 'triggerActive' and 'waitingFor...NonMatch' property_map entries).
+ */
+struct FilterState {
+    bool triggerActive           = false;
+    bool waitingForStartNonMatch = false;
+    bool waitingForStopNonMatch  = false;
+
+    constexpr void reset() noexcept { *this = FilterState{}; }
+
+    [[nodiscard]] constexpr bool waitingForNonMatch() const noexcept { return waitingForStartNonMatch || waitingForStopNonMatch; }
+};
+
+/**
+ * @brief extracts the trigger name and context of a tag (empty if not present) without copying them.
+ */
+[[nodiscard]] inline std::pair<std::string_view, std::string_view> triggerNameAndCtx(const Tag& tag) {
+    std::string_view triggerName;
+    std::string_view triggerCtx;
+    if (auto it = tag.map.find(tag::TRIGGER_NAME.shortKey()); it != tag.map.end()) {
+        triggerName = std::get<std::string>(it->second);
     }
-    if (tag.map.contains(tag::TRIGGER_META_INFO.shortKey())) {
-        if (auto meta = std::get_if<property_map>(&tag.map.at(tag::TRIGGER_META_INFO.shortKey())); meta && meta->contains(tag::CONTEXT.shortKey())) {
-            triggerCtx = std::get<std::string>(meta->at(tag::CONTEXT.shortKey()));
+    if (auto it = tag.map.find(tag::TRIGGER_META_INFO.shortKey()); it != tag.map.end()) {
+        if (auto meta = std::get_if<property_map>(&it->second); meta) {
+            if (auto ctxIt = meta->find(tag::CONTEXT.shortKey()); ctxIt != meta->end()) {
+                triggerCtx = std::get<std::string>(ctxIt->second);
+            }
         }
     }
+    return {triggerName, triggerCtx};
+}
+
+/**
+ * @brief core matching logic shared by the property_map based 'filter(...)' and the pre-compiled 'MatcherSet'.
+ */
+[[nodiscard]] inline trigger::MatchResult match(const FilterView& config, std::string_view triggerName, std::string_view triggerCtx, FilterState& state) noexcept {
+    if (!config.startDefined && !config.stopDefined) {
+        return MatchResult::Ignore;
+    }
 
-    if (isSingleTrigger(filterState)) {
-        bool triggerMatch = startTriggerName.empty() || triggerName == startTriggerName;
-        bool contextMatch = startCtx.empty() || startCtx.contains(triggerCtx);
+    if (config.isSingleTrigger()) {
+        const bool triggerMatch = config.startTriggerName.empty() || triggerName == config.startTriggerName;
+        const bool contextMatch = config.startCtx.empty() || config.startCtx.contains(triggerCtx);
         if (triggerMatch && contextMatch) {
-            filterState[key::kWaitingForStartNonMatch] = std::get<bool>(filterState[key::kStartTriggerNameEnds]) || std::get<bool>(filterState[key::kStartCtxEnds]);
+            state.waitingForStartNonMatch = config.startTriggerNameEnds || config.startCtxEnds;
             return MatchResult::Matching;
         }
     }
 
-    if (startDefined && stopDefined) {
-        if (!triggerActive || std::get<bool>(filterState[key::kWaitingForStartNonMatch])) {
-            const bool triggerMatch = startTriggerName.empty() || triggerName == startTriggerName;
-            const bool contextMatch = startCtx.empty() || triggerCtx.contains(startCtx);
+    if (config.startDefined && config.stopDefined) {
+        if (!state.triggerActive || state.waitingForStartNonMatch) {
+            const bool triggerMatch = config.startTriggerName.empty() || triggerName == config.startTriggerName;
+            const bool contextMatch = config.startCtx.empty() || triggerCtx.contains(config.startCtx);
 
             if (triggerMatch && contextMatch) {
-                filterState[key::kTriggerActive]           = true;
-                filterState[key::kWaitingForStartNonMatch] = std::get<bool>(filterState[key::kStartTriggerNameEnds]) || std::get<bool>(filterState[key::kStartCtxEnds]);
-                return std::get<bool>(filterState[key::kWaitingForStartNonMatch]) ? MatchResult::Ignore : MatchResult::Matching;
-            } else if (std::get<bool>(filterState[key::kWaitingForStartNonMatch])) {
-                filterState[key::kWaitingForStartNonMatch] = false;
+                state.triggerActive           = true;
+                state.waitingForStartNonMatch = config.startTriggerNameEnds || config.startCtxEnds;
+                return state.waitingForStartNonMatch ? MatchResult::Ignore : MatchResult::Matching;
+            } else if (state.waitingForStartNonMatch) {
+                state.waitingForStartNonMatch = false;
                 return MatchResult::Matching;
             }
         } else {
-            const bool triggerMatch = stopTriggerName.empty() || triggerName == stopTriggerName;
-            const bool contextMatch = stopCtx.empty() || triggerCtx.contains(stopCtx);
+            const bool triggerMatch = config.stopTriggerName.empty() || triggerName == config.stopTriggerName;
+            const bool contextMatch = config.stopCtx.empty() || triggerCtx.contains(config.stopCtx);
 
-            if ((triggerMatch && contextMatch) || std::get<bool>(filterState[key::kWaitingForStopNonMatch])) {
-                filterState[key::kWaitingForStopNonMatch] = std::get<bool>(filterState[key::kStopTriggerNameEnds]) || std::get<bool>(filterState[key::kStopCtxEnds]);
-                if (!std::get<bool>(filterState[key::kWaitingForStopNonMatch])) {
-                    reset(filterState);
+            if ((triggerMatch && contextMatch) || state.waitingForStopNonMatch) {
+                state.waitingForStopNonMatch = config.stopTriggerNameEnds || config.stopCtxEnds;
+                if (!state.waitingForStopNonMatch) {
+                    state.reset();
                     return MatchResult::NotMatching;
                 } else if (!triggerMatch || !contextMatch) {
-                    reset(filterState);
+                    state.reset();
                     return MatchResult::NotMatching;
                 }
                 return MatchResult::Ignore;
@@ -281,6 +331,24 @@ inline void verifyFilterState(std::string_view matchCriteria, property_map& stat
     return trigger::MatchResult::Ignore;
 }
 
+[[nodiscard]] inline trigger::MatchResult filter(std::string_view filterDefinition, const Tag& tag, property_map& filterState) {
+    verifyFilterState(filterDefinition, filterState); // N.B. automatically generates config and state variables if needed
+
+    const FilterView config = FilterView::fromState(filterState);
+    if ((!config.startDefined && !config.stopDefined) || tag.map.empty()) {
+        return trigger::MatchResult::Ignore;
+    }
+
+    FilterState state{.triggerActive = std::get<bool>(filterState[key::kTriggerActive]), .waitingForStartNonMatch = std::get<bool>(filterState[key::kWaitingForStartNonMatch]), .waitingForStopNonMatch = std::get<bool>(filterState[key::kWaitingForStopNonMatch])};
+    const auto [triggerName, triggerCtx] = triggerNameAndCtx(tag);
+    const trigger::MatchResult result    = match(config, triggerName, triggerCtx, state);
+
+    filterState[key::kTriggerActive]           = state.triggerActive;
+    filterState[key::kWaitingForStartNonMatch] = state.waitingForStartNonMatch;
+    filterState[key::kWaitingForStopNonMatch]  = state.waitingForStopNonMatch;
+    return result;
+}
+
 static_assert(Matcher<decltype(&filter)>);
 
 struct Filter {
@@ -289,6 +357,175 @@ struct Filter {
 
 static_assert(Matcher<Filter>);
 
+/**
+ * @brief filter definition parsed once (same syntax and semantic as 'filter(...)') owning its trigger name and context strings.
+ */
+struct CompiledFilter {
+    std::string definition;
+    std::string startTriggerName;
+    std::string startCtx;
+    std::string stopTriggerName;
+    std::string stopCtx;
+    FilterView  flags; // start/stop defined and '^' modifiers, N.B. string views are set by view()
+
+    [[nodiscard]] static CompiledFilter compile(std::string_view filterDefinition) {
+        property_map state;
+        verifyFilterState(filterDefinition, state);
+        const FilterView parsed = FilterView::fromState(state);
+
+        CompiledFilter result;
+        result.definition       = filterDefinition;
+        result.startTriggerName = parsed.startTriggerName;
+        result.startCtx         = parsed.startCtx;
+        result.stopTriggerName  = parsed.stopTriggerName;
+        result.stopCtx          = parsed.stopCtx;
+        result.flags            = parsed;
+        result.flags.startTriggerName = result.flags.startCtx = result.flags.stopTriggerName = result.flags.stopCtx = {}; // would dangle -> see view()
+        return result;
+    }
+
+    [[nodiscard]] FilterView view() const noexcept {
+        FilterView result       = flags;
+        result.startTriggerName = startTriggerName;
+        result.startCtx         = startCtx;
+        result.stopTriggerName  = stopTriggerName;
+        result.stopCtx          = stopCtx;
+        return result;
+    }
+
+    [[nodiscard]] bool isSingleTrigger() const noexcept { return flags.isSingleTrigger(); }
+};
+
+/**
+ * @brief evaluates many (pre-compiled) filter definitions against the same tag in a single pass.
+ *
+ * The filter strings are parsed once at construction. Per tag, the trigger name and context are extracted once and only the
+ * filters that can possibly react to it are evaluated, i.e. those referring to the (interned) trigger name via a hash look-up,
+ * those with a wildcard (empty) trigger name, and those waiting for a non-matching tag ('^' modifier). All other filters are
+ * guaranteed to return 'MatchResult::Ignore' and are skipped.
+ *
+ * @code
+ * trigger::BasicTriggerNameCtxMatcher::MatcherSet matchers({"[CMD_BP_START/FAIR.SELECTOR.C=1, CMD_BP_STOP/FAIR.SELECTOR.C=1]", "[CMD_BP_START/FAIR.SELECTOR.C=2, CMD_BP_STOP/FAIR.SELECTOR.C=2]"});
+ * std::vector<trigger::MatchResult> results(matchers.size());
+ * matchers.match(tag, results); // results[i] equals 'filter(definition[i], tag, state[i])'
+ * @endcode
+ */
+class MatcherSet {
+    struct StringHash {
+        using is_transparent = void;
+        [[nodiscard]] std::size_t operator()(std::string_view str) const noexcept { return std::hash<std::string_view>{}(str); }
+    };
+
+    std::vector<CompiledFilter>                                                              _filters;
+    std::vector<FilterState>                                                                 _states;
+    std::unordered_map<std::string, std::vector<std::size_t>, StringHash, std::equal_to<>> _byTriggerName; // interned start/stop trigger names -> filter indices
+    std::vector<std::size_t>                                                                 _wildcards;     // filters with an empty start/stop trigger name -> always evaluated
+    std::vector<std::size_t>                                                                 _waiting;       // filters waiting for a non-matching tag -> always evaluated
+    std::vector<std::size_t>                                                                 _evaluated;     // scratch buffer
+    std::vector<std::size_t>                                                                 _lastEvaluated; // tag counter of the last evaluation, per filter
+    std::size_t                                                                              _tagCount = 0UZ;
+
+    void addIndex(std::string_view triggerName, std::size_t index) {
+        if (triggerName.empty()) {
+            if (_wildcards.empty() || _wildcards.back() != index) {
+                _wildcards.push_back(index);
+            }
+            return;
+        }
+        auto it = _byTriggerName.find(triggerName);
+        if (it == _byTriggerName.end()) {
+            it = _byTriggerName.emplace(std::string(triggerName), std::vector<std::size_t>{}).first;
+        }
+        if (it->second.empty() || it->second.back() != index) {
+            it->second.push_back(index);
+        }
+    }
+
+public:
+    MatcherSet() = default;
+
+    explicit MatcherSet(std::span<const std::string> filterDefinitions) {
+        _filters.reserve(filterDefinitions.size());
+        for (const auto& definition : filterDefinitions) {
+            _filters.push_back(CompiledFilter::compile(definition));
+        }
+        _states.resize(_filters.size());
+        _lastEvaluated.resize(_filters.size(), std::numeric_limits<std::size_t>::max());
+        _evaluated.reserve(_filters.size());
+        _waiting.reserve(_filters.size());
+
+        for (std::size_t i = 0UZ; i < _filters.size(); i++) {
+            const FilterView config = _filters[i].view();
+            if (config.startDefined) {
+                addIndex(config.startTriggerName, i);
+            }
+            if (config.stopDefined) {
+                addIndex(config.stopTriggerName, i);
+            }
+        }
+    }
+
+    explicit MatcherSet(std::initializer_list<std::string> filterDefinitions) : MatcherSet(std::span<const std::string>(filterDefinitions.begin(), filterDefinitions.size())) {}
+
+    [[nodiscard]] std::size_t           size() const noexcept { return _filters.size(); }
+    [[nodiscard]] const CompiledFilter& filter(std::size_t index) const { return _filters.at(index); }
+    [[nodiscard]] const FilterState&    state(std::size_t index) const { return _states.at(index); }
+
+    void reset() noexcept {
+        std::ranges::for_each(_states, [](FilterState& state) { state.reset(); });
+        _waiting.clear();
+    }
+
+    /**
+     * @brief invokes 'fnc(index)' once for each filter whose start or stop criteria can match 'triggerName' (incl. wildcards).
+     *
+     * N.B. filters waiting for a non-matching tag ('^' modifier) are not included, they are tracked by 'match(...)'.
+     */
+    template<std::invocable<std::size_t> Fnc>
+    void forEachCandidate(std::string_view triggerName, Fnc&& fnc) {
+        _tagCount++;
+        auto visit = [this, &fnc](std::size_t i) {
+            if (_lastEvaluated[i] != _tagCount) {
+                _lastEvaluated[i] = _tagCount;
+                fnc(i);
+            }
+        };
+        if (auto it = _byTriggerName.find(triggerName); it != _byTriggerName.end()) {
+            std::ranges::for_each(it->second, visit);
+        }
+        std::ranges::for_each(_wildcards, visit);
+    }
+
+    /**
+     * @brief evaluates all filters against 'tag', results[i] corresponds to the i-th filter definition.
+     */
+    void match(const Tag& tag, std::span<MatchResult> results) {
+        assert(results.size() >= _filters.size());
+        std::ranges::fill(results, MatchResult::Ignore);
+        if (tag.map.empty()) {
+            return;
+        }
+
+        const auto [triggerName, triggerCtx] = triggerNameAndCtx(tag);
+        _evaluated.clear();
+        forEachCandidate(triggerName, [&](std::size_t i) {
+            results[i] = BasicTriggerNameCtxMatcher::match(_filters[i].view(), triggerName, triggerCtx, _states[i]);
+            _evaluated.push_back(i);
+        });
+        for (const std::size_t i : _waiting) {
+            if (_lastEvaluated[i] != _tagCount) {
+                _lastEvaluated[i] = _tagCount;
+                results[i]        = BasicTriggerNameCtxMatcher::match(_filters[i].view(), triggerName, triggerCtx, _states[i]);
+                _evaluated.push_back(i);
+            }
+        }
+
+        // only evaluated filters may have changed their 'waiting' state
+        _waiting.clear();
+        std::ranges::copy_if(_evaluated, std::back_inserter(_waiting), [this](std::size_t i) { return _states[i].waitingForNonMatch(); });
+    }
+};
+
 } // namespace BasicTriggerNameCtxMatcher
 
 } // namespace gr::trigger
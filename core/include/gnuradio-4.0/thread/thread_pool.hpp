@@ -9,7 +9,9 @@
 #include <functional>
 #include <future>
 #include <iostream>
+#include <limits>
 #include <list>
+#include <memory>
 #include <mutex>
 #include <span>
 #include <string>
@@ -649,6 +651,14 @@ inline std::atomic<uint64_t> BasicThreadPool::_globalPoolId = 0U;
 inline std::atomic<uint64_t> BasicThreadPool::_taskID       = 0U;
 static_assert(ThreadPool<BasicThreadPool>);
 
+/**
+ * @brief process-wide IO_BOUND pool shared by owners of blocking-I/O blocks that are not given a dedicated pool (e.g. 'StaticGraph')
+ */
+[[nodiscard]] inline std::shared_ptr<BasicThreadPool> defaultIoThreadPool() {
+    static const std::shared_ptr<BasicThreadPool> pool = std::make_shared<BasicThreadPool>("default_io_pool", TaskType::IO_BOUND, 2U, std::numeric_limits<uint32_t>::max());
+    return pool;
+}
+
 } // namespace gr::thread_pool
 
 #endif // THREADPOOL_HPP
@@ -0,0 +1,36 @@
+#include <fstream>
+#include <iostream>
+
+#include <fmt/format.h>
+
+#include <gnuradio-4.0/Profiler.hpp>
+
+// converts binary traces written by gr::profiling::Profiler (OutputFormat::Binary) into the Chrome/Perfetto JSON
+// trace format, e.g. for 'chrome://tracing' or 'https://ui.perfetto.dev'
+int main(int argc, char** argv) {
+    if (argc < 2 || argc > 3) {
+        fmt::println(std::cerr, "usage: {} <input.grtrace> [<output.trace>] -- writes to stdout if no output file is given", argv[0]);
+        return 1;
+    }
+
+    std::ifstream in(argv[1], std::ios::in | std::ios::binary);
+    if (!in) {
+        fmt::println(std::cerr, "cannot open input file '{}'", argv[1]);
+        return 1;
+    }
+
+    std::ofstream out;
+    if (argc == 3) {
+        out.open(argv[2], std::ios::out);
+        if (!out) {
+            fmt::println(std::cerr, "cannot open output file '{}'", argv[2]);
+            return 1;
+        }
+    }
+
+    if (!gr::profiling::convertBinaryTraceToJson(in, argc == 3 ? static_cast<std::ostream&>(out) : std::cout)) {
+        fmt::println(std::cerr, "'{}' is not a valid (or a truncated) binary trace", argv[1]);
+        return 1;
+    }
+    return 0;
+}
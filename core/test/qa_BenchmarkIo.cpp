@@ -0,0 +1,118 @@
+#include <benchmark.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+/*
+ * N.B. 'benchmark.hpp' installs its own reporter which, after all tests ran, evaluates 'BM_OUTPUT_FILE' and 'BM_BASELINE'
+ * -> the tests below reset both environment variables before returning.
+ */
+
+namespace {
+using benchmark::io::Data;
+
+benchmark::ResultMap makeResult(long double mean, long double opsPerSecond) {
+    benchmark::ResultMap result;
+    result.try_emplace("mean", mean, "s", 3UZ);
+    result.try_emplace("ops/s", opsPerSecond, "", 3UZ);
+    result.try_emplace("#N", std::uint64_t{42}, "", 0UZ);
+    result.try_emplace("CPU cache misses", benchmark::perf_sub_metric{.misses = 10U, .total = 1000U, .ratio = 0.01}, "", 0UZ);
+    return result;
+}
+
+Data makeData(long double mean, long double opsPerSecond) {
+    Data data;
+    data.emplace_back("copy \"float\"", makeResult(mean, opsPerSecond));
+    data.emplace_back(std::string{}, benchmark::ResultMap{}); // separator
+    data.emplace_back("skipped", benchmark::ResultMap{});
+    return data;
+}
+
+std::string toJson(const Data& data) {
+    std::ostringstream out;
+    benchmark::io::writeJson(out, data);
+    return out.str();
+}
+
+std::size_t compareWithBaselineFile(const std::filesystem::path& baselineFile, const Data& candidate) {
+    ::setenv("BM_BASELINE", baselineFile.c_str(), 1);
+    ::setenv("BM_REGRESSION_THRESHOLD", "10", 1);
+    const std::size_t nRegressions = benchmark::io::compareToBaseline(candidate);
+    ::unsetenv("BM_BASELINE");
+    ::unsetenv("BM_REGRESSION_THRESHOLD");
+    return nRegressions;
+}
+} // namespace
+
+const boost::ut::suite<"benchmark io"> _benchmarkIoTests = [] {
+    using namespace boost::ut;
+
+    "JSON round-trip"_test = [] {
+        const auto baseline = benchmark::io::readJson(toJson(makeData(1.5e-3L, 2.0e6L)));
+        expect(fatal(baseline.has_value()));
+        expect(eq(baseline->size(), 2UZ)) << "separators are not exported";
+        expect(fatal(baseline->contains("copy \"float\"")));
+        expect(baseline->contains("skipped"));
+        expect(baseline->at("skipped").empty());
+
+        const benchmark::io::Metrics& metrics = baseline->at("copy \"float\"");
+        expect(approx(static_cast<double>(metrics.at("mean")), 1.5e-3, 1e-12));
+        expect(approx(static_cast<double>(metrics.at("ops/s")), 2.0e6, 1e-3));
+        expect(approx(static_cast<double>(metrics.at("#N")), 42.0, 1e-9));
+        expect(approx(static_cast<double>(metrics.at("CPU cache misses.misses")), 10.0, 1e-9));
+        expect(approx(static_cast<double>(metrics.at("CPU cache misses.total")), 1000.0, 1e-9));
+        expect(approx(static_cast<double>(metrics.at("CPU cache misses.ratio")), 0.01, 1e-9));
+
+        benchmark::ResultMap nonFinite;
+        nonFinite.try_emplace("mean", std::numeric_limits<long double>::quiet_NaN(), "s", 3UZ);
+        const auto withNull = benchmark::io::readJson(toJson(Data{{"nan", nonFinite}}));
+        expect(fatal(withNull.has_value()));
+        expect(withNull->at("nan").empty()) << "non-finite values are written as 'null' and skipped when read";
+
+        expect(benchmark::io::readJson("[]").has_value());
+    };
+
+    "corrupt JSON"_test = [] {
+        const std::string valid = toJson(makeData(1.5e-3L, 2.0e6L));
+        expect(!benchmark::io::readJson("").has_value());
+        expect(!benchmark::io::readJson(valid.substr(0UZ, valid.size() / 2UZ)).has_value()) << "truncated";
+        expect(!benchmark::io::readJson(R"([{"name": "a", "mean": 1.0x}])").has_value()) << "invalid number";
+        expect(!benchmark::io::readJson(R"([{"name": "a", "mean" 1.0}])").has_value()) << "missing ':'";
+        expect(!benchmark::io::readJson(R"({"name": "a"})").has_value()) << "not an array";
+    };
+
+    "compare to baseline"_test = [] {
+        const std::filesystem::path baselineFile = std::filesystem::temp_directory_path() / "qa_BenchmarkIo_baseline.json";
+        {
+            std::ofstream file(baselineFile);
+            benchmark::io::writeJson(file, makeData(1.0e-3L, 1.0e6L));
+        }
+
+        expect(eq(compareWithBaselineFile(baselineFile, makeData(1.0e-3L, 1.0e6L)), 0UZ)) << "unchanged";
+        expect(eq(compareWithBaselineFile(baselineFile, makeData(1.05e-3L, 0.95e6L)), 0UZ)) << "within threshold";
+        expect(eq(compareWithBaselineFile(baselineFile, makeData(0.5e-3L, 2.0e6L)), 0UZ)) << "faster: lower 'mean', higher 'ops/s'";
+        expect(eq(compareWithBaselineFile(baselineFile, makeData(1.5e-3L, 1.0e6L)), 1UZ)) << "slower 'mean'";
+        expect(eq(compareWithBaselineFile(baselineFile, makeData(1.0e-3L, 0.5e6L)), 1UZ)) << "lower 'ops/s'";
+        expect(eq(compareWithBaselineFile(baselineFile, makeData(1.5e-3L, 0.5e6L)), 2UZ)) << "slower in both metrics";
+
+        Data renamed;
+        renamed.emplace_back("not in baseline", makeResult(1.0L, 1.0L));
+        expect(eq(compareWithBaselineFile(baselineFile, renamed), 0UZ)) << "benchmarks missing in the baseline are not regressions";
+
+        std::filesystem::remove(baselineFile);
+        expect(eq(compareWithBaselineFile(baselineFile, makeData(1.0e-3L, 1.0e6L)), 1UZ)) << "missing baseline file";
+
+        {
+            std::ofstream file(baselineFile);
+            file << R"([{"name": "copy \"float\"", "mean": )";
+        }
+        expect(eq(compareWithBaselineFile(baselineFile, makeData(1.0e-3L, 1.0e6L)), 1UZ)) << "corrupt baseline file";
+        std::filesystem::remove(baselineFile);
+
+        expect(eq(benchmark::io::compareToBaseline(makeData(1.0e-3L, 1.0e6L)), 0UZ)) << "no 'BM_BASELINE' defined";
+    };
+};
+
+int main() { /* not needed for UT */ }
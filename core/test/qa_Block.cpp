@@ -1,3 +1,4 @@
+#include <numeric>
 #include <utility>
 #include <vector>
 
@@ -25,6 +26,28 @@ public:
         return a;
     }
 };
+
+struct copyAndScale : public Block<copyAndScale> { // two outputs: 'out0 = in', 'out1 = 2 * in'
+    PortIn<float>  in;
+    PortOut<float> out0;
+    PortOut<float> out1;
+
+    GR_MAKE_REFLECTABLE(copyAndScale, in, out0, out1);
+
+public:
+    template<meta::t_or_simd<float> V>
+    [[nodiscard]] constexpr auto processOne(const V& a) const noexcept {
+        if constexpr (meta::any_simd<V>) {
+            using std::get;
+            vir::simdize<std::tuple<float, float>, V::size()> result{};
+            get<0>(result) = a;
+            get<1>(result) = 2.f * a;
+            return result;
+        } else {
+            return std::tuple<float, float>{a, 2.f * a};
+        }
+    }
+};
 } // namespace gr::test
 
 namespace gr::test {
@@ -38,6 +61,8 @@ static_assert(SourceBlockLike<copy>);
 static_assert(SinkBlockLike<copy>);
 static_assert(SourceBlockLike<decltype(mergeByIndex<0, 0>(copy(), copy()))>);
 static_assert(SinkBlockLike<decltype(mergeByIndex<0, 0>(copy(), copy()))>);
+static_assert(traits::block::can_processOne_simd<copyAndScale>);
+static_assert(traits::block::can_processOne_simd<decltype(merge<"out1", "in">(copyAndScale(), copy()))>);
 } // namespace gr::test
 #endif
 
@@ -389,6 +414,84 @@ struct IntDecBlock : public gr::Block<IntDecBlock<T>, gr::Resampling<>, gr::Stri
     }
 };
 
+template<typename T>
+struct MergeScaleBlock : public gr::Block<MergeScaleBlock<T>> {
+    gr::PortIn<T>  in{};
+    gr::PortOut<T> out{};
+
+    GR_MAKE_REFLECTABLE(MergeScaleBlock, in, out);
+
+    [[nodiscard]] constexpr T processOne(T a) const noexcept { return T(2) * a; }
+};
+
+template<typename T>
+struct MergeDecimateBlock : public gr::Block<MergeDecimateBlock<T>, gr::Resampling<>> { // sums 'input_chunk_size' samples
+    gr::PortIn<T>  in{};
+    gr::PortOut<T> out{};
+
+    GR_MAKE_REFLECTABLE(MergeDecimateBlock, in, out);
+
+    gr::work::Status processBulk(gr::InputSpanLike auto& input, gr::OutputSpanLike auto& output) {
+        const std::size_t chunkSize = this->input_chunk_size.value;
+        const std::size_t nChunks   = std::min(input.size() / chunkSize, output.size());
+        for (std::size_t i = 0UZ; i < nChunks; i++) {
+            output[i] = std::accumulate(input.begin() + static_cast<std::ptrdiff_t>(i * chunkSize), input.begin() + static_cast<std::ptrdiff_t>((i + 1UZ) * chunkSize), T{});
+        }
+        std::ignore = input.consume(nChunks * chunkSize);
+        output.publish(nChunks);
+        return gr::work::Status::OK;
+    }
+};
+
+template<typename T>
+struct MergeSettingsDecimateBlock : public gr::Block<MergeSettingsDecimateBlock<T>, gr::Resampling<>> { // sums 'decimation' samples
+    gr::PortIn<T>  in{};
+    gr::PortOut<T> out{};
+    gr::Size_t     decimation = 4U;
+
+    GR_MAKE_REFLECTABLE(MergeSettingsDecimateBlock, in, out, decimation);
+
+    static inline std::size_t nStarted = 0UZ;
+
+    void settingsChanged(const gr::property_map& /*oldSettings*/, const gr::property_map& newSettings) {
+        if (newSettings.contains("decimation")) {
+            this->input_chunk_size = decimation;
+        }
+    }
+
+    void start() { nStarted++; }
+
+    gr::work::Status processBulk(gr::InputSpanLike auto& input, gr::OutputSpanLike auto& output) {
+        const std::size_t chunkSize = this->input_chunk_size.value;
+        const std::size_t nChunks   = std::min(input.size() / chunkSize, output.size());
+        for (std::size_t i = 0UZ; i < nChunks; i++) {
+            output[i] = std::accumulate(input.begin() + static_cast<std::ptrdiff_t>(i * chunkSize), input.begin() + static_cast<std::ptrdiff_t>((i + 1UZ) * chunkSize), T{});
+        }
+        std::ignore = input.consume(nChunks * chunkSize);
+        output.publish(nChunks);
+        return gr::work::Status::OK;
+    }
+};
+
+template<typename T>
+struct MergeInterpolateBlock : public gr::Block<MergeInterpolateBlock<T>, gr::Resampling<>> { // repeats each sample 'output_chunk_size' times
+    gr::PortIn<T>  in{};
+    gr::PortOut<T> out{};
+
+    GR_MAKE_REFLECTABLE(MergeInterpolateBlock, in, out);
+
+    gr::work::Status processBulk(gr::InputSpanLike auto& input, gr::OutputSpanLike auto& output) {
+        const std::size_t chunkSize = this->output_chunk_size.value;
+        const std::size_t nSamples  = std::min(input.size(), output.size() / chunkSize);
+        for (std::size_t i = 0UZ; i < nSamples; i++) {
+            std::fill_n(output.begin() + static_cast<std::ptrdiff_t>(i * chunkSize), chunkSize, input[i]);
+        }
+        std::ignore = input.consume(nSamples);
+        output.publish(nSamples * chunkSize);
+        return gr::work::Status::OK;
+    }
+};
+
 // This block is used to test different combination of Sync/Async input/output ports
 template<typename T, bool isInputAsync, bool isOutputAsync>
 struct SyncOrAsyncBlock : gr::Block<SyncOrAsyncBlock<T, isInputAsync, isOutputAsync>> {
@@ -977,6 +1080,108 @@ const boost::ut::suite<"BlockingIO Tests"> _blockingIOTests = [] {
     };
 };
 
+const boost::ut::suite<"MergedGraph Tests"> _mergedGraphTests = [] {
+    using namespace boost::ut;
+    using namespace gr;
+
+    "merge processOne and processBulk resampling blocks"_test = [] {
+        MergeDecimateBlock<float> decimate;
+        decimate.input_chunk_size = 3U; // N.B. member blocks are configured via their fields before merging
+        MergeInterpolateBlock<float> interpolate;
+        interpolate.output_chunk_size = 2U;
+
+        auto merged = merge<"out", "in">(merge<"out", "in">(MergeScaleBlock<float>(), std::move(decimate)), std::move(interpolate));
+        expect(eq(merged.mergedInputChunkSize(), 3UZ));
+        expect(eq(merged.mergedOutputChunkSize(), 2UZ));
+
+        std::vector<float> input(14UZ); // two trailing samples do not form a complete chunk
+        std::iota(input.begin(), input.end(), 0.f);
+        std::vector<float>                  output(10UZ, -1.f);
+        std::vector<Tag>                    inputTags{Tag{6UZ, {{"key", "value"}}}};
+        std::vector<Tag>                    outputTags;
+        gr::detail::MergedInputSpan<float>  inSpan(input, inputTags);
+        gr::detail::MergedOutputSpan<float> outSpan(output, outputTags);
+
+        expect(merged.processBulk(inSpan, outSpan) == work::Status::OK);
+        expect(eq(inSpan.nSamplesToConsume(), 12UZ));
+        expect(eq(outSpan.nSamplesToPublish(), 8UZ));
+        expect(std::ranges::equal(std::span(output).first(8UZ), std::vector<float>{6.f, 6.f, 24.f, 24.f, 42.f, 42.f, 60.f, 60.f}));
+        expect(eq(outputTags.size(), 1UZ));
+        expect(eq(outputTags[0].index, 4UZ)) << "tag is forwarded to the rate-scaled output position";
+        expect(outputTags[0].map.contains("key"));
+    };
+
+    "merge with limited output space"_test = [] {
+        MergeDecimateBlock<float> decimate;
+        decimate.input_chunk_size = 4U;
+        auto merged               = merge<"out", "in">(MergeScaleBlock<float>(), std::move(decimate));
+
+        std::vector<float>                  input(16UZ, 1.f);
+        std::vector<float>                  output(3UZ);
+        std::vector<Tag>                    inputTags;
+        std::vector<Tag>                    outputTags;
+        gr::detail::MergedInputSpan<float>  inSpan(input, inputTags);
+        gr::detail::MergedOutputSpan<float> outSpan(output, outputTags);
+
+        expect(merged.processBulk(inSpan, outSpan) == work::Status::OK);
+        expect(eq(inSpan.nSamplesToConsume(), 12UZ));
+        expect(eq(outSpan.nSamplesToPublish(), 3UZ));
+        expect(std::ranges::equal(output, std::vector<float>{8.f, 8.f, 8.f}));
+    };
+
+#if !DISABLE_SIMD
+    "merge SIMD left block with multiple outputs"_test = [] {
+        using std::get;
+        using V     = vir::simdize<float, 4>;
+        auto merged = merge<"out1", "in">(gr::test::copyAndScale(), gr::test::copy()); // outputs: left 'out0' followed by right 'out'
+
+        const V    input([](auto i) { return static_cast<float>(i) + 1.f; });
+        const auto output = merged.processOne(input);
+        for (std::size_t i = 0UZ; i < V::size(); i++) {
+            expect(eq(get<0>(output)[i], input[i])) << fmt::format("passed-through left output at lane {}", i);
+            expect(eq(get<1>(output)[i], 2.f * input[i])) << fmt::format("right output at lane {}", i);
+        }
+
+        const auto scalarOutput = merged.processOne(3.f);
+        expect(eq(get<0>(scalarOutput), 3.f));
+        expect(eq(get<1>(scalarOutput), 6.f));
+    };
+#endif
+
+    "merged resampling block in a graph"_test = [] {
+        using namespace gr::testing;
+        using MergedDecimator         = MergedGraph<MergeScaleBlock<float>, MergeSettingsDecimateBlock<float>, 0UZ, 0UZ>;
+        constexpr gr::Size_t kSamples = 1003U; // N.B. not a multiple of the decimation -> remainder is dropped at EOS
+
+        MergeSettingsDecimateBlock<float>::nStarted = 0UZ;
+
+        gr::Graph flow;
+        auto&     source = flow.emplaceBlock<TagSource<float, ProcessFunction::USE_PROCESS_BULK>>({{"n_samples_max", kSamples}, {"mark_tag", false}});
+        auto&     merged = flow.emplaceBlock<MergedDecimator>();
+        auto&     sink   = flow.emplaceBlock<TagSink<float, ProcessFunction::USE_PROCESS_BULK>>();
+        expect(eq(merged.mergedInputChunkSize(), 4UZ)) << "decimation derived in the forwarded settingsChanged(..)";
+        expect(eq(merged.mergedOutputChunkSize(), 1UZ));
+        expect(eq(ConnectionResult::SUCCESS, flow.connect<"out">(source).to<"in">(merged)));
+        expect(eq(ConnectionResult::SUCCESS, flow.connect<"out">(merged).to<"in">(sink)));
+
+        auto sched = scheduler::Simple(std::move(flow));
+        expect(sched.runAndWait().has_value()) << "no stall on the trailing partial chunk";
+
+        expect(eq(MergeSettingsDecimateBlock<float>::nStarted, 1UZ)) << "start() is forwarded to the members";
+        expect(eq(sink._nSamplesProduced, kSamples / 4U));
+        expect(fatal(eq(sink._samples.size(), static_cast<std::size_t>(kSamples / 4U))));
+        for (std::size_t i = 0UZ; i < sink._samples.size(); i++) { // sum of 2 * [4i, 4i+3]
+            expect(eq(sink._samples[i], static_cast<float>(32UZ * i + 12UZ))) << fmt::format("sample {}", i);
+        }
+    };
+
+    "merge rejects non-zero stride"_test = [] {
+        IntDecBlock<float> strided;
+        strided.stride = 2U; // != input_chunk_size
+        expect(throws([&strided] { std::ignore = merge<"out", "in">(MergeScaleBlock<float>(), std::move(strided)); }));
+    };
+};
+
 const boost::ut::suite<"reflFirstTypeName Tests"> _reflFirstTypeNameTests = [] {
     using namespace boost::ut;
     using namespace gr::detail;
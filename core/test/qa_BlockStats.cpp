@@ -0,0 +1,120 @@
+#include <boost/ut.hpp>
+
+#include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/Message.hpp>
+#include <gnuradio-4.0/testing/NullSources.hpp>
+
+// N.B. this test is compiled with 'GR_ENABLE_BLOCK_STATS=1' (see CMakeLists.txt)
+static_assert(gr::block::kStatsEnabled, "qa_BlockStats needs to be compiled with GR_ENABLE_BLOCK_STATS=1");
+
+namespace {
+template<typename T>
+T getAs(const gr::property_map& map, const std::string& key) {
+    return std::get<T>(map.at(key));
+}
+
+void runToCompletion(gr::Graph& graph) {
+    using namespace boost::ut;
+    expect(graph.reconnectAllEdges());
+    graph.forEachBlockMutable([](gr::BlockModel& block) { expect(block.changeState(gr::lifecycle::State::RUNNING).has_value()); });
+    for (std::size_t iteration = 0UZ; iteration < 1000UZ; iteration++) {
+        bool allDone = true;
+        for (const auto& block : graph.blocks()) {
+            allDone = block->work(std::numeric_limits<std::size_t>::max()).status == gr::work::Status::DONE && allDone;
+        }
+        if (allDone) {
+            return;
+        }
+    }
+    expect(false) << "graph did not finish";
+}
+} // namespace
+
+const boost::ut::suite<"Block execution statistics"> _blockStatsTests = [] {
+    using namespace boost::ut;
+    using namespace gr::testing;
+    using enum gr::message::Command;
+    using gr::block::Stats;
+
+    "counters"_test = [] {
+        gr::Graph graph;
+        auto&     src  = graph.emplaceBlock<CountingSource<float>>({{"n_samples_max", gr::Size_t(500)}});
+        auto&     copy = graph.emplaceBlock<Copy<float>>();
+        auto&     sink = graph.emplaceBlock<CountingSink<float>>();
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(src).to<"in">(copy)));
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(copy).to<"in">(sink)));
+        expect(src.settings().set({{"n_samples_max", gr::Size_t(1000)}}).empty());
+        const std::uint64_t nSettingsAppliedBefore = src.stats().nSettingsApplied.load();
+
+        runToCompletion(graph);
+
+        const Stats& stats = copy.stats();
+        expect(gt(stats.nCalls.load(), 0UZ));
+        expect(eq(stats.nSamplesIn.load(), 1000UZ));
+        expect(eq(stats.nSamplesOut.load(), 1000UZ));
+        expect(gt(stats.wallTimeNs.load(), 0UZ));
+        expect(ge(stats.nCallsByStatus[Stats::statusIndex(gr::work::Status::DONE)].load(), 1UZ));
+
+        std::uint64_t nCallsByStatus = 0U;
+        for (const auto& counter : stats.nCallsByStatus) {
+            nCallsByStatus += counter.load();
+        }
+        expect(eq(nCallsByStatus, stats.nCalls.load())) << "each call is accounted to exactly one work::Status";
+
+        expect(eq(src.stats().nSamplesOut.load(), 1000UZ));
+        expect(eq(src.stats().nSamplesIn.load(), 0UZ));
+        expect(eq(src.n_samples_max.value, gr::Size_t(1000)));
+        expect(eq(src.stats().nSettingsApplied.load(), nSettingsAppliedBefore + 1U)) << "staged 'n_samples_max' has been applied exactly once";
+    };
+
+    "kStats and kGraphStats message endpoints"_test = [] {
+        gr::MsgPortOut toGraph;
+        gr::Graph      graph;
+        gr::MsgPortIn  fromGraph;
+        expect(eq(gr::ConnectionResult::SUCCESS, toGraph.connect(graph.msgIn)));
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.msgOut.connect(fromGraph)));
+
+        auto& src  = graph.emplaceBlock<CountingSource<float>>({{"n_samples_max", gr::Size_t(500)}});
+        auto& sink = graph.emplaceBlock<CountingSink<float>>();
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(src).to<"in">(sink)));
+        runToCompletion(graph);
+
+        gr::MsgPortOut toSink;
+        gr::MsgPortIn  fromSink;
+        expect(eq(gr::ConnectionResult::SUCCESS, toSink.connect(sink.msgIn)));
+        expect(eq(gr::ConnectionResult::SUCCESS, sink.msgOut.connect(fromSink)));
+
+        auto receiveReply = [](gr::MsgPortIn& port, std::string_view endpoint) {
+            gr::ReaderSpanLike auto messages = port.streamReader().get<gr::SpanReleasePolicy::ProcessAll>(port.streamReader().available());
+            auto                    it       = std::ranges::find_if(messages, [endpoint](const gr::Message& msg) { return msg.endpoint == endpoint; });
+            expect(it != messages.end()) << fmt::format("no reply on endpoint {}", endpoint);
+            gr::Message reply = it != messages.end() ? *it : gr::Message{};
+            expect(messages.consume(messages.size()));
+            return reply;
+        };
+
+        gr::sendMessage<Get>(toGraph, "", gr::graph::property::kGraphStats, {});
+        graph.processScheduledMessages();
+        const gr::Message graphReply = receiveReply(fromGraph, gr::graph::property::kGraphStats);
+        expect(graphReply.data.has_value());
+        if (graphReply.data.has_value()) {
+            const auto& children = graphReply.data.value();
+            expect(eq(children.size(), 2UZ));
+            const auto sinkStats = getAs<gr::property_map>(children, sink.unique_name);
+            expect(eq(getAs<std::uint64_t>(sinkStats, "samples_in"), 500UZ));
+            expect(eq(getAs<std::uint64_t>(sinkStats, "calls"), sink.stats().nCalls.load()));
+            expect(getAs<gr::property_map>(sinkStats, "status").contains("DONE"));
+        }
+
+        gr::sendMessage<Set>(toSink, sink.unique_name, gr::block::property::kStats, {}); // retrieve and reset
+        sink.processScheduledMessages();
+        const gr::Message blockReply = receiveReply(fromSink, gr::block::property::kStats);
+        expect(blockReply.data.has_value());
+        if (blockReply.data.has_value()) {
+            expect(eq(getAs<std::uint64_t>(blockReply.data.value(), "samples_in"), 500UZ));
+        }
+        expect(eq(sink.stats().nCalls.load(), 0UZ)) << "'Set' resets the statistics";
+    };
+};
+
+int main() { /* not needed for UT */ }
@@ -0,0 +1,270 @@
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <thread>
+
+#include <boost/ut.hpp>
+
+#include <gnuradio-4.0/CircularBuffer.hpp>
+#include <gnuradio-4.0/DataSet.hpp>
+#include <gnuradio-4.0/DataSetPool.hpp>
+#include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/basic/DataSink.hpp>
+#include <gnuradio-4.0/basic/StreamToDataSet.hpp>
+#include <gnuradio-4.0/fourier/fft.hpp>
+#include <gnuradio-4.0/testing/AllocationCounter.hpp>
+#include <gnuradio-4.0/testing/NullSources.hpp>
+
+/*
+ * N.B. executable links 'gr-testing-allocation-hooks' for counting the heap allocations (see 'gr::testing::allocation').
+ */
+
+template<typename T>
+struct CountingDataSetSink : public gr::Block<CountingDataSetSink<T>> { // N.B. does not copy the received DataSets
+    gr::PortIn<gr::DataSet<T>> in;
+
+    GR_MAKE_REFLECTABLE(CountingDataSetSink, in);
+
+    std::size_t _nDataSets = 0UZ;
+
+    [[nodiscard]] constexpr gr::work::Status processBulk(std::span<const gr::DataSet<T>> input) noexcept {
+        _nDataSets += input.size();
+        return gr::work::Status::OK;
+    }
+};
+
+constexpr std::size_t kWarmUpPasses  = 1024UZ; // N.B. all output buffer slots (incl. their mirror) and pool entries have been written once
+constexpr std::size_t kPasses        = 256UZ;
+constexpr std::size_t kRequestedWork = 4096UZ;
+
+gr::testing::allocation::Counts steadyStateWorkCounts(gr::Graph& graph, std::string_view blockName, const std::source_location location = std::source_location::current()) {
+    using namespace boost::ut;
+    namespace allocation = gr::testing::allocation;
+    expect(graph.reconnectAllEdges(), location);
+    graph.forEachBlockMutable([&location](gr::BlockModel& block) { expect(block.changeState(gr::lifecycle::State::RUNNING).has_value(), location); });
+
+    std::ignore               = allocation::countWorkPerBlock(graph, kWarmUpPasses, kRequestedWork);
+    const auto countsPerBlock = allocation::countWorkPerBlock(graph, kPasses, kRequestedWork);
+
+    const auto it = countsPerBlock.find(blockName);
+    expect(fatal(it != countsPerBlock.end()), location) << fmt::format("block '{}' not found", blockName);
+    return it->second;
+}
+
+template<typename T>
+struct TriggerChunkSource : public gr::Block<TriggerChunkSource<T>> { // publishes 'chunk_size' samples per work call, every 'tag_interval'-th chunk starts with a trigger tag
+    gr::PortOut<T> out;
+
+    gr::Size_t chunk_size   = 1024U;
+    gr::Size_t tag_interval = 8U;
+
+    GR_MAKE_REFLECTABLE(TriggerChunkSource, out, chunk_size, tag_interval);
+
+    gr::property_map _triggerTag{{gr::tag::TRIGGER_NAME.shortKey(), std::string("TRG")}}; // N.B. short (non-allocating) strings only
+    std::size_t      _nChunks         = 0UZ;
+    bool             _lastChunkTagged = false; // whether the chunk published by the last work call carried the trigger tag
+
+    [[nodiscard]] gr::work::Status processBulk(gr::OutputSpanLike auto& outSpan) {
+        _lastChunkTagged = false;
+        if (outSpan.size() < chunk_size) {
+            outSpan.publish(0UZ);
+            return gr::work::Status::INSUFFICIENT_OUTPUT_ITEMS;
+        }
+        _lastChunkTagged = _nChunks % tag_interval == 0UZ;
+        if (_lastChunkTagged) {
+            outSpan.publishTag(_triggerTag, 0UZ);
+        }
+        std::fill_n(outSpan.begin(), chunk_size, T{1});
+        outSpan.publish(chunk_size);
+        _nChunks++;
+        return gr::work::Status::OK;
+    }
+};
+
+/**
+ * Counts the allocations of 'producer.work(..)' that processed an untagged chunk of 'source' after the warm-up. The producer
+ * consumes the full chunk of each pass, i.e. its calls are aligned with the chunks of the source.
+ * N.B. tagged calls are excluded: 'Block' merges the input tags into a fresh 'property_map' and the producers copy the trigger
+ * tag into the DataSet's 'timing_events', both of which allocate once per trigger.
+ */
+template<typename TProducer>
+gr::testing::allocation::Counts untaggedWorkCounts(gr::Graph& graph, const TriggerChunkSource<float>& source, const TProducer& producer, const std::source_location location = std::source_location::current()) {
+    using namespace boost::ut;
+    namespace allocation = gr::testing::allocation;
+    expect(graph.reconnectAllEdges(), location);
+    graph.forEachBlockMutable([&location](gr::BlockModel& block) { expect(block.changeState(gr::lifecycle::State::RUNNING).has_value(), location); });
+
+    allocation::Counts untagged;
+    std::size_t        nUntaggedCalls = 0UZ;
+    for (std::size_t pass = 0UZ; pass < kWarmUpPasses + kPasses; pass++) {
+        for (const auto& block : graph.blocks()) {
+            allocation::Scope scope;
+            std::ignore         = block->work(kRequestedWork);
+            const auto counts   = scope.counts();
+            const bool isSteady = pass >= kWarmUpPasses && block->uniqueName() == producer.unique_name && !source._lastChunkTagged;
+            if (isSteady) {
+                untagged += counts;
+                nUntaggedCalls++;
+            }
+        }
+    }
+    expect(gt(nUntaggedCalls, kPasses / 2UZ), location);
+    return untagged;
+}
+
+const boost::ut::suite<"DataSetPool"> _dataSetPoolTests = [] {
+    using namespace boost::ut;
+
+    "hooks installed"_test = [] { expect(fatal(gr::testing::allocation::hooksInstalled())) << "executable needs to link 'gr-testing-allocation-hooks'"; };
+
+    "acquire and release"_test = [] {
+        gr::DataSetPool<float> pool(2UZ);
+        expect(eq(pool.capacity(), 2UZ));
+        expect(eq(pool.size(), 0UZ));
+
+        gr::DataSet<float> ds = pool.acquire(); // empty pool -> default-constructed
+        expect(ds.signal_values.empty());
+        ds.signal_values.resize(1024UZ, 42.f);
+        const float* storage = ds.signal_values.data();
+
+        pool.release(std::move(ds));
+        expect(eq(pool.size(), 1UZ));
+
+        gr::DataSet<float> recycled = pool.acquire();
+        expect(eq(pool.size(), 0UZ));
+        expect(recycled.signal_values.data() == storage) << "recycled DataSet re-uses the storage of the released one";
+
+        pool.release(std::move(recycled));
+        pool.release(gr::DataSet<float>{});
+        pool.release(gr::DataSet<float>{});
+        expect(eq(pool.size(), 2UZ)) << "pool is bounded by its capacity";
+    };
+
+    "concurrent acquire and release"_test = [] {
+        constexpr std::size_t  nIterations = 10'000UZ;
+        gr::DataSetPool<float> pool(8UZ);
+
+        std::atomic<std::size_t> nReleased{0UZ};
+        auto                     worker = [&pool, &nReleased] {
+            for (std::size_t i = 0UZ; i < nIterations; i++) {
+                gr::DataSet<float> ds = pool.acquire();
+                ds.signal_values.assign(16UZ, static_cast<float>(i));
+                pool.release(std::move(ds));
+                nReleased.fetch_add(1UZ, std::memory_order_relaxed);
+            }
+        };
+        {
+            std::jthread producer(worker);
+            std::jthread consumer(worker);
+        }
+        expect(eq(nReleased.load(), 2UZ * nIterations));
+        expect(le(pool.size(), pool.capacity()));
+    };
+
+    "steady-state DataSet hand-off is allocation-free"_test = [] {
+        constexpr std::size_t nSamples = 1024UZ;
+
+        gr::DataSet<float> dataSetTemplate;
+        dataSetTemplate.axis_names    = {"time"};
+        dataSetTemplate.axis_units    = {"s"};
+        dataSetTemplate.extents       = {1, static_cast<std::int32_t>(nSamples)};
+        dataSetTemplate.signal_names  = {"a signal name that does not fit into the small string buffer"};
+        dataSetTemplate.signal_units  = {"a.u."};
+        dataSetTemplate.signal_ranges = {{-1.f, +1.f}};
+        std::vector<float> samples(nSamples);
+        std::iota(samples.begin(), samples.end(), 0.f);
+
+        // producer (block/listener) -> buffer -> consumer (downstream block/poller), the consumed slots are recycled by the producer
+        gr::CircularBuffer<gr::DataSet<float>> buffer(16UZ);
+        auto                                   writer = buffer.new_writer();
+        auto                                   reader = buffer.new_reader();
+        gr::DataSetPool<float>                 pool(4UZ);
+
+        std::size_t nConsumed    = 0UZ;
+        auto        produceCycle = [&] {
+            gr::DataSet<float> ds = pool.acquire();
+            ds                    = dataSetTemplate;
+            ds.signal_values.assign(samples.begin(), samples.end());
+            {
+                auto out = writer.reserve(1UZ);
+                std::swap(out[0], ds);
+                out.publish(1UZ);
+            }
+            pool.release(std::move(ds));
+
+            auto in = reader.get(reader.available());
+            for (const auto& received : in) {
+                nConsumed += received.signal_values.size() == nSamples;
+            }
+            expect(in.consume(in.size()));
+        };
+
+        for (std::size_t i = 0UZ; i < 2UZ * buffer.size(); i++) { // warm-up: every buffer slot (incl. its mirror) holds a fully-sized DataSet
+            produceCycle();
+        }
+
+        const gr::testing::allocation::Counts counts = gr::testing::allocation::count([&produceCycle] {
+            for (std::size_t i = 0UZ; i < 100UZ; i++) {
+                produceCycle();
+            }
+        });
+
+        expect(eq(nConsumed, 2UZ * buffer.size() + 100UZ));
+        expect(eq(counts.nAllocations, 0UZ)) << "no heap allocation in steady-state";
+    };
+};
+
+const boost::ut::suite<"DataSet producing blocks"> _dataSetBlockTests = [] {
+    using namespace boost::ut;
+    using namespace std::string_literals;
+
+    "FFT"_test = [] {
+        gr::Graph graph;
+        auto&     src  = graph.emplaceBlock<gr::testing::ConstantSource<float>>();
+        auto&     fft  = graph.emplaceBlock<gr::blocks::fft::DefaultFFT<float>>({{"fftSize", gr::Size_t(1024U)}});
+        auto&     sink = graph.emplaceBlock<CountingDataSetSink<float>>();
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect(src, "out"s, fft, "in"s, 4096UZ)));
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect(fft, "out"s, sink, "in"s, 16UZ)));
+
+        const gr::testing::allocation::Counts counts = steadyStateWorkCounts(graph, fft.unique_name);
+        expect(gt(sink._nDataSets, 0UZ));
+        expect(eq(counts.nAllocations, 0UZ)) << fmt::format("FFT allocated {} bytes in {} steady-state work calls", counts.nBytes, kPasses);
+    };
+
+    // N.B. DataSets span several chunks and are completed (and published or handed to the callback) within untagged chunks
+    constexpr std::size_t kChunkSize   = 1024UZ;
+    constexpr std::size_t kPreSamples  = 256UZ;
+    constexpr std::size_t kPostSamples = 4UZ * kChunkSize;
+
+    "StreamToDataSet"_test = [] {
+        gr::Graph graph;
+        auto&     src   = graph.emplaceBlock<TriggerChunkSource<float>>({{"chunk_size", gr::Size_t(kChunkSize)}});
+        auto&     block = graph.emplaceBlock<gr::basic::StreamToDataSet<float>>({{"filter", "[TRG]"s}, {"n_pre", gr::Size_t(kPreSamples)}, {"n_post", gr::Size_t(kPostSamples)}, {"n_max", gr::Size_t(kPreSamples + kPostSamples)}});
+        auto&     sink  = graph.emplaceBlock<CountingDataSetSink<float>>();
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect(src, "out"s, block, "in"s, 4UZ * kChunkSize)));
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect(block, "out"s, sink, "in"s, 16UZ)));
+
+        const gr::testing::allocation::Counts counts = untaggedWorkCounts(graph, src, block);
+        expect(fatal(gt(sink._nDataSets, kPasses / src.tag_interval)));
+        expect(eq(counts.nAllocations, 0UZ)) << fmt::format("StreamToDataSet allocated {} bytes in untagged steady-state work calls", counts.nBytes);
+    };
+
+    "DataSink trigger callback"_test = [] {
+        gr::Graph graph;
+        auto&     src  = graph.emplaceBlock<TriggerChunkSource<float>>({{"chunk_size", gr::Size_t(kChunkSize)}});
+        auto&     sink = graph.emplaceBlock<gr::basic::DataSink<float>>({{"signal_name", "pooled trigger"s}});
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect(src, "out"s, sink, "in"s, 4UZ * kChunkSize)));
+
+        auto isTrigger = [](std::string_view /* filterSpec */, const gr::Tag& tag, const gr::property_map& /* filter state */) { //
+            return gr::trigger::BasicTriggerNameCtxMatcher::triggerNameAndCtx(tag).first == "TRG" ? gr::trigger::MatchResult::Matching : gr::trigger::MatchResult::Ignore;
+        };
+        std::size_t nDataSets = 0UZ;
+        expect(sink.registerTriggerCallback(isTrigger, kPreSamples, kPostSamples, [&nDataSets](const gr::DataSet<float>& dataSet) { nDataSets += dataSet.signal_values.size() == kPreSamples + kPostSamples; }));
+
+        const gr::testing::allocation::Counts counts = untaggedWorkCounts(graph, src, sink); // N.B. callbacks are invoked from within 'work(..)'
+        expect(fatal(gt(nDataSets, kPasses / src.tag_interval)));
+        expect(eq(counts.nAllocations, 0UZ)) << fmt::format("DataSink allocated {} bytes in untagged steady-state work calls", counts.nBytes);
+    };
+};
+
+int main() { /* not needed for UT */ }
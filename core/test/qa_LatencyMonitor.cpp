@@ -0,0 +1,91 @@
+#include <boost/ut.hpp>
+
+#include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/LatencyProbe.hpp>
+#include <gnuradio-4.0/Scheduler.hpp>
+#include <gnuradio-4.0/testing/LatencyMonitor.hpp>
+#include <gnuradio-4.0/testing/NullSources.hpp>
+
+const boost::ut::suite<"latency::Histogram"> _histogramTests = [] {
+    using namespace boost::ut;
+    using gr::latency::Histogram;
+
+    "bucket boundaries"_test = [] {
+        for (std::uint64_t value : {0ULL, 1ULL, 15ULL, 16ULL, 17ULL, 31ULL, 32ULL, 1000ULL, 123'456'789ULL, std::numeric_limits<std::uint64_t>::max()}) {
+            const std::size_t index = Histogram::bucketIndex(value);
+            expect(lt(index, Histogram::kNBuckets));
+            expect(ge(Histogram::bucketUpperBound(index), value)) << fmt::format("value {}", value);
+            expect(index == 0UZ || Histogram::bucketUpperBound(index - 1UZ) < value) << fmt::format("value {}", value);
+        }
+        expect(eq(Histogram::bucketUpperBound(Histogram::kNBuckets - 1UZ), std::numeric_limits<std::uint64_t>::max()));
+    };
+
+    "quantiles"_test = [] {
+        Histogram histogram;
+        expect(eq(histogram.quantile(0.5), 0ULL));
+        for (std::uint64_t value = 1U; value <= 1000U; value++) {
+            histogram.record(value * 1000U); // 1 us .. 1 ms
+        }
+        expect(eq(histogram.count(), 1000ULL));
+        expect(eq(histogram.max(), 1'000'000ULL));
+        expect(eq(histogram.mean(), 500'500ULL));
+        expect(ge(histogram.quantile(0.5), 500'000ULL) && le(histogram.quantile(0.5), 500'000ULL * 9 / 8)) << "<= 12.5% relative error";
+        expect(ge(histogram.quantile(0.99), 990'000ULL) && le(histogram.quantile(0.99), 1'000'000ULL));
+        expect(eq(histogram.quantile(1.0), histogram.max()));
+
+        histogram.reset();
+        expect(eq(histogram.count(), 0ULL));
+        expect(eq(histogram.max(), 0ULL));
+    };
+
+    "probe tags"_test = [] {
+        const gr::property_map tagMap{gr::latency::makeProbe("src", 1000U)};
+        expect(eq(gr::latency::probeAgeNs(tagMap, 1500U).value_or(0U), 500ULL));
+        expect(eq(gr::latency::probeSource(tagMap).value_or(""), std::string_view("src")));
+        expect(!gr::latency::probeAgeNs(gr::property_map{{"some_other_tag", 42}}).has_value());
+    };
+};
+
+const boost::ut::suite<"LatencyMonitor"> _latencyMonitorTests = [] {
+    using namespace boost::ut;
+    using namespace gr::testing;
+    using namespace std::string_literals;
+
+    "end-to-end latency of a linear graph"_test = [] {
+        gr::Graph graph;
+        auto&     src      = graph.emplaceBlock<CountingSource<float>>({{"n_samples_max", gr::Size_t(100'000)}});
+        auto&     injector = graph.emplaceBlock<LatencyProbeInjector<float>>({{"probe_period", 0.f}, {"path_name", "src->monitor"s}});
+        auto&     copy     = graph.emplaceBlock<Copy<float>>();
+        auto&     monitor  = graph.emplaceBlock<LatencyMonitor<float>>();
+        expect(monitor.propertyCallbacks.contains(LatencyMonitor<float>::kLatencyStats)) << "property is available before the block is started";
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(src).to<"in">(injector)));
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(injector).to<"in">(copy)));
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(copy).to<"in">(monitor)));
+
+        gr::scheduler::Simple sched{std::move(graph)};
+        expect(sched.runAndWait().has_value());
+
+        expect(gt(injector.n_probes, 0U));
+        const gr::latency::Histogram* histogram = monitor.histogram("src->monitor");
+        expect(histogram != nullptr) << "probes arrive with the default tag forwarding";
+        if (histogram == nullptr) {
+            return;
+        }
+        expect(gt(histogram->count(), 0ULL));
+        expect(le(histogram->count(), static_cast<std::uint64_t>(injector.n_probes)));
+        expect(le(histogram->quantile(0.5), histogram->quantile(0.99)));
+        expect(le(histogram->quantile(0.99), histogram->max()));
+
+        const std::uint64_t nProbes = histogram->count();
+        const auto          reply   = monitor.propertyCallbackLatencyStats(LatencyMonitor<float>::kLatencyStats, gr::Message{.cmd = gr::message::Command::Set});
+        expect(reply.has_value() && reply->data.has_value());
+        if (reply.has_value() && reply->data.has_value()) {
+            const auto& stats = std::get<gr::property_map>(reply->data.value().at("src->monitor"));
+            expect(eq(std::get<std::uint64_t>(stats.at("count")), nProbes));
+            expect(stats.contains("p50_ns") && stats.contains("p99_ns") && stats.contains("max_ns"));
+        }
+        expect(eq(histogram->count(), 0ULL)) << "'Set' resets the statistics";
+    };
+};
+
+int main() { /* not needed for UT */ }
@@ -0,0 +1,129 @@
+#include <boost/ut.hpp>
+
+#include <gnuradio-4.0/Profiler.hpp>
+
+#include <filesystem>
+#include <limits>
+#include <sstream>
+
+namespace {
+std::string readFile(const std::filesystem::path& path) {
+    std::ifstream     in(path, std::ios::in | std::ios::binary);
+    std::stringstream content;
+    content << in.rdbuf();
+    return content.str();
+}
+
+std::size_t countOccurrences(std::string_view text, std::string_view pattern) {
+    std::size_t count = 0UZ;
+    for (std::size_t pos = text.find(pattern); pos != std::string_view::npos; pos = text.find(pattern, pos + pattern.size())) {
+        count++;
+    }
+    return count;
+}
+
+template<typename Fn>
+void recordEvents(const gr::profiling::Options& options, Fn&& fn) {
+    gr::profiling::Profiler profiler(options);
+    fn(profiler);
+} // N.B. the profiler flushes all pending events on destruction
+} // namespace
+
+const boost::ut::suite<"Profiler"> _profilerTests = [] {
+    using namespace boost::ut;
+    using namespace gr::profiling;
+
+    const auto tmpDir = std::filesystem::temp_directory_path();
+
+    "binary trace and JSON conversion"_test = [&tmpDir] {
+        const auto traceFile = tmpDir / fmt::format("qa_Profiler.{}.grtrace", getpid());
+        recordEvents({.output_file = traceFile.string(), .output_format = OutputFormat::Binary}, [](Profiler& profiler) {
+            auto& handler = profiler.forThisThread();
+            {
+                [[maybe_unused]] auto event = handler.startCompleteEvent("complete \"quoted\"", "cat1", {{"int_arg", 42}, {"string_arg", "hello"}});
+                auto                  async = handler.startAsyncEvent("async", "cat2");
+                async.step();
+            }
+            handler.instantEvent("instant");
+            handler.counterEvent("counter", "", {{"value", 1.5}});
+
+            std::thread([&profiler] { profiler.forThisThread().instantEvent("other thread"); }).join();
+        });
+
+        const std::string binary = readFile(traceFile);
+        expect(binary.starts_with(std::string_view("GRTRACE"))) << "binary trace header";
+
+        std::ifstream     in(traceFile, std::ios::in | std::ios::binary);
+        std::stringstream json;
+        expect(convertBinaryTraceToJson(in, json));
+        const std::string trace = json.str();
+        expect(trace.starts_with("[")) << trace;
+        expect(eq(countOccurrences(trace, R"("name": "complete \"quoted\"", "ph": "X")"), 1UZ)) << trace;
+        expect(eq(countOccurrences(trace, R"("name": "async")"), 3UZ)) << "start, step, and end";
+        expect(eq(countOccurrences(trace, R"("name": "instant", "ph": "I")"), 1UZ));
+        expect(eq(countOccurrences(trace, R"("name": "counter", "ph": "C")"), 1UZ));
+        expect(eq(countOccurrences(trace, R"("tid": 1)"), 1UZ)) << "events of the second thread";
+        expect(eq(countOccurrences(trace, R"("args": {"int_arg":42,"string_arg":"hello"})"), 1UZ)) << trace;
+        expect(eq(countOccurrences(trace, R"("args": {"value":1.5})"), 1UZ)) << trace;
+
+        std::filesystem::remove(traceFile);
+    };
+
+    "JSON trace"_test = [&tmpDir] {
+        const auto traceFile = tmpDir / fmt::format("qa_Profiler.{}.trace", getpid());
+        recordEvents({.output_file = traceFile.string(), .output_format = OutputFormat::Json}, [](Profiler& profiler) { profiler.forThisThread().instantEvent("instant", "cat", {{"key", "value"}}); });
+
+        const std::string trace = readFile(traceFile);
+        expect(trace.starts_with("[")) << trace;
+        expect(eq(countOccurrences(trace, R"("name": "instant", "ph": "I")"), 1UZ)) << trace;
+        expect(eq(countOccurrences(trace, R"("cat": "cat", "args": {"key":"value"})"), 1UZ)) << trace;
+
+        std::filesystem::remove(traceFile);
+    };
+
+    "full buffers drop events instead of blocking"_test = [&tmpDir] {
+        const auto  traceFile = tmpDir / fmt::format("qa_Profiler.{}.dropped.grtrace", getpid());
+        std::size_t nDropped  = 0UZ;
+        recordEvents({.output_file = traceFile.string(), .buffer_size = 1024UZ, .flush_interval = std::chrono::milliseconds(1000)}, [&nDropped](Profiler& profiler) {
+            auto& handler = profiler.forThisThread();
+            for (std::size_t i = 0UZ; i < 100'000UZ; i++) {
+                handler.instantEvent("instant");
+            }
+            nDropped = profiler.droppedEvents();
+        });
+        expect(gt(nDropped, 0UZ));
+
+        std::ifstream     in(traceFile, std::ios::in | std::ios::binary);
+        std::stringstream json;
+        expect(convertBinaryTraceToJson(in, json));
+        expect(eq(countOccurrences(json.str(), R"("name": "instant")") + nDropped, 100'000UZ)) << "each event is either written or counted as dropped";
+
+        std::filesystem::remove(traceFile);
+    };
+
+    "invalid binary trace"_test = [] {
+        std::stringstream in("not a trace");
+        std::stringstream out;
+        expect(!convertBinaryTraceToJson(in, out));
+    };
+
+    "corrupt binary trace record sizes"_test = [] {
+        auto corruptRecord = [](char recordType, std::uint32_t first, std::uint32_t second) {
+            std::stringstream trace;
+            gr::profiling::detail::BinaryTraceWriter header(trace, 42); // writes a valid file header
+            trace.put(recordType);
+            trace.write(reinterpret_cast<const char*>(&first), sizeof(first));
+            trace.write(reinterpret_cast<const char*>(&second), sizeof(second));
+            return trace;
+        };
+        std::stringstream out;
+        auto              eventCount = corruptRecord('E', std::numeric_limits<std::uint32_t>::max(), 0U);
+        expect(!convertBinaryTraceToJson(eventCount, out)) << "event count exceeding the stream size";
+        auto stringLength = corruptRecord('S', 0U, std::numeric_limits<std::uint32_t>::max());
+        expect(!convertBinaryTraceToJson(stringLength, out)) << "string length exceeding the stream size";
+        auto stringId = corruptRecord('S', std::numeric_limits<std::uint32_t>::max(), 0U);
+        expect(!convertBinaryTraceToJson(stringId, out)) << "non-dense string id";
+    };
+};
+
+int main() { /* not needed for UT */ }
@@ -1,6 +1,7 @@
 #include <boost/ut.hpp>
 
 #include <gnuradio-4.0/Scheduler.hpp>
+#include <gnuradio-4.0/StaticGraph.hpp>
 #include <gnuradio-4.0/testing/NullSources.hpp>
 
 #include <chrono>
@@ -231,6 +232,91 @@ gr::Graph getGraphScaledSum(std::shared_ptr<Tracer> tracer) {
     return flow;
 }
 
+gr::Graph getGraphChain(std::shared_ptr<Tracer> tracer, std::size_t nStages) {
+    using namespace boost::ut;
+
+    gr::Size_t nMaxSamples{100000};
+
+    gr::Graph flow;
+    auto&     source = flow.emplaceBlock<CountSource<int>>({{"name", "s1"}, {"n_samples_max", nMaxSamples}});
+    source.tracer    = tracer;
+    auto* previous   = &flow.emplaceBlock<Scale<int>>({{"name", "mult0"}, {"scale_factor", 2}});
+    previous->tracer = tracer;
+    expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"out">(source).to<"original">(*previous)));
+    for (std::size_t i = 1UZ; i < nStages; i++) {
+        auto& scaleBlock  = flow.emplaceBlock<Scale<int>>({{"name", fmt::format("mult{}", i)}, {"scale_factor", 1}});
+        scaleBlock.tracer = tracer;
+        expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"scaled">(*previous).to<"original">(scaleBlock)));
+        previous = &scaleBlock;
+    }
+    auto& sink   = flow.emplaceBlock<ExpectSink<int>>({{"name", "out"}, {"n_samples_max", nMaxSamples}});
+    sink.tracer  = tracer;
+    sink.checker = [](std::uint64_t count, std::uint64_t data) -> bool { return data == 2 * count; };
+    expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"scaled">(*previous).to<"in">(sink)));
+
+    return flow;
+}
+
+template<typename T>
+struct TrickleSource : public gr::Block<TrickleSource<T>> { // produces at most 64 samples per work(..) call
+    gr::PortOut<T, gr::RequiredSamples<1UZ, 64UZ>> out;
+    gr::Size_t                                     n_samples_max = 0U;
+
+    GR_MAKE_REFLECTABLE(TrickleSource, out, n_samples_max);
+
+    gr::Size_t count = 0U;
+
+    [[nodiscard]] constexpr T processOne() noexcept {
+        count++;
+        if (count >= n_samples_max) {
+            this->requestStop();
+        }
+        return static_cast<T>(count);
+    }
+};
+
+template<typename T>
+struct CallSizeRecordingSink : public gr::Block<CallSizeRecordingSink<T>> { // records the number of samples of each processBulk(..) call
+    gr::PortIn<T> in;
+
+    GR_MAKE_REFLECTABLE(CallSizeRecordingSink, in);
+
+    std::vector<std::size_t> callSizes;
+    gr::Size_t               count = 0U;
+
+    [[nodiscard]] gr::work::Status processBulk(std::span<const T> input) {
+        callSizes.push_back(input.size());
+        count += static_cast<gr::Size_t>(input.size());
+        return gr::work::Status::OK;
+    }
+};
+
+gr::Graph getGraphTrickle(gr::Size_t nSamples, std::size_t sinkBufferSize = 65536UZ) {
+    using namespace boost::ut;
+    using namespace std::string_literals;
+
+    gr::Graph flow;
+    auto&     source = flow.emplaceBlock<TrickleSource<int>>({{"n_samples_max", nSamples}});
+    auto&     copy1  = flow.emplaceBlock<gr::testing::Copy<int>>();
+    auto&     copy2  = flow.emplaceBlock<gr::testing::Copy<int>>();
+    auto&     sink   = flow.emplaceBlock<CallSizeRecordingSink<int>>();
+    expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"out">(source).to<"in">(copy1)));
+    expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"out">(copy1).to<"in">(copy2)));
+    expect(eq(gr::ConnectionResult::SUCCESS, flow.connect(copy2, "out"s, sink, "in"s, sinkBufferSize)));
+
+    return flow;
+}
+
+/// all but the last call (i.e. the tail flushed by the latency bound) process at least 'minBatchSize' samples in multiples of 'alignment'
+void expectBatchedCalls(const std::vector<std::size_t>& callSizes, std::size_t minBatchSize, std::size_t alignment, const std::source_location location = std::source_location::current()) {
+    using namespace boost::ut;
+    expect(fatal(!callSizes.empty()), location);
+    for (std::size_t i = 0UZ; i + 1UZ < callSizes.size(); i++) {
+        expect(ge(callSizes[i], minBatchSize), location) << fmt::format("call {} of {}: {} samples", i, callSizes.size(), callSizes[i]);
+        expect(eq(callSizes[i] % alignment, 0UZ), location) << fmt::format("call {} of {}: {} samples", i, callSizes.size(), callSizes[i]);
+    }
+}
+
 template<typename TBlock>
 void checkBlockNames(const std::vector<TBlock>& joblist, std::set<std::string> set) {
     boost::ut::expect(boost::ut::that % joblist.size() == set.size());
@@ -488,6 +574,244 @@ const boost::ut::suite<"SchedulerTests"> SchedulerTests = [] {
         expect(boost::ut::that % t.size() >= 10u);
     };
 
+    "linear chain detection"_test = [] {
+        using namespace gr::testing;
+        gr::Graph flow;
+        auto&     source = flow.emplaceBlock<CountingSource<float>>({{"name", "source"}});
+        auto&     copyA  = flow.emplaceBlock<Copy<float>>({{"name", "copyA"}});
+        auto&     copyB  = flow.emplaceBlock<Copy<float>>({{"name", "copyB"}});
+        auto&     copyC  = flow.emplaceBlock<Copy<float>>({{"name", "copyC"}});
+        auto&     sink1  = flow.emplaceBlock<NullSink<float>>({{"name", "sink1"}});
+        auto&     sink2  = flow.emplaceBlock<NullSink<float>>({{"name", "sink2"}});
+        expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"out">(source).to<"in">(copyA)));
+        expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"out">(copyA).to<"in">(copyB)));
+        expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"out">(copyB).to<"in">(copyC))); // fan-out: copyB terminates the first chain
+        expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"out">(copyB).to<"in">(sink2)));
+        expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"out">(copyC).to<"in">(sink1)));
+
+        const auto chains = gr::graph::findLinearChains(flow);
+        expect(eq(chains.size(), 2UZ));
+        auto names = [](const std::vector<BlockModel*>& chain) {
+            std::vector<std::string> result;
+            std::ranges::transform(chain, std::back_inserter(result), [](const BlockModel* block) { return std::string(block->name()); });
+            return result;
+        };
+        if (chains.size() == 2UZ) {
+            expect(boost::ut::that % names(chains[0]) == std::vector<std::string>{"source", "copyA", "copyB"});
+            expect(boost::ut::that % names(chains[1]) == std::vector<std::string>{"copyC", "sink1"});
+        }
+    };
+
+    "SimpleScheduler_linear_fused"_test = [] {
+        auto threadPool               = std::make_shared<gr::thread_pool::BasicThreadPool>("custom pool", gr::thread_pool::CPU_BOUND, 2, 2);
+        using scheduler               = gr::scheduler::Simple<>;
+        std::shared_ptr<Tracer> trace = std::make_shared<Tracer>();
+        auto                    sched = scheduler{getGraphChain(trace, 10UZ), threadPool};
+        sched.fuse_linear_chains      = true;
+        sched.chain_strip_size        = 1024U;
+        expect(sched.runAndWait().has_value());
+
+        expect(eq(sched.jobs()->size(), 1UZ));
+        expect(eq(sched.jobs()->at(0).size(), 1UZ)) << "source, 10 stages and sink are fused into one scheduling unit";
+        auto* sink = static_cast<ExpectSink<int>*>(sched.graph().blocks().back()->raw());
+        expect(eq(sink->count, 100000U));
+        expect(eq(sink->false_count, 0U));
+        for (const auto& edge : sched.graph().edges()) {
+            expect(lt(edge.bufferSize(), 65536UZ)) << fmt::format("chain-internal edge is cache-sized: {}", edge);
+        }
+    };
+
+    "BreadthFirstScheduler_linear_fused_multi_threaded"_test = [] {
+        auto threadPool               = std::make_shared<gr::thread_pool::BasicThreadPool>("custom pool", gr::thread_pool::CPU_BOUND, 2, 2);
+        using scheduler               = gr::scheduler::BreadthFirst<gr::scheduler::ExecutionPolicy::multiThreaded>;
+        std::shared_ptr<Tracer> trace = std::make_shared<Tracer>();
+        auto                    sched = scheduler{getGraphChain(trace, 10UZ), threadPool};
+        sched.fuse_linear_chains      = true;
+        expect(sched.runAndWait().has_value());
+
+        expect(eq(sched.jobs()->size(), 1UZ)) << "a single fused chain needs only one worker";
+        auto* sink = static_cast<ExpectSink<int>*>(sched.graph().blocks().back()->raw());
+        expect(eq(sink->count, 100000U));
+        expect(eq(sink->false_count, 0U));
+    };
+
+    "SimpleScheduler_linear_min_batch"_test = [] {
+        constexpr gr::Size_t nSamples   = 100000U;
+        auto                 threadPool = std::make_shared<gr::thread_pool::BasicThreadPool>("custom pool", gr::thread_pool::CPU_BOUND, 2, 2);
+        using scheduler                 = gr::scheduler::Simple<>;
+
+        auto reference = scheduler{getGraphTrickle(nSamples), threadPool};
+        expect(reference.runAndWait().has_value());
+        const auto& referenceCalls = static_cast<CallSizeRecordingSink<int>*>(reference.graph().blocks().back()->raw())->callSizes;
+
+        auto sched                 = scheduler{getGraphTrickle(nSamples), threadPool};
+        sched.min_batch_size       = 4096U;
+        sched.max_batch_latency_us = 20'000U; // N.B. >> accumulation time of a batch -> only the tail is flushed by the latency bound
+        sched.batch_alignment      = 512U;
+        expect(sched.runAndWait().has_value());
+
+        auto* sink = static_cast<CallSizeRecordingSink<int>*>(sched.graph().blocks().back()->raw());
+        expect(eq(sink->count, nSamples)) << "the unaligned tail is flushed once the latency bound expired";
+        expectBatchedCalls(sink->callSizes, 4096UZ, 512UZ);
+        expect(lt(sink->callSizes.size(), referenceCalls.size())) << fmt::format("{} batched vs. {} unbatched calls", sink->callSizes.size(), referenceCalls.size());
+    };
+
+    "BreadthFirstScheduler_per_block_batch_policy_multi_threaded"_test = [] {
+        constexpr gr::Size_t  nSamples       = 100000U;
+        constexpr std::size_t sinkBufferSize = 8192UZ;
+        auto                  threadPool     = std::make_shared<gr::thread_pool::BasicThreadPool>("custom pool", gr::thread_pool::CPU_BOUND, 2, 2);
+        using scheduler                      = gr::scheduler::BreadthFirst<gr::scheduler::ExecutionPolicy::multiThreaded>;
+
+        auto reference = scheduler{getGraphTrickle(nSamples, sinkBufferSize), threadPool};
+        expect(reference.runAndWait().has_value());
+        const auto& referenceCalls = static_cast<CallSizeRecordingSink<int>*>(reference.graph().blocks().back()->raw())->callSizes;
+
+        auto              sched = scheduler{getGraphTrickle(nSamples, sinkBufferSize), threadPool};
+        const std::string sinkName{sched.graph().blocks().back()->uniqueName()};
+        sched.setBatchPolicy(sinkName, {.minBatchSize = 1'000'000UZ, .maxLatency = std::chrono::milliseconds(50), .alignment = 1024UZ}); // N.B. exceeds the sink's input buffer
+        expect(sched.runAndWait().has_value());
+
+        auto* sink = static_cast<CallSizeRecordingSink<int>*>(sched.graph().blocks().back()->raw());
+        expect(eq(sink->count, nSamples));
+        const std::size_t bufferSize = sink->in.bufferSize();
+        expect(ge(bufferSize, sinkBufferSize));
+        expectBatchedCalls(sink->callSizes, bufferSize, 1024UZ); // 'minBatchSize' is clamped to the input buffer size
+        expect(lt(sink->callSizes.size(), referenceCalls.size())) << fmt::format("{} batched vs. {} unbatched calls", sink->callSizes.size(), referenceCalls.size());
+    };
+
+    "SimpleScheduler_fused_chain_min_batch"_test = [] {
+        using namespace std::string_literals;
+        constexpr gr::Size_t nSamples   = 100000U;
+        auto                 threadPool = std::make_shared<gr::thread_pool::BasicThreadPool>("custom pool", gr::thread_pool::CPU_BOUND, 2, 2);
+
+        gr::Graph flow; // N.B. the second consumer keeps the source out of the chain, i.e. the fused chain has a gated input
+        auto&     source = flow.emplaceBlock<TrickleSource<int>>({{"n_samples_max", nSamples}});
+        auto&     copy1  = flow.emplaceBlock<gr::testing::Copy<int>>();
+        auto&     copy2  = flow.emplaceBlock<gr::testing::Copy<int>>();
+        auto&     sink   = flow.emplaceBlock<CallSizeRecordingSink<int>>();
+        auto&     other  = flow.emplaceBlock<gr::testing::NullSink<int>>();
+        expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"out">(source).to<"in">(copy1)));
+        expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"out">(copy1).to<"in">(copy2)));
+        expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"out">(copy2).to<"in">(sink)));
+        expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"out">(source).to<"in">(other)));
+        const std::string headName{copy1.unique_name};
+
+        auto sched               = gr::scheduler::Simple<>{std::move(flow), threadPool};
+        sched.fuse_linear_chains = true;
+        sched.chain_strip_size   = 1024U;
+        sched.setBatchPolicy(headName, {.minBatchSize = 4096UZ, .maxLatency = std::chrono::milliseconds(20), .alignment = 1024UZ});
+        expect(sched.runAndWait().has_value());
+
+        auto* recorder = static_cast<CallSizeRecordingSink<int>*>(sched.graph().blocks()[3UZ]->raw());
+        expect(eq(recorder->count, nSamples));
+        expectBatchedCalls(recorder->callSizes, 1024UZ, 1024UZ); // gated on the head's input: full strips rather than the 64-sample calls of the source
+    };
+
+    "SimpleScheduler_perf_counters"_test = [] {
+        auto threadPool               = std::make_shared<gr::thread_pool::BasicThreadPool>("custom pool", gr::thread_pool::CPU_BOUND, 2, 2);
+        using scheduler               = gr::scheduler::Simple<gr::scheduler::ExecutionPolicy::multiThreaded>;
+        std::shared_ptr<Tracer> trace = std::make_shared<Tracer>();
+        auto                    sched = scheduler{getGraphChain(trace, 3UZ), threadPool};
+        sched.perf_counter_interval   = 4U;
+        expect(sched.runAndWait().has_value());
+
+        const bool         hasCounters = gr::profiling::perf::ThreadCounters::forThisThread().isValid(); // N.B. requires PMU access, e.g. not in most CI containers
+        const property_map counters    = sched.perfCounters(true);
+        expect(eq(counters.size(), sched.graph().blocks().size()));
+        for (const auto& block : sched.graph().blocks()) {
+            const auto it = counters.find(std::string(block->uniqueName()));
+            expect(it != counters.end()) << fmt::format("missing counters of {}", block->uniqueName());
+            if (it == counters.end()) {
+                continue;
+            }
+            const auto&         blockCounters = std::get<property_map>(it->second);
+            const std::uint64_t nCalls        = std::get<std::uint64_t>(blockCounters.at("calls"));
+            const std::uint64_t nSampled      = std::get<std::uint64_t>(blockCounters.at("sampled_calls"));
+            expect(gt(nCalls, 0U));
+            expect(le(nSampled, nCalls / 4U));
+            if (hasCounters) {
+                expect(gt(nSampled, 0U));
+                expect(gt(std::get<std::uint64_t>(blockCounters.at("instructions")), 0U));
+            }
+        }
+
+        const property_map afterReset = sched.perfCounters();
+        expect(std::ranges::all_of(afterReset, [](const auto& entry) { return std::get<std::uint64_t>(std::get<property_map>(entry.second).at("calls")) == 0U; })) << "counters are reset";
+    };
+
+    "SimpleScheduler_perf_counters_message_endpoint"_test = [] {
+        using enum gr::message::Command;
+        auto threadPool               = std::make_shared<gr::thread_pool::BasicThreadPool>("custom pool", gr::thread_pool::CPU_BOUND, 2, 2);
+        using scheduler               = gr::scheduler::Simple<gr::scheduler::ExecutionPolicy::singleThreaded>;
+        std::shared_ptr<Tracer> trace = std::make_shared<Tracer>();
+        auto                    sched = scheduler{getGraphChain(trace, 3UZ), threadPool};
+        sched.perf_counter_interval   = 4U;
+        expect(sched.runAndWait().has_value());
+
+        gr::MsgPortOut toScheduler;
+        gr::MsgPortIn  fromScheduler;
+        expect(eq(gr::ConnectionResult::SUCCESS, toScheduler.connect(sched.msgIn)));
+        expect(eq(gr::ConnectionResult::SUCCESS, sched.msgOut.connect(fromScheduler)));
+
+        auto request = [&](gr::message::Command cmd) {
+            if (cmd == Get) {
+                gr::sendMessage<Get>(toScheduler, sched.unique_name, gr::scheduler::property::kPerfCounters, {});
+            } else {
+                gr::sendMessage<Set>(toScheduler, sched.unique_name, gr::scheduler::property::kPerfCounters, {});
+            }
+            sched.processScheduledMessages();
+            ReaderSpanLike auto messages = fromScheduler.streamReader().get<gr::SpanReleasePolicy::ProcessAll>(fromScheduler.streamReader().available());
+            const auto          it       = std::ranges::find_if(messages, [](const gr::Message& msg) { return msg.endpoint == gr::scheduler::property::kPerfCounters; });
+            expect(it != messages.end()) << "no reply on the PerfCounters endpoint";
+            property_map result = it != messages.end() && it->data.has_value() ? it->data.value() : property_map{};
+            expect(messages.consume(messages.size()));
+            return result;
+        };
+        auto nCalls = [](const property_map& counters, const std::string& blockName) { return std::get<std::uint64_t>(std::get<property_map>(counters.at(blockName)).at("calls")); };
+
+        const std::string  sinkName{sched.graph().blocks().back()->uniqueName()};
+        const property_map viaGet = request(Get);
+        expect(eq(viaGet.size(), sched.graph().blocks().size()));
+        expect(fatal(viaGet.contains(sinkName)));
+        expect(gt(nCalls(viaGet, sinkName), 0U));
+        expect(eq(nCalls(sched.perfCounters(), sinkName), nCalls(viaGet, sinkName))) << "'Get' does not reset the counters";
+
+        const property_map viaSet = request(Set);
+        expect(eq(nCalls(viaSet, sinkName), nCalls(viaGet, sinkName))) << "'Set' returns the accumulated counters";
+        expect(eq(nCalls(request(Get), sinkName), 0U)) << "'Set' resets the counters";
+    };
+
+    "StaticGraph_linear"_test = [] {
+        using namespace gr::testing;
+        using TGraph = gr::StaticGraph<gr::StaticBlocks<CountingSource<float>, Copy<float>, Copy<float>, CountingSink<float>>, //
+            gr::StaticEdges<gr::StaticEdge<0, "out", 1, "in", 256UZ>, gr::StaticEdge<1, "out", 2, "in", 256UZ>, gr::StaticEdge<2, "out", 3, "in", 256UZ>>>;
+        TGraph graph({{{{"n_samples_max", gr::Size_t(100000)}}, {}, {}, {}}});
+        static_assert(TGraph::size() == 4UZ);
+        expect(std::ranges::all_of(graph.bufferSizes(), [](std::size_t size) { return size == 256UZ; })) << "buffer sizes are computed once when connecting";
+
+        expect(graph.runAndWait().has_value());
+        expect(eq(graph.block<0>().count, 100000U));
+        expect(eq(graph.block<3>().count, 100000U));
+        expect(graph.block<3>().state() == gr::lifecycle::State::STOPPED);
+
+        expect(graph.runAndWait().has_value()) << "re-run resets the blocks and edges";
+        expect(eq(graph.block<3>().count, 100000U));
+    };
+
+    "StaticGraph_work_chunks"_test = [] {
+        using namespace gr::testing;
+        gr::StaticGraph<gr::StaticBlocks<CountingSource<float>, Copy<float>, CountingSink<float>>, gr::StaticEdges<gr::StaticEdge<0, "out", 1, "in">, gr::StaticEdge<1, "out", 2, "in">>> graph;
+        expect(graph.start().has_value());
+        for (std::size_t i = 0UZ; i < 10UZ; i++) {
+            const auto [_, performedWork, status] = graph.work(64UZ);
+            expect(status == gr::work::Status::OK);
+            expect(eq(performedWork, 3UZ * 64UZ)) << "each block processes one chunk per pass";
+        }
+        expect(eq(graph.block<2>().count, 640U));
+        graph.stop();
+        expect(graph.block<0>().state() == gr::lifecycle::State::STOPPED);
+    };
+
     "LifecycleBlock"_test = [] {
         auto threadPool = std::make_shared<gr::thread_pool::BasicThreadPool>("custom pool", gr::thread_pool::CPU_BOUND, 2, 2);
         using scheduler = gr::scheduler::Simple<>;
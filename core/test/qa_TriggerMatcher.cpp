@@ -253,6 +253,41 @@ const boost::ut::suite<"BasicTriggerNameCtxMatcher"> triggerTest = [] {
             expect(eq(matcher(filter, createTag("alarm", "room1"), state), Matching));
         };
     };
+
+    "MatcherSet equivalence to individual filters"_test = [] {
+        using namespace std::string_literals;
+        using enum gr::trigger::MatchResult;
+        using namespace gr::trigger::BasicTriggerNameCtxMatcher;
+        constexpr auto createTag = [](std::string triggerName, std::string cxt) noexcept {
+            auto meta = property_map{{tag::CONTEXT.shortKey(), cxt}};
+            return Tag(0, {{tag::TRIGGER_NAME.shortKey(), triggerName}, {tag::TRIGGER_META_INFO.shortKey(), meta}});
+        };
+
+        const std::vector<std::string> filters{"[alarm/room1, alarm/room3]", "[alarm/room1, alarm/^room3]", "[alarm/^room1, alarm/^room3]", "[^alarm/room1, alarm/room3]", "[^alarm/^room1, ^alarm/room3]", //
+            "[alarm/room1]", "[, alarm/room1]", "[alarm/room1, alarm/room1]", "[/room2]", "[info, alarm]", ""};
+        MatcherSet                        matchers(filters);
+        std::vector<property_map>         referenceStates(filters.size());
+        std::vector<trigger::MatchResult> results(filters.size());
+        expect(eq(matchers.size(), filters.size()));
+        expect(matchers.filter(5UZ).isSingleTrigger());
+        expect(!matchers.filter(0UZ).isSingleTrigger());
+
+        const std::vector<Tag> tags{createTag("alarm", "room1"), createTag("alarm", "room1"), createTag("info", "room2"), createTag("alarm", "room2"), createTag("other", "room2"), createTag("alarm", "room3"), //
+            Tag{}, createTag("alarm", "room4"), createTag("other", "room1"), createTag("alarm", "room1"), createTag("other", "room4"), createTag("info", "room3"), createTag("alarm", "room3"), createTag("other", "room1")};
+        std::size_t nMatching = 0UZ;
+        for (std::size_t tagIndex = 0UZ; tagIndex < tags.size(); tagIndex++) {
+            matchers.match(tags[tagIndex], results);
+            for (std::size_t i = 0UZ; i < filters.size(); i++) {
+                const trigger::MatchResult expected = filter(filters[i], tags[tagIndex], referenceStates[i]);
+                expect(eq(results[i], expected)) << fmt::format("tag #{} filter '{}'", tagIndex, filters[i]);
+                nMatching += results[i] != Ignore;
+            }
+        }
+        expect(nMatching > 0UZ);
+
+        matchers.reset();
+        expect(!matchers.state(0UZ).triggerActive);
+    };
 };
 
 int main() { /* not needed for UT */ }
@@ -464,6 +464,37 @@ const boost::ut::suite CircularBufferTests = [] {
         }
     } | CircularBufferTypesToTest();
 
+    "CircularBuffer - additional reader at existing reader position"_test = [] {
+        gr::CircularBuffer<int32_t> buffer(1024);
+        BufferWriterLike auto       writer = buffer.new_writer();
+        BufferReaderLike auto       reader = buffer.new_reader();
+        {
+            WriterSpanLike auto pSpan = writer.reserve(10);
+            std::iota(pSpan.begin(), pSpan.end(), 0);
+            pSpan.publish(10);
+        }
+        {
+            ReaderSpanLike auto cSpan = reader.get(4);
+            expect(cSpan.consume(4));
+        }
+
+        BufferReaderLike auto tap = buffer.new_reader(reader);
+        expect(eq(buffer.n_readers(), 2UZ));
+        expect(eq(tap.position(), reader.position()));
+        expect(eq(tap.available(), 6UZ));
+        ReaderSpanLike auto tapSpan = tap.get();
+        expect(eq(tapSpan[0], 4));
+        expect(eq(tapSpan[5], 9));
+        expect(eq(buffer.new_reader().available(), 0UZ)) << "plain new_reader() starts at the writer position";
+
+        // the tap reader also holds back the writer
+        {
+            ReaderSpanLike auto cSpan = reader.get();
+            expect(cSpan.consume(cSpan.size()));
+        }
+        expect(eq(writer.available(), buffer.size() - 6UZ));
+    };
+
     "MultiProducerStdMapSingleWriter"_test = [] {
         // Using std::map exposed some race conditions in the multi-producer buffer implementation
         // that did not surface with trivial types. (two readers for good measure, issues occurred also
@@ -756,6 +787,28 @@ const boost::ut::suite HistoryBufferTest = [] {
         expect(equal(std::vector(hb.crbegin(), hb.crend()), std::vector(hb.rbegin(), hb.rend()))) << "const non-const iterator equivalency";
     };
 
+    "HistoryBuffer - set_capacity"_test = [] {
+        auto equal = [](const auto& range1, const auto& range2) { return std::equal(range1.begin(), range1.end(), range2.begin(), range2.end()); };
+
+        HistoryBuffer<int> hb(4);
+        hb.push_back_bulk(std::array{1, 2, 3, 4, 5, 6}); // wrapped around: [6, 5, 4, 3]
+
+        hb.set_capacity(8); // grow
+        expect(eq(hb.capacity(), 8UZ));
+        expect(eq(hb.size(), 4UZ));
+        expect(equal(hb.get_span(0), std::vector{6, 5, 4, 3})) << fmt::format("failed - got [{}]", fmt::join(hb.get_span(0), ", "));
+        hb.push_back_bulk(std::array{7, 8, 9, 10, 11});
+        expect(equal(hb.get_span(0), std::vector{11, 10, 9, 8, 7, 6, 5, 4})) << fmt::format("failed - got [{}]", fmt::join(hb.get_span(0), ", "));
+
+        hb.set_capacity(3); // shrink -> keeps the newest samples
+        expect(eq(hb.capacity(), 3UZ));
+        expect(equal(hb.get_span(0), std::vector{11, 10, 9})) << fmt::format("failed - got [{}]", fmt::join(hb.get_span(0), ", "));
+        hb.push_back(12);
+        expect(equal(hb.get_span(0), std::vector{12, 11, 10})) << fmt::format("failed - got [{}]", fmt::join(hb.get_span(0), ", "));
+
+        expect(throws<std::out_of_range>([&hb] { hb.set_capacity(0); })) << "throws for 0 capacity";
+    };
+
     "HistoryBuffer<T> constexpr sized"_test = [] {
         HistoryBuffer<int, 5UZ> buffer5;
         HistoryBuffer<int, 8UZ> buffer8;